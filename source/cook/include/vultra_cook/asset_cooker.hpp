@@ -0,0 +1,28 @@
+#pragma once
+
+#include <vultra_engine/asset/asset_import_pipeline.hpp>
+
+#include <cstdint>
+#include <filesystem>
+
+namespace vultra
+{
+    namespace cook
+    {
+        constexpr int COOK_EXIT_SUCCESS = 0;
+        constexpr int COOK_EXIT_FAILURE = 1; // Some assets failed to import or the registry could not be written
+        constexpr int COOK_EXIT_USAGE   = 2; // Bad arguments or project file
+
+        struct CookOptions
+        {
+            std::filesystem::path projectFile;
+            std::filesystem::path reportFile; // Optional JSON report for build machines
+
+            engine::AssetImportOptions importOptions {};
+        };
+
+        // Imports the Assets/ folder of a project into .imported/ without a window or a GPU device, the same way the
+        // editor does on startup, so content can be cooked ahead of time. Returns the process exit code.
+        int cookProject(const CookOptions& options);
+    } // namespace cook
+} // namespace vultra
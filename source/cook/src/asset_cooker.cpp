@@ -0,0 +1,123 @@
+#include "vultra_cook/asset_cooker.hpp"
+
+#include <vultra/core/base/common_context.hpp>
+#include <vultra_engine/asset/asset_paths.hpp>
+#include <vultra_engine/asset/asset_registry_bootstrap.hpp>
+#include <vultra_engine/project/project.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+
+namespace vultra
+{
+    namespace cook
+    {
+        namespace
+        {
+            struct CookThroughput
+            {
+                double assetsPerSecond {0.0};
+                double megabytesPerSecond {0.0};
+                double scannedMegabytes {0.0};
+            };
+
+            double toMegabytes(uint64_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); }
+
+            CookThroughput computeThroughput(const engine::AssetImportReport& report)
+            {
+                CookThroughput throughput {};
+                for (const auto& record : report.records)
+                    throughput.scannedMegabytes += toMegabytes(record.bytes);
+
+                const double seconds = report.totalMs / 1000.0;
+                if (seconds > 0.0)
+                {
+                    throughput.assetsPerSecond    = static_cast<double>(report.importedCount) / seconds;
+                    throughput.megabytesPerSecond = toMegabytes(report.importedBytes) / seconds;
+                }
+                return throughput;
+            }
+
+            bool writeReport(const std::filesystem::path&     reportFile,
+                             const engine::Project&           project,
+                             const engine::AssetImportReport& report,
+                             const CookThroughput&            throughput)
+            {
+                // Records are in path order already, so the report only differs where the timings do
+                nlohmann::ordered_json assets = nlohmann::ordered_json::array();
+                for (const auto& record : report.records)
+                {
+                    assets.push_back({{"path", record.path.generic_string()},
+                                      {"bytes", record.bytes},
+                                      {"skipped", record.skipped},
+                                      {"succeeded", record.succeeded},
+                                      {"hashMs", record.hashMs},
+                                      {"importMs", record.importMs}});
+                }
+
+                nlohmann::ordered_json j;
+                j["project"]            = project.name;
+                j["workerCount"]        = report.workerCount;
+                j["totalMs"]            = report.totalMs;
+                j["importedCount"]      = report.importedCount;
+                j["skippedCount"]       = report.skippedCount;
+                j["failedCount"]        = report.failedCount;
+                j["importedBytes"]      = report.importedBytes;
+                j["assetsPerSecond"]    = throughput.assetsPerSecond;
+                j["megabytesPerSecond"] = throughput.megabytesPerSecond;
+                j["assets"]             = std::move(assets);
+
+                std::ofstream out(reportFile, std::ios::trunc);
+                out << j.dump(4);
+                return out.good();
+            }
+        } // namespace
+
+        int cookProject(const CookOptions& options)
+        {
+            engine::Project project {};
+            if (!engine::loadProject(options.projectFile.generic_string(), project))
+            {
+                VULTRA_CLIENT_ERROR("Failed to load project file: {}", options.projectFile.generic_string());
+                return COOK_EXIT_USAGE;
+            }
+            project.directory = options.projectFile.parent_path().generic_string();
+
+            const auto projectDir  = std::filesystem::path(project.directory);
+            const auto assetDir    = projectDir / engine::ASSET_IMPORT_FOLDER;
+            const auto importedDir = projectDir / engine::ASSET_EXPORT_FOLDER;
+
+            VULTRA_CLIENT_INFO("Cooking project {} ({})", project.name, assetDir.generic_string());
+
+            // Shared with AssetDatabase::initialize, so the editor picks up exactly what was cooked
+            vasset::VAssetRegistry      registry;
+            engine::BinaryAssetRegistry binaryRegistry;
+            engine::AssetImportPipeline pipeline(registry, assetDir, importedDir);
+            engine::AssetImportReport   report;
+            if (!engine::bootstrapAssetRegistry(
+                    registry, binaryRegistry, pipeline, importedDir, options.importOptions, report))
+            {
+                return COOK_EXIT_FAILURE;
+            }
+
+            const auto throughput = computeThroughput(report);
+            VULTRA_CLIENT_INFO("Cooked {} assets ({:.2f} MB) in {:.1f} ms: {:.1f} assets/s, {:.2f} MB/s, "
+                               "{:.2f} MB scanned",
+                               report.importedCount,
+                               toMegabytes(report.importedBytes),
+                               report.totalMs,
+                               throughput.assetsPerSecond,
+                               throughput.megabytesPerSecond,
+                               throughput.scannedMegabytes);
+
+            if (!options.reportFile.empty() && !writeReport(options.reportFile, project, report, throughput))
+            {
+                VULTRA_CLIENT_ERROR("Failed to write cook report: {}", options.reportFile.generic_string());
+                return COOK_EXIT_FAILURE;
+            }
+
+            return report.succeeded() ? COOK_EXIT_SUCCESS : COOK_EXIT_FAILURE;
+        }
+    } // namespace cook
+} // namespace vultra
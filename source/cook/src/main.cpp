@@ -0,0 +1,45 @@
+#include "vultra_cook/asset_cooker.hpp"
+
+#include <vultra/core/base/common_context.hpp>
+
+#include <argparse/argparse.hpp>
+
+int main(int argc, char** argv)
+{
+    argparse::ArgumentParser parser("VultraCook");
+    parser.add_description("Imports the assets of a Vultra project without starting the editor");
+
+    parser.add_argument("project").help("Path to the project file (.vproj)");
+    parser.add_argument("-j", "--workers")
+        .help("Number of import workers, 0 for one per hardware thread")
+        .default_value(0u)
+        .scan<'u', uint32_t>();
+    parser.add_argument("--force")
+        .help("Reimport every asset, ignoring the import cache")
+        .default_value(false)
+        .implicit_value(true);
+    parser.add_argument("--slowest")
+        .help("Number of slowest assets to list")
+        .default_value(10u)
+        .scan<'u', uint32_t>();
+    parser.add_argument("--report").help("Write a JSON report to this path").default_value(std::string(""));
+
+    try
+    {
+        parser.parse_args(argc, argv);
+    }
+    catch (const std::exception& e)
+    {
+        VULTRA_CLIENT_ERROR("{}", e.what());
+        return vultra::cook::COOK_EXIT_USAGE;
+    }
+
+    vultra::cook::CookOptions options;
+    options.projectFile                 = parser.get<std::string>("project");
+    options.reportFile                  = parser.get<std::string>("--report");
+    options.importOptions.workerCount   = parser.get<uint32_t>("--workers");
+    options.importOptions.force         = parser.get<bool>("--force");
+    options.importOptions.reportSlowest = parser.get<uint32_t>("--slowest");
+
+    return vultra::cook::cookProject(options);
+}
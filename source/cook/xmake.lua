@@ -0,0 +1,26 @@
+add_requires("argparse")
+
+target("VultraCook")
+    -- set kind: binary
+    set_kind("binary")
+
+    -- add include dir
+    add_includedirs("include", {public = true}) -- public: let other targets to auto include
+
+    -- add header files
+    add_headerfiles("include/(vultra_cook/**.hpp)")
+
+    -- add source files
+    add_files("src/**.cpp")
+
+    -- add packages
+    add_packages("argparse", {public = true})
+
+    -- add deps
+    add_deps("VultraEngine")
+
+    -- set run arguments
+    set_runargs("$(projectdir)/example_project/ExampleProject.vproj")
+
+    -- set target directory
+    set_targetdir("$(builddir)/$(plat)/$(arch)/$(mode)/VultraCook")
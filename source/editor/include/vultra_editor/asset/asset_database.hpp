@@ -1,18 +1,46 @@
 #pragma once
 
+#include "vultra_editor/asset/asset_directory_tree.hpp"
+#include "vultra_editor/asset/asset_search_index.hpp"
+#include "vultra_editor/asset/asset_watcher.hpp"
+#include "vultra_editor/asset/thumbnail_cache.hpp"
+
 #include <vasset/vasset.hpp>
 #include <vultra/core/rhi/texture.hpp>
 #include <vultra/function/renderer/imgui_renderer.hpp>
+#include <vultra_engine/asset/asset_import_pipeline.hpp>
+#include <vultra_engine/asset/binary_asset_registry.hpp>
+#include <vultra_engine/core/job_system.hpp>
+#include <vultra_engine/core/memory_tracker.hpp>
 #include <vultra_engine/project/project.hpp>
 
 #include <nlohmann/json.hpp>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <thread>
 
 namespace vultra
 {
     namespace editor
     {
+        struct AssetMetaRecord
+        {
+            vasset::VUUID                   uuid {};
+            std::string                     extension;
+            vasset::VAssetType              type {};
+            std::filesystem::file_time_type mtime {};
+        };
+
         class AssetDatabase
         {
         public:
@@ -21,34 +49,170 @@ namespace vultra
 
             void initialize(const engine::Project& project, rhi::RenderDevice& rd);
 
+            // Per-frame housekeeping on the main thread: uploads textures whose read-ahead finished, applies
+            // invalidations from reimports and evicts cold textures above the budget.
+            void update();
+
             bool renameAsset(const vasset::VUUID& uuid,
                              const std::string&   oldName,
                              const std::string&   newName,
                              const std::string&   parentDir);
 
+            // Synchronous; safe to call from any thread. The import itself runs without holding the registry lock, so
+            // lookups never wait for it; false if the path is gone or the import failed.
             bool reimportAsset(const std::filesystem::path& assetPath);
             bool reimportFolder(const std::filesystem::path& folderPath);
 
+            // Background import queue, shared with the file watcher. Jobs run one at a time in submission order and the
+            // future becomes ready once the job has finished.
+            std::future<void> queueReimport(const std::filesystem::path& assetPath);
+            std::future<void> queueReimportFolder(const std::filesystem::path& folderPath);
+
             vasset::VAssetRegistry& getRegistry() { return m_AssetRegistry; }
-            vasset::VAssetImporter& getImporter() { return m_AssetImporter; }
+
+            // Writes the registry in vasset's JSON form, which is easier to diff than the binary file. Defaults to
+            // .imported/asset_registry_export.json, which is never read back.
+            bool exportRegistryJson(const std::filesystem::path& filePath = {});
+
+            // Thread safe, the import queue writes the registry in the background
+            auto lookupAsset(const vasset::VUUID& uuid)
+            {
+                std::lock_guard lock(m_RegistryMutex);
+                return m_AssetRegistry.lookup(uuid);
+            }
+
+            const engine::AssetImportReport& getLastImportReport() const { return m_LastImportReport; }
 
             std::filesystem::path getAssetRootDir() const
             {
                 return std::filesystem::path(m_Project.directory) / "Assets";
             }
 
+            // Snapshot of the asset folder for the Asset Browser, rebuilt in the background after
+            // invalidateDirectoryTree(). The generation increases whenever a new snapshot is swapped in. Main thread
+            // only.
+            std::shared_ptr<const AssetDirectoryTree> getDirectoryTree() const { return m_DirectoryTree; }
+
+            // Name index over the same snapshot, swapped in together with it
+            std::shared_ptr<const AssetSearchIndex> getSearchIndex() const { return m_SearchIndex; }
+
+            uint64_t getDirectoryTreeGeneration() const { return m_DirectoryTreeGeneration; }
+
+            // Increases whenever imported content a view may show changed: a reimport finished or a texture upload
+            // completed. Views that cache their image hash it with the scene state. Thread safe.
+            uint64_t getContentGeneration() const { return m_ContentGeneration.load(std::memory_order_relaxed); }
+
+            // Thread safe
+            void invalidateDirectoryTree() { m_DirectoryTreeDirty = true; }
+
+            // Textures are made resident on first request. Until the upload is done these return nullptr, which
+            // callers draw as a placeholder icon.
             Ref<rhi::Texture>     getTextureByUUID(const vasset::VUUID& uuid);
             imgui::ImGuiTextureID getImGuiTextureByUUID(const vasset::VUUID& uuid);
 
+            // Small preview for the Asset Browser grid, see ThumbnailCache. assetPath is the source or .vmeta path.
+            imgui::ImGuiTextureID getThumbnailByUUID(const vasset::VUUID& uuid, const std::filesystem::path& assetPath);
+
+            // The Textures (GPU) budget of engine::MemoryTracker, also editable from the Memory window. 0 = no limit.
+            void setTextureBudget(uint64_t bytes)
+            {
+                engine::MemoryTracker::setBudget(engine::MemoryTag::eGPUTextures, bytes);
+            }
+            uint64_t getTextureBudget() const
+            {
+                return engine::MemoryTracker::getBudget(engine::MemoryTag::eGPUTextures);
+            }
+            uint64_t getResidentTextureBytes() const { return m_ResidentTextureBytes; }
+
             static AssetDatabase* get();
             static void           destroy();
 
-            static vasset::VUUID getMetaUUID(const std::filesystem::path& assetPath);
-            static std::string   getMetaExtension(const std::filesystem::path& assetPath);
+            // .vmeta lookups are served from an in-memory index built at startup and refreshed by rename/reimport,
+            // so they are safe to call every frame. assetPath may be the source or the .vmeta path.
+            std::optional<AssetMetaRecord> getMeta(const std::filesystem::path& assetPath);
+            vasset::VUUID                  getMetaUUID(const std::filesystem::path& assetPath);
+            std::string                    getMetaExtension(const std::filesystem::path& assetPath);
+            vasset::VAssetType             getMetaAssetType(const std::filesystem::path& assetPath);
 
-        private:
+            // Re-read a single .vmeta (or drop it from the index if it no longer exists)
+            void refreshMeta(const std::filesystem::path& assetPath);
+
+            // Parses a .vmeta straight from disk, bypassing the index
             static nlohmann::json getMetaJson(const std::filesystem::path& assetPath);
 
+        private:
+            static std::string toMetaKey(const std::filesystem::path& assetPath);
+
+            // cached is the indexed record for the same file, reused if its mtime still matches
+            AssetMetaRecord readMetaRecord(const std::filesystem::path& metaPath,
+                                           const AssetMetaRecord*       cached = nullptr);
+            void            rebuildMetaIndex(const std::filesystem::path& folderPath);
+
+            engine::AssetRegistryMap getRegistrySnapshot();
+
+            // Both expect m_RegistryMutex to be held. The journal gets the current state of each entry, or a removal.
+            void writeRegistry();
+            void journalRegistryEntries(std::span<const vasset::VUUID> uuids);
+
+            enum class TextureResidencyState : uint8_t
+            {
+                eUnloaded = 0,
+                eQueued,
+                eReady,
+                eFailed
+            };
+
+            struct TextureResidency
+            {
+                TextureResidencyState state {TextureResidencyState::eUnloaded};
+                Ref<rhi::Texture>     texture {nullptr};
+                imgui::ImGuiTextureID imguiTexture {nullptr};
+                uint64_t              bytes {0};
+                uint64_t              lastUsedFrame {0};
+            };
+
+            struct RetiredTexture
+            {
+                Ref<rhi::Texture>     texture {nullptr};
+                imgui::ImGuiTextureID imguiTexture {nullptr};
+                uint64_t              retiredFrame {0};
+            };
+
+            struct TextureLoadRequest
+            {
+                std::string           uuidStr;
+                std::filesystem::path path;
+            };
+
+            // Filled on the loader thread; only the GPU upload is left for the main thread
+            struct DecodedTexture
+            {
+                TextureLoadRequest                        request;
+                std::unique_ptr<uint8_t, void (*)(void*)> pixels {nullptr, nullptr}; // RGBA8, null if not decoded
+                uint32_t                                  width {0};
+                uint32_t                                  height {0};
+                uint64_t                                  fileBytes {0};
+            };
+
+            TextureResidency& touchTexture(const vasset::VUUID& uuid);
+            void              requestTextureLoad(const std::string& uuidStr, TextureResidency& residency);
+            void              uploadReadyTextures();
+            void              applyTextureInvalidations();
+            void              evictColdTextures();
+            void              retireTexture(TextureResidency& residency);
+            void              destroyRetiredTextures(bool force);
+            void              invalidateTexture(const std::string& uuidStr);
+
+            void                                    updateDirectoryTree();
+            std::shared_ptr<const AssetSearchIndex> buildDirectorySnapshot();
+
+            std::future<void> submitImportJob(std::function<void()> job);
+            void              onAssetsChanged(std::vector<AssetChange> changes);
+            void              queueChangedAsset(const std::filesystem::path& assetPath);
+
+            void loaderThreadLoop();
+            void stopLoaderThread();
+
         private:
             struct AssetPaths
             {
@@ -56,19 +220,53 @@ namespace vultra
                 std::filesystem::path assetDir;
                 std::filesystem::path importedDir;
                 std::filesystem::path registryFile;
+                std::filesystem::path binaryRegistryFile;
             };
 
             rhi::RenderDevice* m_RenderDevice {nullptr};
 
-            vasset::VAssetRegistry m_AssetRegistry;
-            vasset::VAssetImporter m_AssetImporter;
-            engine::Project        m_Project;
-            AssetPaths             m_Paths;
+            vasset::VAssetRegistry      m_AssetRegistry;
+            engine::BinaryAssetRegistry m_BinaryRegistry; // Persisted form of m_AssetRegistry
+            std::mutex                  m_RegistryMutex;  // Guards both registries after initialize()
+            engine::Project             m_Project;
+            AssetPaths                  m_Paths;
+
+            // Normalized .vmeta path to record; records with a nil UUID cache "no meta file"
+            std::unordered_map<std::string, AssetMetaRecord> m_MetaIndex;
+            std::shared_mutex                                m_MetaIndexMutex;
+
+            std::unique_ptr<engine::AssetImportPipeline> m_ImportPipeline;
+            engine::AssetImportReport                    m_LastImportReport;
+
+            // Single worker, so queued imports never run concurrently
+            std::unique_ptr<engine::JobSystem> m_ImportQueue;
+            std::atomic<bool>                  m_ImportQueueCancelled {false};
+            AssetWatcher                       m_AssetWatcher;
+
+            // UUID string to texture residency, main thread only
+            std::unordered_map<std::string, TextureResidency> m_Textures;
+            std::vector<RetiredTexture>                       m_RetiredTextures;
+
+            ThumbnailCache m_ThumbnailCache;
+
+            std::shared_ptr<const AssetDirectoryTree>            m_DirectoryTree;
+            std::shared_ptr<const AssetSearchIndex>              m_SearchIndex;
+            std::future<std::shared_ptr<const AssetSearchIndex>> m_PendingDirectoryTree;
+            std::atomic<bool>                                    m_DirectoryTreeDirty {false};
+            uint64_t                                             m_DirectoryTreeGeneration {0};
+            std::atomic<uint64_t>                                m_ContentGeneration {0};
+
+            uint64_t m_FrameIndex {0};
+            uint64_t m_ResidentTextureBytes {0};
 
-            // UUID string to Texture
-            std::unordered_map<std::string, Ref<rhi::Texture>> m_Textures;
-            // UUID string to ImGuiTextureID
-            std::unordered_map<std::string, imgui::ImGuiTextureID> m_ImGuiTextures;
+            // Background loader, guarded by m_LoaderMutex
+            std::thread                     m_LoaderThread;
+            std::mutex                      m_LoaderMutex;
+            std::condition_variable         m_LoaderCondition;
+            std::deque<TextureLoadRequest>  m_LoadRequests;
+            std::vector<DecodedTexture>     m_ReadyForUpload;
+            std::vector<std::string>        m_PendingInvalidations;
+            bool                            m_StopLoader {false};
 
             static AssetDatabase* s_Instance;
         };
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vultra
+{
+    namespace editor
+    {
+        struct AssetDirectoryNode
+        {
+            static constexpr uint32_t INVALID_INDEX = ~0u;
+
+            std::filesystem::path path;
+            std::string           name; // Filename with extension
+            std::string           stem; // Filename without extension
+            bool                  isDirectory {false};
+            bool                  hasSubdirectories {false};
+            uint32_t              parent {INVALID_INDEX};
+            std::vector<uint32_t> children; // Directories first, then files, each sorted by name
+        };
+
+        // Immutable snapshot of the asset folder. Built once (off the main thread) and replaced as a whole when the
+        // folder changes, so UI code can walk it every frame without touching the filesystem.
+        class AssetDirectoryTree
+        {
+        public:
+            AssetDirectoryTree() = default;
+
+            void build(const std::filesystem::path& rootPath);
+
+            [[nodiscard]] bool empty() const { return m_Nodes.empty(); }
+
+            [[nodiscard]] const AssetDirectoryNode& getRoot() const { return m_Nodes.front(); }
+            [[nodiscard]] const AssetDirectoryNode& getNode(uint32_t index) const { return m_Nodes[index]; }
+            [[nodiscard]] const std::vector<AssetDirectoryNode>& getNodes() const { return m_Nodes; }
+            [[nodiscard]] uint32_t                               getNodeIndex(const AssetDirectoryNode& node) const
+            {
+                return static_cast<uint32_t>(&node - m_Nodes.data());
+            }
+
+            // nullptr if the path is not part of the snapshot
+            [[nodiscard]] const AssetDirectoryNode* find(const std::filesystem::path& path) const;
+
+        private:
+            uint32_t addNode(const std::filesystem::path& path, bool isDirectory, uint32_t parent);
+            void     scanDirectory(uint32_t dirIndex);
+
+        private:
+            std::vector<AssetDirectoryNode>           m_Nodes;
+            std::unordered_map<std::string, uint32_t> m_PathToIndex;
+        };
+    } // namespace editor
+} // namespace vultra
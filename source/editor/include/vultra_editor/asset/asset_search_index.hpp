@@ -0,0 +1,97 @@
+#pragma once
+
+#include "vultra_editor/asset/asset_directory_tree.hpp"
+
+#include <vasset/vasset.hpp>
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Parsed Asset Browser filter, e.g. "t:texture helmet". Every term has to match; the type is optional.
+        struct AssetSearchQuery
+        {
+            std::vector<std::string>          terms; // Lowercase
+            std::optional<vasset::VAssetType> type;
+            bool                              unknownType {false};
+
+            [[nodiscard]] bool empty() const { return terms.empty() && !type && !unknownType; }
+
+            static AssetSearchQuery parse(std::string_view text);
+        };
+
+        struct AssetSearchResult
+        {
+            uint32_t nodeIndex {AssetDirectoryNode::INVALID_INDEX}; // Into the indexed AssetDirectoryTree
+            int32_t  score {0};
+        };
+
+        // Name index over the imported assets (.vmeta files) of one AssetDirectoryTree snapshot. Built together with
+        // the snapshot off the main thread and immutable afterwards, so queries are lock free.
+        //
+        // Candidates come from trigram posting lists and are then ranked: exact > prefix > substring > subsequence >
+        // trigram similarity (which tolerates typos). Short terms and abbreviations that share no trigram with any
+        // name fall back to a linear scan, pruned by a per-entry character mask.
+        class AssetSearchIndex
+        {
+        public:
+            using TypeResolver = std::function<vasset::VAssetType(const std::filesystem::path&)>;
+
+            AssetSearchIndex() = default;
+
+            void build(std::shared_ptr<const AssetDirectoryTree> tree, const TypeResolver& resolveType);
+
+            [[nodiscard]] const std::shared_ptr<const AssetDirectoryTree>& getTree() const { return m_Tree; }
+            [[nodiscard]] size_t                                           size() const { return m_Entries.size(); }
+
+            // Best matches first, limited to assets below scopeNodeIndex
+            [[nodiscard]] std::vector<AssetSearchResult>
+            search(const AssetSearchQuery& query, uint32_t scopeNodeIndex, size_t maxResults = 1000) const;
+
+        private:
+            struct Entry
+            {
+                uint32_t           nodeIndex {0};
+                uint32_t           order {0}; // Pre-order position of the node, for scope tests
+                uint32_t           nameOffset {0};
+                uint32_t           nameLength {0};
+                uint64_t           charMask {0}; // Characters present in the name, rejects most entries in scans
+                vasset::VAssetType type {};
+            };
+
+            [[nodiscard]] std::string_view getName(const Entry& entry) const
+            {
+                return std::string_view(m_Names).substr(entry.nameOffset, entry.nameLength);
+            }
+
+            [[nodiscard]] bool matchesFilters(const Entry&            entry,
+                                              const AssetSearchQuery& query,
+                                              uint32_t                scopeBegin,
+                                              uint32_t                scopeEnd) const;
+
+            // < 0 if the entry does not match every term
+            [[nodiscard]] int32_t scoreEntry(const Entry& entry, const AssetSearchQuery& query, bool allowTypos) const;
+
+        private:
+            std::shared_ptr<const AssetDirectoryTree> m_Tree;
+
+            std::vector<Entry> m_Entries;
+            std::string        m_Names; // Lowercase names of all entries, back to back
+
+            // Pre-order range [begin, end) of every tree node
+            std::vector<uint32_t> m_NodeOrderBegin;
+            std::vector<uint32_t> m_NodeOrderEnd;
+
+            // Trigram to sorted entry indices
+            std::unordered_map<uint32_t, std::vector<uint32_t>> m_Trigrams;
+        };
+    } // namespace editor
+} // namespace vultra
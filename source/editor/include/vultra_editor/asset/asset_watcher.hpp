@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace vultra
+{
+    namespace editor
+    {
+        enum class AssetChangeType : uint8_t
+        {
+            eModified = 0, // Created, written or moved in
+            eRemoved,      // Deleted or moved out
+        };
+
+        struct AssetChange
+        {
+            std::filesystem::path path;
+            AssetChangeType       type {AssetChangeType::eModified};
+            bool                  isDirectory {false};
+        };
+
+        // Watches a folder tree on a background thread and reports changed paths once they have been quiet for a
+        // short while, so the burst of events a DCC tool produces when saving (temp file, write, rename) arrives as
+        // a single change.
+        //
+        // Linux uses inotify with one watch per directory; other platforms fall back to polling modification times.
+        class AssetWatcher
+        {
+        public:
+            using ChangeCallback = std::function<void(std::vector<AssetChange>)>;
+
+            AssetWatcher() = default;
+            ~AssetWatcher();
+
+            AssetWatcher(const AssetWatcher&)            = delete;
+            AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+            // The callback runs on the watcher thread
+            void start(const std::filesystem::path& rootDir, ChangeCallback callback);
+            void stop();
+
+            [[nodiscard]] bool isRunning() const { return m_Thread.joinable(); }
+
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            struct PendingChange
+            {
+                AssetChange       change;
+                Clock::time_point lastEvent;
+            };
+
+            void threadLoop();
+            void record(const std::filesystem::path& path, AssetChangeType type, bool isDirectory);
+            void flushQuietChanges();
+
+#ifdef __linux__
+            bool openInotify();
+            void closeInotify();
+            void addWatchRecursive(const std::filesystem::path& dirPath);
+            void readInotifyEvents();
+#endif
+            void pollChanges();
+
+        private:
+            std::filesystem::path m_RootDir;
+            ChangeCallback        m_Callback;
+            std::thread           m_Thread;
+            std::atomic<bool>     m_Stop {false};
+
+            // Watcher thread only
+            std::unordered_map<std::string, PendingChange> m_Pending;
+
+#ifdef __linux__
+            int                                            m_InotifyFd {-1};
+            std::unordered_map<int, std::filesystem::path> m_WatchDirs;
+#endif
+
+            // Polling fallback: file to (size, mtime) as of the previous scan
+            std::unordered_map<std::string, std::pair<uintmax_t, std::filesystem::file_time_type>> m_PollSnapshot;
+            Clock::time_point                                                                     m_LastPoll {};
+        };
+    } // namespace editor
+} // namespace vultra
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <vasset/vasset.hpp>
+#include <vultra/core/rhi/texture.hpp>
+#include <vultra/function/renderer/imgui_renderer.hpp>
+#include <vultra_engine/core/job_system.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Small, square previews of texture assets for the Asset Browser.
+        //
+        // Thumbnails are generated from the source image on worker threads and stored on disk as
+        // <cacheDir>/<uuid>_<contentHash>.png, so they survive restarts and are regenerated only when the source
+        // changes. Only the THUMBNAIL_SIZE^2 previews are ever uploaded, never the full-resolution textures.
+        class ThumbnailCache
+        {
+        public:
+            static constexpr uint32_t THUMBNAIL_SIZE = 128;
+
+            ThumbnailCache() = default;
+            ~ThumbnailCache();
+
+            void initialize(const std::filesystem::path& cacheDir, rhi::RenderDevice& rd);
+            void shutdown();
+
+            // Main thread, once per frame
+            void update();
+
+            // Returns false if the thumbnail was never requested (or got evicted). Otherwise outTexture is set, to
+            // nullptr while the thumbnail is still being generated or uploaded.
+            bool tryGet(const vasset::VUUID& uuid, imgui::ImGuiTextureID& outTexture);
+
+            // contentHash may be 0 if unknown; it is then computed from the source file on the worker.
+            void request(const vasset::VUUID& uuid, const std::filesystem::path& sourcePath, uint64_t contentHash);
+
+            void invalidate(const vasset::VUUID& uuid);
+
+            [[nodiscard]] size_t getResidentCount() const { return m_Thumbnails.size(); }
+
+        private:
+            enum class ThumbnailState : uint8_t
+            {
+                ePending = 0,
+                eReady,
+                eFailed
+            };
+
+            struct Thumbnail
+            {
+                ThumbnailState        state {ThumbnailState::ePending};
+                Ref<rhi::Texture>     texture {nullptr};
+                imgui::ImGuiTextureID imguiTexture {nullptr};
+                uint64_t              lastUsedFrame {0};
+            };
+
+            struct RetiredThumbnail
+            {
+                Ref<rhi::Texture>     texture {nullptr};
+                imgui::ImGuiTextureID imguiTexture {nullptr};
+                uint64_t              retiredFrame {0};
+            };
+
+            struct GeneratedThumbnail
+            {
+                std::string           uuidStr;
+                std::filesystem::path path; // Empty on failure
+            };
+
+            static bool generate(const std::filesystem::path& sourcePath, const std::filesystem::path& outputPath);
+
+            void retire(Thumbnail& thumbnail);
+            void evictUnused();
+
+        private:
+            rhi::RenderDevice*    m_RenderDevice {nullptr};
+            std::filesystem::path m_CacheDir;
+
+            std::unique_ptr<engine::JobSystem> m_Workers;
+            std::atomic<bool>                  m_Cancelled {false};
+
+            // Main thread only
+            std::unordered_map<std::string, Thumbnail> m_Thumbnails;
+            std::vector<RetiredThumbnail>              m_Retired;
+            uint64_t                                   m_FrameIndex {0};
+
+            // UUID string to the thumbnail file last generated for it; main thread only
+            std::unordered_map<std::string, std::filesystem::path> m_OwnedFiles;
+
+            std::mutex                      m_GeneratedMutex;
+            std::vector<GeneratedThumbnail> m_Generated;
+        };
+    } // namespace editor
+} // namespace vultra
@@ -6,6 +6,7 @@
 #include <vultra/function/renderer/builtin/builtin_renderer.hpp>
 #include <vultra/function/scenegraph/logic_scene.hpp>
 #include <vultra_engine/project/project.hpp>
+#include <vultra_engine/scene/scene_file.hpp>
 
 #include <argparse/argparse.hpp>
 
@@ -32,6 +33,11 @@ namespace vultra
 
         private:
             void buildDockSpace(ImGuiDockNodeFlags);
+            void handleShortcuts();
+            void updateSceneLoading();
+            void saveScene();
+            void startTraceCapture();
+            void stopTraceCapture();
             void drawMainMenuBar();
 
         private:
@@ -42,6 +48,11 @@ namespace vultra
             engine::Project m_CurrentProject {};
             Ref<LogicScene> m_EditingScene {nullptr};
 
+            std::filesystem::path m_ScenePath; // Where Save Scene writes to
+            engine::SceneLoader   m_SceneLoader;
+
+            std::filesystem::path m_TracePath; // From --trace; empty means a timestamped file under Traces/
+
             gfx::BuiltinRenderer m_Renderer;
 
             bool m_ShowAboutPopup {false};
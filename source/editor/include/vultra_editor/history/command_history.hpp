@@ -0,0 +1,67 @@
+#pragma once
+
+#include "vultra_editor/history/editor_command.hpp"
+
+#include <deque>
+#include <memory>
+#include <string_view>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Undo / redo stack for edits of the open scene.
+        //
+        // Commands are pushed after the edit was made (push) or made by the history (execute). A push from the same
+        // merge source as the newest entry is merged into it until that source calls seal(), so a continuous gizmo
+        // drag or slider edit becomes one entry. The history holds at most getByteBudget() bytes of commands and
+        // drops the oldest ones beyond that.
+        class CommandHistory
+        {
+        public:
+            static constexpr size_t DEFAULT_BYTE_BUDGET = 64ull * 1024 * 1024;
+
+            // Drops the history when the scene changes
+            static void        setScene(LogicScene* scene);
+            static LogicScene* getScene() { return s_Scene; }
+
+            static void push(std::unique_ptr<EditorCommand> command, const void* mergeSource = nullptr);
+            static void execute(std::unique_ptr<EditorCommand> command, const void* mergeSource = nullptr);
+            // Ends the current continuous edit of mergeSource
+            static void seal(const void* mergeSource);
+
+            static bool undo();
+            static bool redo();
+            static void clear();
+
+            [[nodiscard]] static bool canUndo() { return !s_UndoStack.empty(); }
+            [[nodiscard]] static bool canRedo() { return !s_RedoStack.empty(); }
+
+            [[nodiscard]] static std::string_view getUndoName();
+            [[nodiscard]] static std::string_view getRedoName();
+
+            static void                 setByteBudget(size_t bytes);
+            [[nodiscard]] static size_t getByteBudget() { return s_ByteBudget; }
+            [[nodiscard]] static size_t getByteSize() { return s_ByteSize; }
+
+        private:
+            struct Entry
+            {
+                std::unique_ptr<EditorCommand> command;
+                const void*                    mergeSource {nullptr};
+                size_t                         byteSize {0};
+                bool                           isSealed {false};
+            };
+
+            static void clearRedo();
+            static void enforceBudget();
+
+        private:
+            inline static LogicScene*       s_Scene {nullptr};
+            inline static std::deque<Entry> s_UndoStack;
+            inline static std::deque<Entry> s_RedoStack;
+            inline static size_t            s_ByteSize {0};
+            inline static size_t            s_ByteBudget {DEFAULT_BYTE_BUDGET};
+        };
+    } // namespace editor
+} // namespace vultra
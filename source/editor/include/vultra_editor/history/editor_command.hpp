@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace vultra
+{
+    class LogicScene;
+
+    namespace editor
+    {
+        // One undoable edit, stored as the delta it made rather than as a copy of what it touched
+        class EditorCommand
+        {
+        public:
+            virtual ~EditorCommand() = default;
+
+            virtual void undo(LogicScene& scene) = 0;
+            virtual void redo(LogicScene& scene) = 0;
+
+            // Called when the command leaves the history for good. isApplied tells whether its effect is in the scene,
+            // e.g. a deletion that was not undone can now destroy the entities it kept around for undo.
+            virtual void discard(LogicScene& /*scene*/, bool /*isApplied*/) {}
+
+            // Folds a later command of the same continuous edit (e.g. the next frame of a gizmo drag) into this one
+            virtual bool merge(const EditorCommand& /*next*/) { return false; }
+
+            // Approximate heap and object size, for the history's byte budget
+            [[nodiscard]] virtual size_t           getByteSize() const = 0;
+            [[nodiscard]] virtual std::string_view getName() const     = 0;
+        };
+    } // namespace editor
+} // namespace vultra
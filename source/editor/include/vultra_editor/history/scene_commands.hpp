@@ -0,0 +1,116 @@
+#pragma once
+
+#include "vultra_editor/history/editor_command.hpp"
+
+#include <vultra/function/scenegraph/components.hpp>
+#include <vultra/function/scenegraph/entity.hpp>
+
+#include <string>
+#include <vector>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Entities are referenced by CoreUUID, so commands stay valid however the entt handles are reused
+
+        class TransformCommand final : public EditorCommand
+        {
+        public:
+            struct Delta
+            {
+                CoreUUID           entity;
+                TransformComponent before;
+                TransformComponent after;
+            };
+
+            explicit TransformCommand(std::vector<Delta> deltas) : m_Deltas(std::move(deltas)) {}
+
+            void undo(LogicScene& scene) override;
+            void redo(LogicScene& scene) override;
+
+            // Keeps the first before and takes the latest after, as long as the same entities are edited
+            bool merge(const EditorCommand& next) override;
+
+            [[nodiscard]] size_t           getByteSize() const override;
+            [[nodiscard]] std::string_view getName() const override { return "Transform"; }
+
+        private:
+            std::vector<Delta> m_Deltas;
+        };
+
+        class ReparentCommand final : public EditorCommand
+        {
+        public:
+            // The current parent is looked up in the scene; a nil newParent moves the entity to the root
+            ReparentCommand(LogicScene& scene, const CoreUUID& entity, const CoreUUID& newParent);
+
+            void undo(LogicScene& scene) override;
+            void redo(LogicScene& scene) override;
+
+            [[nodiscard]] size_t           getByteSize() const override { return sizeof(*this); }
+            [[nodiscard]] std::string_view getName() const override { return "Reparent"; }
+
+        private:
+            CoreUUID m_Entity;
+            CoreUUID m_OldParent;
+            CoreUUID m_NewParent;
+        };
+
+        class RenameCommand final : public EditorCommand
+        {
+        public:
+            RenameCommand(const CoreUUID& entity, std::string oldName, std::string newName) :
+                m_Entity(entity), m_OldName(std::move(oldName)), m_NewName(std::move(newName))
+            {}
+
+            void undo(LogicScene& scene) override;
+            void redo(LogicScene& scene) override;
+
+            [[nodiscard]] size_t           getByteSize() const override;
+            [[nodiscard]] std::string_view getName() const override { return "Rename"; }
+
+        private:
+            CoreUUID    m_Entity;
+            std::string m_OldName;
+            std::string m_NewName;
+        };
+
+        // Pushed after the entity was created. Undo only hides it, it is destroyed once the command is discarded
+        // without being redone.
+        class CreateEntityCommand final : public EditorCommand
+        {
+        public:
+            explicit CreateEntityCommand(const CoreUUID& entity) : m_Entity(entity) {}
+
+            void undo(LogicScene& scene) override;
+            void redo(LogicScene& scene) override;
+            void discard(LogicScene& scene, bool isApplied) override;
+
+            [[nodiscard]] size_t           getByteSize() const override { return sizeof(*this); }
+            [[nodiscard]] std::string_view getName() const override { return "Create Entity"; }
+
+        private:
+            CoreUUID m_Entity;
+        };
+
+        // Executed by the history. Deleted entities are hidden rather than destroyed, so undo gives back every
+        // component, including those the editor knows nothing about; they are destroyed once the command is discarded
+        // while applied.
+        class DeleteEntitiesCommand final : public EditorCommand
+        {
+        public:
+            explicit DeleteEntitiesCommand(std::vector<CoreUUID> entities) : m_Entities(std::move(entities)) {}
+
+            void undo(LogicScene& scene) override;
+            void redo(LogicScene& scene) override;
+            void discard(LogicScene& scene, bool isApplied) override;
+
+            [[nodiscard]] size_t           getByteSize() const override;
+            [[nodiscard]] std::string_view getName() const override { return "Delete Entities"; }
+
+        private:
+            std::vector<CoreUUID> m_Entities;
+        };
+    } // namespace editor
+} // namespace vultra
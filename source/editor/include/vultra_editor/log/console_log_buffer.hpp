@@ -0,0 +1,104 @@
+#pragma once
+
+#include <vultra/core/base/common_context.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Log history behind the Console.
+        //
+        // Any thread may push(): messages go into a bounded lock-free ring (Vyukov's MPMC queue, used with a single
+        // consumer), so logging never takes a lock and never waits for the UI. When the ring is full the message is
+        // dropped and counted instead of blocking the producer.
+        //
+        // The owning thread calls drain() once per frame to move pending messages into the history. History text is
+        // interned into a chunked arena, one allocation per 64 KiB instead of one per message, and the oldest entries
+        // (and their chunks) are released once the history exceeds its capacity.
+        class ConsoleLogBuffer
+        {
+        public:
+            struct Entry
+            {
+                const char*   text {nullptr}; // Null terminated, owned by the arena
+                uint32_t      length {0};
+                Logger::Level level {Logger::Level::eInfo};
+            };
+
+            explicit ConsoleLogBuffer(size_t ringCapacity = 4096, size_t maxHistory = 100000);
+            ~ConsoleLogBuffer();
+
+            ConsoleLogBuffer(const ConsoleLogBuffer&)            = delete;
+            ConsoleLogBuffer& operator=(const ConsoleLogBuffer&) = delete;
+
+            // Thread safe. False if the ring was full and the message was dropped.
+            bool push(Logger::Level level, std::string_view message);
+
+            // Owner thread only. Returns the number of entries appended to the history.
+            size_t drain();
+
+            void clear();
+
+            // History access, owner thread only. Indices are relative to the oldest retained entry.
+            [[nodiscard]] size_t       size() const { return m_History.size(); }
+            [[nodiscard]] bool         empty() const { return m_History.empty(); }
+            [[nodiscard]] const Entry& operator[](size_t index) const { return m_History[index]; }
+
+            // Sequence number of the oldest retained entry; it grows as old entries are released, so
+            // sequence = getFirstSequence() + index stays valid across drains
+            [[nodiscard]] uint64_t getFirstSequence() const { return m_FirstSequence; }
+            [[nodiscard]] uint64_t getEndSequence() const { return m_FirstSequence + m_History.size(); }
+
+            [[nodiscard]] uint64_t getDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+        private:
+            // 256 bytes per cell; longer messages spill into a heap string
+            static constexpr size_t INLINE_MESSAGE_SIZE = 208;
+            static constexpr size_t ARENA_CHUNK_SIZE    = 64 * 1024;
+
+            struct alignas(64) Cell
+            {
+                std::atomic<uint64_t> sequence {0};
+                Logger::Level         level {Logger::Level::eInfo};
+                uint32_t              length {0};
+                char                  inlineText[INLINE_MESSAGE_SIZE];
+                std::string           overflowText;
+            };
+
+            struct ArenaChunk
+            {
+                std::unique_ptr<char[]> data;
+                size_t                  capacity {0};
+                size_t                  used {0};
+                uint64_t                lastSequence {0}; // Newest entry stored in this chunk
+            };
+
+            void        append(Logger::Level level, std::string_view message);
+            const char* intern(std::string_view message);
+            void        releaseOldest();
+
+        private:
+            // Ring, shared with producers
+            std::unique_ptr<Cell[]> m_Cells;
+            size_t                  m_Mask {0};
+
+            alignas(64) std::atomic<uint64_t> m_EnqueuePos {0};
+            alignas(64) uint64_t m_DequeuePos {0}; // Consumer only
+            std::atomic<uint64_t> m_Dropped {0};
+            uint64_t              m_ReportedDropped {0};
+
+            // History, owner thread only
+            std::deque<Entry>      m_History;
+            std::deque<ArenaChunk> m_Arena;
+            size_t                 m_MaxHistory {0};
+            uint64_t               m_FirstSequence {0};
+        };
+    } // namespace editor
+} // namespace vultra
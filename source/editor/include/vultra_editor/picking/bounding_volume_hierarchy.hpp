@@ -0,0 +1,126 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cfloat>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace vultra
+{
+    namespace editor
+    {
+        struct BoundingBox
+        {
+            glm::vec3 min {FLT_MAX};
+            glm::vec3 max {-FLT_MAX};
+
+            [[nodiscard]] bool      isValid() const { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+            [[nodiscard]] glm::vec3 getCenter() const { return (min + max) * 0.5f; }
+            [[nodiscard]] glm::vec3 getExtent() const { return max - min; }
+
+            [[nodiscard]] float getSurfaceArea() const
+            {
+                const auto e = glm::max(max - min, glm::vec3(0.0f));
+                return 2.0f * (e.x * e.y + e.y * e.z + e.z * e.x);
+            }
+
+            void expand(const glm::vec3& point)
+            {
+                min = glm::min(min, point);
+                max = glm::max(max, point);
+            }
+
+            void expand(const BoundingBox& other)
+            {
+                min = glm::min(min, other.min);
+                max = glm::max(max, other.max);
+            }
+
+            bool operator==(const BoundingBox&) const = default;
+
+            // World-space box enclosing this box under an affine transform
+            [[nodiscard]] BoundingBox transform(const glm::mat4& matrix) const;
+        };
+
+        struct PickingRay
+        {
+            glm::vec3 origin {0.0f};
+            glm::vec3 direction {0.0f, 0.0f, -1.0f}; // Normalized
+        };
+
+        class PackedFrustum;
+
+        // Slab test; distance along the ray to the box entry (0 if the origin is inside), nullopt on a miss
+        std::optional<float> intersectRayBox(const PickingRay& ray, const BoundingBox& box);
+
+        // Bounding volume hierarchy over item AABBs, for picking and spatial queries in the editor.
+        //
+        // build() uses a binned SAH split with up to MAX_LEAF_SIZE items per leaf. Moving an item does not require a
+        // rebuild: updateItem() refits the leaf and its ancestors, stopping as soon as a node's bounds do not change.
+        // Quality degrades when items move far from where they were at build time, so rebuild after larger edits.
+        class BoundingVolumeHierarchy
+        {
+        public:
+            static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+            static constexpr uint32_t MAX_LEAF_SIZE = 4;
+
+            struct Node
+            {
+                BoundingBox bounds;
+                uint32_t    first {0};   // Leaf: first slot in the item list; inner: left child (right = first + 1)
+                uint32_t    count {0};   // Items in a leaf, 0 for inner nodes
+                uint32_t    parent {INVALID_INDEX};
+
+                [[nodiscard]] bool isLeaf() const { return count > 0; }
+            };
+
+            struct RayHit
+            {
+                uint32_t item {INVALID_INDEX};
+                float    distance {FLT_MAX};
+            };
+
+            // Optional exact test for an item whose AABB the ray hit (e.g. an oriented box or triangles)
+            using ItemIntersector = std::function<std::optional<float>(uint32_t item, const PickingRay& ray)>;
+
+            // Items are identified by their index into itemBounds
+            void build(std::span<const BoundingBox> itemBounds);
+            void clear();
+
+            void updateItem(uint32_t item, const BoundingBox& bounds);
+
+            [[nodiscard]] bool                     empty() const { return m_Nodes.empty(); }
+            [[nodiscard]] size_t                   getItemCount() const { return m_ItemBounds.size(); }
+            [[nodiscard]] const BoundingBox&       getItemBounds(uint32_t item) const { return m_ItemBounds[item]; }
+            [[nodiscard]] const std::vector<Node>& getNodes() const { return m_Nodes; }
+            [[nodiscard]] std::span<const uint32_t> getLeafItems(const Node& node) const
+            {
+                return std::span<const uint32_t>(m_ItemIndices).subspan(node.first, node.count);
+            }
+
+            // Nearest hit; nodes are visited front to back and skipped once they start behind the best hit
+            [[nodiscard]] std::optional<RayHit> raycast(const PickingRay&      ray,
+                                                        float                  maxDistance = FLT_MAX,
+                                                        const ItemIntersector& intersector = {}) const;
+
+            // Appends every item whose bounds intersect the frustum. Subtrees fully inside it are taken without
+            // testing their items.
+            void queryFrustum(const PackedFrustum& frustum, std::vector<uint32_t>& outItems) const;
+
+        private:
+            void buildNode(uint32_t nodeIndex, const std::vector<glm::vec3>& centroids, uint32_t depth);
+            void makeLeaf(uint32_t nodeIndex);
+            void refitLeaf(uint32_t nodeIndex);
+
+        private:
+            std::vector<Node>        m_Nodes;
+            std::vector<uint32_t>    m_ItemIndices; // Items grouped by leaf
+            std::vector<BoundingBox> m_ItemBounds;
+            std::vector<uint32_t>    m_ItemLeaf; // Item to the leaf holding it
+        };
+    } // namespace editor
+} // namespace vultra
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "vultra_editor/picking/bounding_volume_hierarchy.hpp"
+
+#include <array>
+
+namespace vultra
+{
+    namespace editor
+    {
+        enum class Containment
+        {
+            eOutside = 0,
+            eIntersecting,
+            eInside,
+        };
+
+        // Convex volume bounded by planes; a point p is inside when dot(plane.xyz, p) + plane.w >= 0 for every plane
+        struct PickingFrustum
+        {
+            static constexpr uint32_t MAX_PLANES = 8;
+
+            std::array<glm::vec4, MAX_PLANES> planes {};
+            uint32_t                          planeCount {0};
+
+            void addPlane(const glm::vec3& normal, const glm::vec3& point);
+
+            // Volume between four rays leaving a shared origin, given in winding order around their center. The far
+            // side is left open, so everything in front of the origin within the rays is inside.
+            static PickingFrustum fromCornerRays(const glm::vec3& origin, const std::array<glm::vec3, 4>& directions);
+        };
+
+        // Frustum planes in structure-of-arrays form, so a box is tested against four planes per SSE instruction.
+        // Unused plane slots always pass. Boxes are tested conservatively: a box near a frustum corner may be
+        // reported as intersecting while lying just outside.
+        class PackedFrustum
+        {
+        public:
+            explicit PackedFrustum(const PickingFrustum& frustum);
+
+            [[nodiscard]] Containment classify(const BoundingBox& box) const;
+            [[nodiscard]] bool        intersects(const BoundingBox& box) const;
+
+        private:
+            alignas(16) std::array<float, PickingFrustum::MAX_PLANES> m_NormalX {};
+            alignas(16) std::array<float, PickingFrustum::MAX_PLANES> m_NormalY {};
+            alignas(16) std::array<float, PickingFrustum::MAX_PLANES> m_NormalZ {};
+            alignas(16) std::array<float, PickingFrustum::MAX_PLANES> m_AbsNormalX {};
+            alignas(16) std::array<float, PickingFrustum::MAX_PLANES> m_AbsNormalY {};
+            alignas(16) std::array<float, PickingFrustum::MAX_PLANES> m_AbsNormalZ {};
+            alignas(16) std::array<float, PickingFrustum::MAX_PLANES> m_Distance {};
+        };
+    } // namespace editor
+} // namespace vultra
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "vultra_editor/picking/bounding_volume_hierarchy.hpp"
+#include "vultra_editor/picking/picking_frustum.hpp"
+
+#include <vultra/function/scenegraph/entity.hpp>
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace vultra
+{
+    class LogicScene;
+
+    namespace editor
+    {
+        struct ScenePickResult
+        {
+            Entity      entity;
+            float       distance {0.0f};
+            BoundingBox bounds; // World space
+        };
+
+        // CPU picking for the Scene View: a BVH over the world bounds of every pickable entity, so clicks and hover
+        // are answered without a GPU readback.
+        //
+        // update() keeps the BVH in sync with the scene using SceneChangeTracker: a hierarchy change rebuilds it, a
+        // transform change refits the entities whose transform actually moved. Hits on an AABB are confirmed against
+        // the entity's oriented box, so rotated entities are not picked through their empty corners.
+        //
+        // Entities with a mesh are picked by its local bounds (engine::getEntityLocalBounds); lights, cameras and empty
+        // entities get a unit cube around their origin so they can still be clicked. Mesh bounds are kept per entity
+        // across rebuilds and only recomputed when the entity's mesh changes, so a rebuild does not rescan vertices.
+        class ScenePicker
+        {
+        public:
+            void update(LogicScene* scene);
+            void invalidate() { m_Scene = nullptr; }
+
+            [[nodiscard]] std::optional<ScenePickResult> pick(const PickingRay& ray) const;
+            // Every pickable entity whose bounds intersect the frustum
+            [[nodiscard]] std::vector<Entity> pickAll(const PickingFrustum& frustum) const;
+
+            [[nodiscard]] const BoundingVolumeHierarchy& getBVH() const { return m_BVH; }
+            [[nodiscard]] Entity                         getEntity(uint32_t item) const { return m_Items[item].entity; }
+
+            // Ray through a point given in normalized device coordinates (x right, y up, both in [-1, 1])
+            static PickingRay makeRay(const glm::mat4& view, const glm::mat4& projection, const glm::vec2& ndc);
+            // Sub-frustum of the camera through a rectangle given in normalized device coordinates. The rectangle must
+            // have a non-zero area, a degenerate side drops its plane and leaves that side of the frustum open.
+            static PickingFrustum makeFrustum(const glm::mat4& view,
+                                              const glm::mat4& projection,
+                                              const glm::vec2& ndcMin,
+                                              const glm::vec2& ndcMax);
+
+        private:
+            struct PickItem
+            {
+                Entity      entity;
+                glm::mat4   transform {1.0f};
+                BoundingBox localBounds;
+            };
+
+            struct CachedBounds
+            {
+                const void* mesh {nullptr};
+                size_t      vertexCount {0};
+                BoundingBox bounds;
+            };
+            using BoundsCache = std::unordered_map<CoreUUID, CachedBounds>;
+
+            void rebuild();
+            void refit();
+
+            BoundingBox resolveLocalBounds(Entity& entity, const BoundsCache& previous);
+
+            [[nodiscard]] bool                 isPickable(const PickItem& item) const;
+            [[nodiscard]] std::optional<float> intersectItem(uint32_t item, const PickingRay& ray) const;
+
+        private:
+            LogicScene* m_Scene {nullptr};
+            uint64_t    m_HierarchyGeneration {0};
+            uint64_t    m_TransformGeneration {0};
+
+            std::vector<PickItem>   m_Items;
+            BoundingVolumeHierarchy m_BVH;
+            BoundsCache             m_BoundsCache; // Mesh bounds of the entities in m_Items
+        };
+    } // namespace editor
+} // namespace vultra
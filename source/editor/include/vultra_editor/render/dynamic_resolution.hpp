@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Picks an internal render scale that holds a frame-time budget.
+        //
+        // Frame times are smoothed, and the scale is reconsidered every ADJUST_INTERVAL_FRAMES rendered frames. It
+        // drops as far as needed at once, since rendered pixels scale with its square, but recovers one step at a
+        // time so it does not oscillate around the budget. Scales are quantized to SCALE_STEP, so the render target
+        // only takes a few distinct sizes.
+        //
+        // Feed it the time the view's own rendering takes, not the whole editor frame, or vsync waits and other
+        // views count against the budget. The Game View feeds it the CPU time spent recording the view, as the RHI
+        // offers no GPU timestamp queries; a GPU-bound view is only scaled down as far as that time reflects it.
+        class DynamicResolutionController
+        {
+        public:
+            static constexpr float    MIN_SCALE              = 0.25f;
+            static constexpr float    MAX_SCALE              = 1.0f;
+            static constexpr float    SCALE_STEP             = 1.0f / 16.0f;
+            static constexpr uint32_t ADJUST_INTERVAL_FRAMES = 15;
+
+            void  setTargetFrameTime(float milliseconds);
+            float getTargetFrameTime() const { return m_TargetFrameTime; }
+
+            // Once per rendered frame
+            void addFrameTime(float milliseconds);
+            // Returns true when the scale changed
+            bool update();
+            void reset();
+
+            [[nodiscard]] float getScale() const { return m_Scale; }
+            [[nodiscard]] float getAverageFrameTime() const { return m_AverageFrameTime; }
+
+        private:
+            float    m_TargetFrameTime {1000.0f / 60.0f};
+            float    m_Scale {MAX_SCALE};
+            float    m_AverageFrameTime {0.0f};
+            uint32_t m_SampleCount {0};
+        };
+    } // namespace editor
+} // namespace vultra
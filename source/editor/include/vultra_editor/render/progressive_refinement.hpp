@@ -0,0 +1,36 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Render scale of a viewport that trades quality for responsiveness while its camera moves.
+        //
+        // During navigation the view renders at the first of REFINEMENT_SCALES. Once the camera has been still for
+        // IDLE_FRAMES_BEFORE_REFINE frames, the scale climbs one stage per frame back to full resolution, where the
+        // render scheduler's settle frames let temporal effects converge on the still image.
+        class ProgressiveRefinement
+        {
+        public:
+            static constexpr std::array<float, 3> REFINEMENT_SCALES         = {0.5f, 0.75f, 1.0f};
+            static constexpr uint32_t             IDLE_FRAMES_BEFORE_REFINE = 3;
+
+            // Once per frame
+            void update(bool isNavigating);
+
+            void               setEnabled(bool enabled);
+            [[nodiscard]] bool isEnabled() const { return m_IsEnabled; }
+
+            [[nodiscard]] float getScale() const { return m_IsEnabled ? REFINEMENT_SCALES[m_Stage] : 1.0f; }
+            [[nodiscard]] bool  isRefined() const { return getScale() == 1.0f; }
+
+        private:
+            bool     m_IsEnabled {true};
+            uint32_t m_Stage {static_cast<uint32_t>(REFINEMENT_SCALES.size() - 1)};
+            uint32_t m_IdleFrames {0};
+        };
+    } // namespace editor
+} // namespace vultra
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <vultra/core/rhi/texture.hpp>
+#include <vultra/function/renderer/imgui_renderer.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // A color render target that can also be shown with ImGui::Image
+        struct PooledRenderTarget
+        {
+            Ref<rhi::Texture>     texture {nullptr};
+            imgui::ImGuiTextureID imguiTexture {nullptr};
+
+            [[nodiscard]] explicit operator bool() const { return texture != nullptr; }
+            [[nodiscard]] uint32_t getWidth() const { return texture ? texture->getExtent().width : 0; }
+            [[nodiscard]] uint32_t getHeight() const { return texture ? texture->getExtent().height : 0; }
+        };
+
+        // Reuses viewport render targets instead of building a texture and an ImGui descriptor for every size a view
+        // passes through. Released targets stay in the pool for a while and are handed out again for requests that
+        // fit them; they are destroyed once unused for POOL_IDLE_FRAMES, which is well past the frames in flight
+        // that may still sample them.
+        class RenderTargetPool
+        {
+        public:
+            // Over-allocated requests round up to multiples of this, so a growing view does not reallocate each frame
+            static constexpr uint32_t SIZE_CLASS_STEP  = 128;
+            static constexpr uint64_t POOL_IDLE_FRAMES = 120;
+
+            RenderTargetPool() = default;
+            ~RenderTargetPool();
+
+            RenderTargetPool(const RenderTargetPool&)            = delete;
+            RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+            void initialize(rhi::RenderDevice& rd);
+            void shutdown();
+
+            // Once per frame
+            void update();
+
+            // Exact size
+            PooledRenderTarget acquire(uint32_t width, uint32_t height);
+            // Any target at least this large, rounded up to the size class; reuses a free one that is not much larger
+            PooledRenderTarget acquireAtLeast(uint32_t width, uint32_t height);
+
+            // The target may still be referenced by this frame's draw data, so it is only destroyed much later
+            void release(PooledRenderTarget target);
+
+            [[nodiscard]] size_t getFreeCount() const { return m_Free.size(); }
+
+        private:
+            struct FreeTarget
+            {
+                PooledRenderTarget target;
+                uint64_t           releasedFrame {0};
+            };
+
+            PooledRenderTarget create(uint32_t width, uint32_t height);
+            void               destroy(PooledRenderTarget& target);
+
+        private:
+            rhi::RenderDevice*      m_RenderDevice {nullptr};
+            std::vector<FreeTarget> m_Free;
+            uint64_t                m_FrameIndex {0};
+        };
+    } // namespace editor
+} // namespace vultra
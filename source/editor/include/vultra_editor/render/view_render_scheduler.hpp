@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vultra/function/scenegraph/entity.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace vultra
+{
+    class LogicScene;
+
+    namespace editor
+    {
+        // Decides whether a viewport renders this frame. A view that is not visible (e.g. its dock tab is behind
+        // another one) never renders; a visible view renders when its scene state, camera or size changed, and
+        // otherwise keeps showing the image it rendered last.
+        //
+        // A few frames keep rendering after the last change, so temporal effects converge before the view idles.
+        class ViewRenderScheduler
+        {
+        public:
+            static constexpr uint32_t SETTLE_FRAME_COUNT = 8;
+
+            struct ViewState
+            {
+                LogicScene* scene {nullptr};
+                uint64_t    sceneHash {0};
+                uint64_t    cameraHash {0};
+                uint32_t    width {0};
+                uint32_t    height {0};
+
+                bool operator==(const ViewState&) const = default;
+            };
+
+            // Once per frame, before the view emits anything that is only consumed by rendering
+            bool update(bool isVisible, const ViewState& state);
+
+            [[nodiscard]] bool shouldRender() const { return m_ShouldRender; }
+
+            // Forces the next visible frame to render, e.g. after the render target was recreated
+            void invalidate() { m_HasRendered = false; }
+
+            void               setAlwaysRender(bool alwaysRender) { m_AlwaysRender = alwaysRender; }
+            [[nodiscard]] bool isAlwaysRender() const { return m_AlwaysRender; }
+
+            [[nodiscard]] uint64_t getSkippedFrameCount() const { return m_SkippedFrameCount; }
+
+            // Hashes of what the image depends on. The camera hash covers the view and projection matrices.
+            static uint64_t hashCamera(Entity& camera);
+            // Walks every entity and hashes its world transform and flags. Needed where the scene changes without
+            // going through the editor, i.e. while it is simulated; edits made in the editor are cheaper to follow
+            // through SceneChangeTracker.
+            static uint64_t hashSceneTransforms(LogicScene& scene);
+
+        private:
+            ViewState m_LastState;
+            bool      m_HasRendered {false};
+            bool      m_ShouldRender {false};
+            bool      m_AlwaysRender {false};
+            uint32_t  m_SettleFramesLeft {0};
+            uint64_t  m_SkippedFrameCount {0};
+        };
+
+        // 64-bit FNV-1a over whole words; only has to tell frames apart, not resist collisions
+        class FrameStateHasher
+        {
+        public:
+            template<typename T>
+            FrameStateHasher& add(const T& value)
+            {
+                static_assert(std::is_trivially_copyable_v<T>);
+                addBytes(&value, sizeof(T));
+                return *this;
+            }
+
+            void addBytes(const void* data, size_t size);
+
+            [[nodiscard]] uint64_t get() const { return m_Hash; }
+
+        private:
+            uint64_t m_Hash {14695981039346656037ull};
+        };
+    } // namespace editor
+} // namespace vultra
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "vultra_editor/render/render_target_pool.hpp"
+
+#include <glm/vec2.hpp>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Render target of a viewport window that follows the window size without reallocating on every frame of a
+        // splitter drag.
+        //
+        // While the size keeps changing, the view renders into a pooled target at least as large as itself and only
+        // shows the centered part of it (see getUVMin/getUVMax). Once the size has been stable for
+        // RESIZE_DEBOUNCE_SECONDS, the target is swapped for one of the exact size.
+        class ViewportRenderTarget
+        {
+        public:
+            static constexpr double RESIZE_DEBOUNCE_SECONDS = 0.25;
+
+            ViewportRenderTarget() = default;
+            ~ViewportRenderTarget();
+
+            void initialize(rhi::RenderDevice& rd, uint32_t width, uint32_t height);
+            void shutdown();
+
+            // Once per frame with the size in pixels the view displays. Returns true if the target was replaced.
+            // An immediate update skips the debounce, for size changes that are deliberate rather than dragged.
+            bool update(uint32_t viewWidth, uint32_t viewHeight, double time, bool immediate = false);
+
+            [[nodiscard]] rhi::Texture*         getTexture() const { return m_Target.texture.get(); }
+            [[nodiscard]] imgui::ImGuiTextureID getImGuiTexture() const { return m_Target.imguiTexture; }
+
+            // Size of the target, which is what the camera projects to
+            [[nodiscard]] uint32_t getWidth() const { return m_Target.getWidth(); }
+            [[nodiscard]] uint32_t getHeight() const { return m_Target.getHeight(); }
+
+            // Part of the target that is displayed
+            [[nodiscard]] glm::vec2 getUVMin() const;
+            [[nodiscard]] glm::vec2 getUVMax() const { return glm::vec2(1.0f) - getUVMin(); }
+
+            [[nodiscard]] bool isResizing() const { return m_IsResizing; }
+
+        private:
+            void replaceTarget(PooledRenderTarget target);
+
+        private:
+            RenderTargetPool   m_Pool;
+            PooledRenderTarget m_Target;
+
+            uint32_t m_ViewWidth {0};
+            uint32_t m_ViewHeight {0};
+            double   m_LastResizeTime {0.0};
+            bool     m_IsResizing {false};
+        };
+    } // namespace editor
+} // namespace vultra
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vultra/function/scenegraph/components.hpp>
+#include <vultra/function/scenegraph/entity.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <tuple>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Components that act on the scene whether or not their entity is visible: the renderer lights the scene with
+        // every light and LogicScene::getMainCamera() looks at every camera. They are detached while tombstoned.
+        using TombstoneStash = std::tuple<std::optional<CameraComponent>,
+                                          std::optional<XrCameraComponent>,
+                                          std::optional<DirectionalLightComponent>,
+                                          std::optional<PointLightComponent>,
+                                          std::optional<AreaLightComponent>>;
+
+        // Marks an entity the editor deleted but still keeps for undo. The entity stays in the scene until the history
+        // lets go of it: hidden, left out of the Scene Graph and picking, and with the TombstoneStash components moved
+        // in here so it does not light, film or otherwise affect the scene.
+        struct TombstoneComponent
+        {
+            uint32_t       savedFlags {0};
+            uint32_t       count {0}; // Nested deletions, e.g. a child deleted on its own and then with its parent
+            TombstoneStash stash;
+        };
+
+        // Both apply to the whole subtree of the entity
+        void tombstoneEntity(Entity& entity);
+        void restoreEntity(Entity& entity);
+
+        [[nodiscard]] bool isTombstoned(Entity& entity);
+    } // namespace editor
+} // namespace vultra
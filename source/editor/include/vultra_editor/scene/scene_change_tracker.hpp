@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Generation counters for edits the editor makes to the scene. LogicScene has no change events, so whoever
+        // creates, destroys, reparents or renames an entity bumps the hierarchy generation here, and views that cache
+        // something derived from the hierarchy compare it against the generation they were built for.
+        //
+        // Transform edits (gizmo, inspector) bump a separate counter, since most caches only need a cheap refit then.
+        // Any other edit (e.g. entity flags) only bumps the overall generation, which every kind of edit advances.
+        class SceneChangeTracker
+        {
+        public:
+            static void markHierarchyChanged()
+            {
+                s_HierarchyGeneration++;
+                s_Generation++;
+            }
+            static uint64_t getHierarchyGeneration() { return s_HierarchyGeneration; }
+
+            static void markTransformsChanged()
+            {
+                s_TransformGeneration++;
+                s_Generation++;
+            }
+            static uint64_t getTransformGeneration() { return s_TransformGeneration; }
+
+            static void     markPropertiesChanged() { s_Generation++; }
+            static uint64_t getGeneration() { return s_Generation; }
+
+        private:
+            inline static uint64_t s_HierarchyGeneration = 0;
+            inline static uint64_t s_TransformGeneration = 0;
+            inline static uint64_t s_Generation          = 0;
+        };
+    } // namespace editor
+} // namespace vultra
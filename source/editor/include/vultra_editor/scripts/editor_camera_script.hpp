@@ -22,6 +22,9 @@ namespace vultra
             void setWindowHovered(bool windowHovered) { m_IsWindowHovered = windowHovered; }
             void setGrabMoveEnabled(bool grabMoveEnabled) { m_IsGrabMoveEnabled = grabMoveEnabled; }
 
+            // Free move, grab move, or zoomed this frame
+            bool isNavigating() const { return m_IsFreeMoveValid || m_IsGrabMoveValid || m_IsZooming; }
+
         private:
             float m_Sensitivity = 0.05f;
             float m_BaseSpeed   = 0.1f;
@@ -32,6 +35,7 @@ namespace vultra
             bool m_IsFreeMoveValid   = false;
             bool m_IsGrabMoveValid   = false;
             bool m_IsGrabMoveEnabled = false;
+            bool m_IsZooming         = false;
 
             bool m_FirstMouse = true;
             bool m_FirstGrab  = true;
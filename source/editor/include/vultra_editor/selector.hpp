@@ -2,6 +2,7 @@
 
 #include <vultra/core/base/uuid.hpp>
 
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -18,31 +19,66 @@ namespace vultra
 
         std::string to_string(SelectionCategory category);
 
+        // Global editor selection, one set per category.
+        //
+        // Membership tests, single selects and unselects are O(1); bulk operations take a span so select-all and
+        // range selections update the set in one pass. Items are kept in insertion order: an unselect only leaves a
+        // hole, and holes are squeezed out in one pass on the next read of the items.
+        //
+        // Every change bumps a generation counter, so consumers can cache whatever they derive from the selection
+        // (resolved entities, bounds) and refresh it only when it changed.
         class Selector
         {
         public:
-            static void                                select(SelectionCategory category, CoreUUID selectionId);
-            static void                                unselect(SelectionCategory category, CoreUUID selectionId);
-            static void                                unselect(CoreUUID selectionId);
-            static void                                unselectAll();
-            static void                                unselectAll(SelectionCategory category);
-            static CoreUUID                            getSelection(SelectionCategory category, size_t index);
-            static size_t                              getSelectionCount(SelectionCategory category);
-            static CoreUUID                            getLastSelection(SelectionCategory category);
-            inline static const std::vector<CoreUUID>& getSelections(SelectionCategory category)
-            {
-                return s_SelectionMap[category];
-            }
+            static void select(SelectionCategory category, CoreUUID selectionId);
+            static void select(SelectionCategory category, std::span<const CoreUUID> selectionIds);
+            static void unselect(SelectionCategory category, CoreUUID selectionId);
+            static void unselect(SelectionCategory category, std::span<const CoreUUID> selectionIds);
+            static void unselect(CoreUUID selectionId);
+            static void unselectAll();
+            static void unselectAll(SelectionCategory category);
+            static void toggle(SelectionCategory category, CoreUUID selectionId);
+
+            // Replace the selection of a category, with a single generation bump
+            static void setSelection(SelectionCategory category, std::span<const CoreUUID> selectionIds);
+
+            // Bump the generation without changing the selection, e.g. after the objects behind IDs were destroyed
+            static void invalidate(SelectionCategory category);
+
+            static CoreUUID                     getSelection(SelectionCategory category, size_t index);
+            static size_t                       getSelectionCount(SelectionCategory category);
+            static CoreUUID                     getLastSelection(SelectionCategory category);
+            static const std::vector<CoreUUID>& getSelections(SelectionCategory category);
 
             static bool isSelected(SelectionCategory category, CoreUUID selectionId);
 
             static SelectionCategory getLastSelectionCategory() { return s_LastSelectionCategory; }
             static CoreUUID          getLastSelectionUUID() { return s_LastSelectionUUID; }
 
+            // Increases on every change of any category
+            static uint64_t getGeneration() { return s_Generation; }
+            // Increases on every change of this category
+            static uint64_t getGeneration(SelectionCategory category) { return s_SelectionMap[category].generation; }
+
+        private:
+            struct SelectionSet
+            {
+                std::vector<CoreUUID>                  items;   // Insertion order, with holes until compact()
+                std::unordered_map<CoreUUID, uint32_t> indices; // Into items; a slot not indexed here is a hole
+                uint64_t                               generation {0};
+            };
+
+            static bool insert(SelectionSet& selections, const CoreUUID& selectionId);
+            static bool erase(SelectionSet& selections, const CoreUUID& selectionId);
+            static void compact(SelectionSet& selections);
+            static void markChanged(SelectionSet& selections);
+            static void resetLastSelection(SelectionCategory category, const SelectionSet& selections);
+
         private:
-            static std::unordered_map<SelectionCategory, std::vector<CoreUUID>> s_SelectionMap;
-            static SelectionCategory                                            s_LastSelectionCategory;
-            static CoreUUID                                                     s_LastSelectionUUID;
+            static std::unordered_map<SelectionCategory, SelectionSet> s_SelectionMap;
+            static SelectionCategory                                   s_LastSelectionCategory;
+            static CoreUUID                                            s_LastSelectionUUID;
+            static uint64_t                                            s_Generation;
         };
     } // namespace editor
 } // namespace vultra
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "vultra_editor/ui/ui_window.hpp"
 
+#include <vultra_engine/core/profiler.hpp>
+
 #include <memory>
 #include <vector>
 
@@ -12,6 +14,7 @@ namespace vultra
         template<typename T>
         concept WindowType = std::is_base_of_v<UIWindow, T>;
 
+        // Every callback of an open window runs in a profiler scope named after the window
         class UIWindowManager
         {
         public:
@@ -41,7 +44,10 @@ namespace vultra
                 for (auto& w : m_Windows)
                 {
                     if (w->m_IsOpen)
+                    {
+                        VULTRA_PROFILE_SCOPE(w->m_Name.c_str());
                         w->onPreUpdate();
+                    }
                 }
             }
 
@@ -50,7 +56,10 @@ namespace vultra
                 for (auto& w : m_Windows)
                 {
                     if (w->m_IsOpen)
+                    {
+                        VULTRA_PROFILE_SCOPE(w->m_Name.c_str());
                         w->onUpdate(dt, logicScene);
+                    }
                 }
             }
 
@@ -59,7 +68,10 @@ namespace vultra
                 for (auto& w : m_Windows)
                 {
                     if (w->m_IsOpen)
+                    {
+                        VULTRA_PROFILE_SCOPE(w->m_Name.c_str());
                         w->onPhysicsUpdate(dt);
+                    }
                 }
             }
 
@@ -68,7 +80,10 @@ namespace vultra
                 for (auto& w : m_Windows)
                 {
                     if (w->m_IsOpen)
+                    {
+                        VULTRA_PROFILE_SCOPE(w->m_Name.c_str());
                         w->onPostUpdate(dt);
+                    }
                 }
             }
 
@@ -77,7 +92,10 @@ namespace vultra
                 for (auto& w : m_Windows)
                 {
                     if (w->m_IsOpen)
+                    {
+                        VULTRA_PROFILE_SCOPE(w->m_Name.c_str());
                         w->onPreRender();
+                    }
                 }
             }
 
@@ -86,7 +104,10 @@ namespace vultra
                 for (auto& w : m_Windows)
                 {
                     if (w->m_IsOpen)
+                    {
+                        VULTRA_PROFILE_SCOPE(w->m_Name.c_str());
                         w->onRender(ctx);
+                    }
                 }
             }
 
@@ -95,7 +116,10 @@ namespace vultra
                 for (auto& w : m_Windows)
                 {
                     if (w->m_IsOpen)
+                    {
+                        VULTRA_PROFILE_SCOPE(w->m_Name.c_str());
                         w->onPostRender();
+                    }
                 }
             }
 
@@ -104,7 +128,10 @@ namespace vultra
                 for (auto& w : m_Windows)
                 {
                     if (w->m_IsOpen)
+                    {
+                        VULTRA_PROFILE_SCOPE(w->m_Name.c_str());
                         w->onImGui();
+                    }
                 }
             }
 
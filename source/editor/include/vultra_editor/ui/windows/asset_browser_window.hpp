@@ -1,5 +1,7 @@
 #pragma once
 
+#include "vultra_editor/asset/asset_directory_tree.hpp"
+#include "vultra_editor/asset/asset_search_index.hpp"
 #include "vultra_editor/ui/ui_window.hpp"
 
 #include <vultra/function/renderer/imgui_renderer.hpp>
@@ -7,6 +9,9 @@
 #include <ImGuiAl/msgbox/imguial_msgbox.h>
 
 #include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace vultra
 {
@@ -21,11 +26,15 @@ namespace vultra
             void onImGui() override;
 
         private:
-            void drawDirectoryRecursive(const std::filesystem::path& dirPath);
+            void drawDirectoryRecursive(const AssetDirectoryNode& dirNode);
             void drawRightPanel();
             void selectPath(const std::filesystem::path& path);
+            void updateSearchResults(const AssetDirectoryNode& scopeNode);
 
         private:
+            // Snapshot used for the current frame
+            std::shared_ptr<const AssetDirectoryTree> m_DirectoryTree;
+
             std::filesystem::path m_AssetRoot;
             std::filesystem::path m_CurrentDir;
             std::filesystem::path m_SelectedPath;
@@ -40,6 +49,13 @@ namespace vultra
             float m_LeftPanelRatio {0.3f};
             bool  m_FocusToCurrent {false};
 
+            // Filter results, recomputed only when the query, scope or snapshot changes
+            std::string           m_SearchText;
+            std::filesystem::path m_SearchScope;
+            uint64_t              m_SearchGeneration {0};
+            std::vector<uint32_t> m_SearchResults;
+            double                m_SearchMs {0.0};
+
             float m_IconSize {64.0f};
             float m_MinIconSize {24.0f};
             float m_MaxIconSize {128.0f};
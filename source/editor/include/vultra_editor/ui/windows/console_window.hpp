@@ -1,9 +1,15 @@
 #pragma once
 
+#include "vultra_editor/log/console_log_buffer.hpp"
 #include "vultra_editor/ui/ui_window.hpp"
 
 #include <imgui.h>
 
+#include <deque>
+#include <optional>
+#include <regex>
+#include <string>
+
 using LogLevel = vultra::Logger::Level;
 
 namespace vultra
@@ -19,18 +25,28 @@ namespace vultra
             void onImGui() override;
 
         private:
-            struct LogEntry
-            {
-                LogLevel    level;
-                std::string message;
-            };
-
-            std::vector<LogEntry> m_LogMessages;
-            uint16_t              m_LogMessagesEnd;
-            uint32_t              m_LogMessagesFilter;
-            ImGuiTextFilter       m_Filter;
-            bool                  m_AllowToBottom;
-            bool                  m_RequestToBottom;
+            bool isTextFilterActive() const;
+            bool passesFilters(const ConsoleLogBuffer::Entry& entry) const;
+            void updateVisibleRows();
+            void drawLogEntry(const ConsoleLogBuffer::Entry& entry);
+
+        private:
+            // Filled from any thread by the logger, drained on the main thread in onImGui()
+            ConsoleLogBuffer m_LogBuffer;
+
+            // Sequence numbers of the history entries passing the filters. Rebuilt when a filter changes, otherwise
+            // only extended with the entries drained since the last frame.
+            std::deque<uint64_t> m_VisibleRows;
+            uint64_t             m_IndexedEnd {0};
+            bool                 m_VisibleRowsDirty {true};
+
+            uint32_t                  m_LogMessagesFilter;
+            ImGuiTextFilter           m_Filter;
+            bool                      m_UseRegex {false};
+            std::optional<std::regex> m_FilterRegex; // Empty if the pattern does not compile
+            std::string               m_FilterRegexError;
+            bool                      m_AllowToBottom;
+            bool                      m_RequestToBottom;
         };
     } // namespace editor
 } // namespace vultra
\ No newline at end of file
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "vultra_editor/render/dynamic_resolution.hpp"
+#include "vultra_editor/render/view_render_scheduler.hpp"
+#include "vultra_editor/render/viewport_render_target.hpp"
 #include "vultra_editor/ui/ui_window.hpp"
 
 #include <vultra/function/renderer/imgui_renderer.hpp>
@@ -15,18 +18,16 @@ namespace vultra
             ~GameViewWindow() override;
 
             void onInit(rhi::RenderDevice& renderDevice) override;
+            void onDestroy() override;
             void onImGui() override;
             void onRender(UIWindowRenderContext& ctx) override;
 
         private:
-            void recreateRenderTexture(uint32_t width, uint32_t height);
-
             void      drawToolbar();
             glm::vec3 computeTargetResolution(const ImVec2& avail) const;
 
         private:
-            imgui::ImGuiTextureID m_GameTexture {nullptr};
-            rhi::Texture          m_GameRenderTexture;
+            ViewportRenderTarget m_RenderTarget;
 
             bool m_IsWindowOpen {false};
             bool m_FirstFrame {true};
@@ -37,6 +38,12 @@ namespace vultra
             float m_UserZoom {1.0f};
 
             uint32_t m_SelectedResolution {0}; // 0 = Free Aspect
+
+            ViewRenderScheduler m_RenderScheduler;
+
+            bool                        m_IsDynamicResolutionEnabled {false};
+            DynamicResolutionController m_DynamicResolution;
+            float                       m_RefreshIntervalEstimate {0.0f}; // Milliseconds
         };
     } // namespace editor
 } // namespace vultra
\ No newline at end of file
@@ -23,9 +23,14 @@ namespace vultra
 
             static void drawComponentName(NameComponent& comp);
             static void drawComponentFlags(EntityFlagsComponent& comp);
-            static void drawComponentTransform(TransformComponent& comp);
+            static void drawComponentTransform(Entity& entity, TransformComponent& comp);
 
             static void drawAssetProperties(const CoreUUID& assetUUID);
+
+        private:
+            Entity      m_SelectedEntity;
+            uint64_t    m_SelectionGeneration {UINT64_MAX};
+            LogicScene* m_SelectionScene {nullptr};
         };
     } // namespace editor
 } // namespace vultra
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "vultra_editor/ui/ui_window.hpp"
+
+#include <vultra_engine/core/memory_tracker.hpp>
+
+#include <filesystem>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Live bytes, peak, allocation rate and budget per engine::MemoryTag, with a history of the last minutes.
+        // Budgets are editable here; the Textures (GPU) one is what the asset database evicts against. Closed by
+        // default.
+        class MemoryWindow final : public UIWindow
+        {
+        public:
+            MemoryWindow();
+
+            void onImGui() override;
+
+            // Where Export Snapshot writes its JSON files
+            void setSnapshotDirectory(const std::filesystem::path& directory) { m_SnapshotDirectory = directory; }
+
+        private:
+            void drawHistory();
+            void drawTagTable();
+            void exportSnapshot();
+
+        private:
+            std::filesystem::path m_SnapshotDirectory;
+        };
+    } // namespace editor
+} // namespace vultra
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "vultra_editor/ui/ui_window.hpp"
+
+#include <vultra_engine/core/profiler.hpp>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Frame-time history and a flame graph of the last frame, from engine::Profiler. Closed by default; the
+        // editor only records scopes while this window is open and recording.
+        class ProfilerWindow final : public UIWindow
+        {
+        public:
+            ProfilerWindow();
+
+            void onImGui() override;
+
+            [[nodiscard]] bool isRecording() const { return m_IsRecording; }
+
+        private:
+            void drawFrameTimeHistory();
+            void drawFlameGraph();
+            void drawScopeTable();
+
+        private:
+            bool m_IsRecording {true};
+            bool m_IsFrozen {false};
+
+            engine::ProfileFrame m_Frame; // Frame on display, kept while frozen
+        };
+    } // namespace editor
+} // namespace vultra
@@ -5,6 +5,10 @@
 #include <vultra/function/renderer/imgui_renderer.hpp>
 #include <vultra/function/scenegraph/entity.hpp>
 
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 namespace vultra
 {
     class LogicScene;
@@ -21,14 +25,47 @@ namespace vultra
             void onImGui() override;
 
         private:
-            void drawEntityNode(Entity& entity);
+            // One visible line of the hierarchy, cached until the hierarchy or the expanded set changes
+            struct SceneGraphRow
+            {
+                Entity      entity;
+                CoreUUID    uuid;
+                std::string label;
+                uint32_t    depth {0};
+                bool        hasChildren {false};
+                bool        expanded {false};
+            };
+
+            void updateRows();
+            // Children that are not deleted entities kept for undo
+            static bool hasLiveChildren(Entity& entity);
+            void drawEntityRow(SceneGraphRow& row);
             void selectEntity(Entity& entity);
+            void handleEntityClick(const CoreUUID& entityUUID, bool toggle, bool range);
+            void selectAllEntities();
+            void syncSelection();
 
         private:
-            Entity              m_SelectedEntity;
+            Entity              m_SelectedEntity; // Last selected entity, re-resolved when the selection changes
             std::vector<Entity> m_PendingDeleteEntities;
             Entity              m_RenamingEntity;
 
+            // Flattened hierarchy, rebuilt when SceneChangeTracker reports a hierarchy change, the scene changes or an
+            // entity is expanded / collapsed. Also the order for Shift+Click range selection.
+            std::vector<SceneGraphRow>   m_Rows;
+            std::unordered_set<CoreUUID> m_ExpandedEntities;
+            uint64_t                     m_RowsGeneration {UINT64_MAX};
+            LogicScene*                  m_RowsScene {nullptr};
+            bool                         m_RowsDirty {true};
+
+            CoreUUID m_SelectionAnchor;
+            uint64_t m_SelectionGeneration {UINT64_MAX};
+
+            // Clicks are applied once the whole tree has been drawn, when the row order is complete
+            CoreUUID m_PendingClickUUID;
+            bool     m_PendingClickToggle {false};
+            bool     m_PendingClickRange {false};
+
             ImGuiExt::RenamePopupWidget m_RenamePopupWidget;
         };
     } // namespace editor
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "vultra_editor/picking/scene_picker.hpp"
+#include "vultra_editor/render/progressive_refinement.hpp"
+#include "vultra_editor/render/view_render_scheduler.hpp"
+#include "vultra_editor/render/viewport_render_target.hpp"
 #include "vultra_editor/scripts/editor_camera_script.hpp"
 #include "vultra_editor/ui/ui_window.hpp"
 
@@ -19,6 +23,7 @@ namespace vultra
             ~SceneViewWindow() override;
 
             void onInit(rhi::RenderDevice& renderDevice) override;
+            void onDestroy() override;
             void onImGui() override;
             void onRender(UIWindowRenderContext& ctx) override;
 
@@ -26,23 +31,42 @@ namespace vultra
             uint32_t getViewportHeight() const;
 
         private:
-            void recreateRenderTexture(uint32_t width, uint32_t height);
-
             void handleInput();
+            void updatePicking(const glm::mat4& view, const glm::mat4& projection);
+            void selectPicked(const glm::mat4& view, const glm::mat4& projection);
+            void selectInMarquee(const glm::mat4& view, const glm::mat4& projection);
+            void drawMarquee() const;
+
+            glm::vec2 toViewportNDC(const glm::vec2& screenPos) const;
             void drawToolbar();
 
         private:
-            imgui::ImGuiTextureID m_SceneTexture {nullptr};
-            rhi::Texture          m_SceneRenderTexture;
+            ViewportRenderTarget m_RenderTarget;
 
             int            m_GuizmoOperation = ImGuizmo::OPERATION::TRANSLATE;
             ImGuizmo::MODE m_GuizmoMode      = ImGuizmo::MODE::LOCAL;
 
-            Entity m_SelectedEntity;
+            Entity      m_SelectedEntity;
+            uint64_t    m_SelectionGeneration {UINT64_MAX};
+            LogicScene* m_SelectionScene {nullptr};
+
+            ScenePicker                    m_ScenePicker;
+            std::optional<ScenePickResult> m_HoveredPick;
+            glm::vec2                      m_ViewportMin {0.0f};
+            glm::vec2                      m_ViewportMax {0.0f};
+            glm::vec2                      m_ProjectionMin {0.0f}; // Screen rect the camera projection maps to
+            glm::vec2                      m_ProjectionMax {0.0f};
+            bool                           m_PickOnRelease {false};
+            bool                           m_IsMarqueeActive {false};
+            glm::vec2                      m_MarqueeStart {0.0f};
 
             bool m_IsWindowHovered {false};
             bool m_IsWindowOpen    {false};
 
+            ViewRenderScheduler   m_RenderScheduler;
+            ProgressiveRefinement m_Refinement;
+            float                 m_RenderScale {1.0f};
+
             EditorCameraScriptInstance m_EditorCameraScript;
         };
     } // namespace editor
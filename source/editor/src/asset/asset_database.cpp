@@ -1,8 +1,16 @@
 #include "vultra_editor/asset/asset_database.hpp"
 
 #include <vultra/function/renderer/texture_manager.hpp>
-#include <vultra/function/resource/resource.hpp>
+#include <vultra_engine/asset/asset_paths.hpp>
+#include <vultra_engine/asset/asset_registry_bootstrap.hpp>
+#include <vultra_engine/core/memory_tracker.hpp>
+#include <vultra_engine/core/profiler.hpp>
 
+#include <stb_image.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 
@@ -10,76 +18,159 @@ namespace vultra
 {
     namespace editor
     {
-        constexpr const char* ASSET_REGISTRY_FILE = "asset_registry.json";
-        constexpr const char* ASSET_IMPORT_FOLDER = "Assets";
-        constexpr const char* ASSET_EXPORT_FOLDER = ".imported";
+        // Journal records after which the binary registry is rewritten as a whole
+        constexpr size_t REGISTRY_JOURNAL_COMPACT_THRESHOLD = 4096;
         constexpr const char* META_FILE_EXTENSION = ".vmeta";
+        constexpr const char* THUMBNAIL_FOLDER    = "thumbnails";
+
+        // Frames a retired texture is kept alive so in-flight command buffers can still sample it
+        constexpr uint64_t TEXTURE_RETIRE_FRAMES = 3;
+        // Main-thread time slice for texture uploads per frame
+        constexpr auto TEXTURE_UPLOAD_BUDGET = std::chrono::milliseconds(4);
+        // Resident asset textures above this are evicted, least recently used first
+        constexpr uint64_t DEFAULT_TEXTURE_BUDGET_BYTES = 512ull * 1024 * 1024;
+
+        namespace
+        {
+            uint32_t getMipLevelCount(uint32_t width, uint32_t height)
+            {
+                return static_cast<uint32_t>(std::bit_width(std::max({width, height, 1u})));
+            }
+
+            uint64_t getMipChainBytes(uint32_t width, uint32_t height, uint32_t mipLevels, uint64_t bytesPerPixel)
+            {
+                uint64_t bytes = 0;
+                for (uint32_t mip = 0; mip < mipLevels; ++mip)
+                {
+                    bytes += static_cast<uint64_t>(std::max(width >> mip, 1u)) * std::max(height >> mip, 1u);
+                }
+                return bytes * bytesPerPixel;
+            }
+        } // namespace
 
         AssetDatabase* AssetDatabase::s_Instance = nullptr;
 
-        AssetDatabase::AssetDatabase() : m_AssetImporter(m_AssetRegistry) {}
+        AssetDatabase::AssetDatabase()
+        {
+            setTextureBudget(DEFAULT_TEXTURE_BUDGET_BYTES);
+        }
 
         AssetDatabase::~AssetDatabase()
         {
+            // Queued imports are dropped, an import already running finishes first
+            m_AssetWatcher.stop();
+            m_ImportQueueCancelled = true;
+            m_ImportQueue.reset();
+
+            stopLoaderThread();
+            m_ThumbnailCache.shutdown();
+
+            if (m_PendingDirectoryTree.valid())
+                m_PendingDirectoryTree.wait();
+
             // Cleanup ImGui textures
-            for (auto& [uuidStr, imguiTexID] : m_ImGuiTextures)
+            for (auto& [uuidStr, residency] : m_Textures)
             {
-                imgui::removeTexture(*m_RenderDevice, imguiTexID);
+                if (residency.imguiTexture)
+                    imgui::removeTexture(*m_RenderDevice, residency.imguiTexture);
             }
+            engine::MemoryTracker::onFree(engine::MemoryTag::eGPUTextures, m_ResidentTextureBytes);
+            destroyRetiredTextures(true);
         }
 
         void AssetDatabase::initialize(const engine::Project& project, rhi::RenderDevice& rd)
         {
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eAssets);
+
             m_Project      = project;
             m_RenderDevice = &rd;
 
             // Setup paths
-            m_Paths.workingDir   = project.directory;
-            m_Paths.assetDir     = m_Paths.workingDir / ASSET_IMPORT_FOLDER;
-            m_Paths.importedDir  = m_Paths.workingDir / ASSET_EXPORT_FOLDER;
-            m_Paths.registryFile = m_Paths.importedDir / ASSET_REGISTRY_FILE;
+            m_Paths.workingDir         = project.directory;
+            m_Paths.assetDir           = m_Paths.workingDir / engine::ASSET_IMPORT_FOLDER;
+            m_Paths.importedDir        = m_Paths.workingDir / engine::ASSET_EXPORT_FOLDER;
+            m_Paths.registryFile       = m_Paths.importedDir / engine::ASSET_REGISTRY_FILE;
+            m_Paths.binaryRegistryFile = m_Paths.importedDir / engine::ASSET_BINARY_REGISTRY_FILE;
 
-            // Get string paths
-            std::string workingFolder      = m_Paths.workingDir.string();
-            std::string assetFolder        = m_Paths.assetDir.string();
-            std::string importedFolder     = m_Paths.importedDir.string();
-            std::string outputRegistryFile = m_Paths.registryFile.string();
-
-            m_AssetRegistry.setImportedFolder(importedFolder);
-            if (std::filesystem::exists(outputRegistryFile))
+            // Shared with VultraCook, so the editor picks up exactly what was cooked
+            m_ImportPipeline =
+                std::make_unique<engine::AssetImportPipeline>(m_AssetRegistry, m_Paths.assetDir, m_Paths.importedDir);
+            engine::bootstrapAssetRegistry(
+                m_AssetRegistry, m_BinaryRegistry, *m_ImportPipeline, m_Paths.importedDir, {}, m_LastImportReport);
+            if (!m_LastImportReport.succeeded())
             {
-                m_AssetRegistry.load(outputRegistryFile);
+                throw std::runtime_error("Failed to import asset folder: " + m_Paths.assetDir.string());
             }
 
-            m_AssetImporter.importOrReimportAssetFolder(assetFolder);
-            if (!m_AssetImporter.importOrReimportAssetFolder(assetFolder))
+            rebuildMetaIndex(m_Paths.assetDir);
+
+            m_SearchIndex        = buildDirectorySnapshot();
+            m_DirectoryTree      = m_SearchIndex->getTree();
+            m_DirectoryTreeDirty = false;
+            ++m_DirectoryTreeGeneration;
+
+            // Textures are loaded on demand, see getTextureByUUID
+            stopLoaderThread();
+            m_StopLoader   = false;
+            m_LoaderThread = std::thread([this]() { loaderThreadLoop(); });
+
+            m_ThumbnailCache.initialize(m_Paths.importedDir / THUMBNAIL_FOLDER, rd);
+
+            // Changes saved from other tools are reimported in the background
+            m_ImportQueueCancelled = false;
+            m_ImportQueue          = std::make_unique<engine::JobSystem>(1, "Import Queue");
+            m_AssetWatcher.start(m_Paths.assetDir,
+                                 [this](std::vector<AssetChange> changes) { onAssetsChanged(std::move(changes)); });
+        }
+
+        void AssetDatabase::update()
+        {
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eAssets);
+
+            ++m_FrameIndex;
+
+            applyTextureInvalidations();
+            uploadReadyTextures();
+            evictColdTextures();
+            destroyRetiredTextures(false);
+
+            m_ThumbnailCache.update();
+
+            updateDirectoryTree();
+        }
+
+        void AssetDatabase::updateDirectoryTree()
+        {
+            if (m_PendingDirectoryTree.valid() &&
+                m_PendingDirectoryTree.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
             {
-                throw std::runtime_error("Failed to import asset folder: " + assetFolder);
+                m_SearchIndex   = m_PendingDirectoryTree.get();
+                m_DirectoryTree = m_SearchIndex->getTree();
+                ++m_DirectoryTreeGeneration;
             }
 
-            m_AssetRegistry.save(outputRegistryFile);
-            m_AssetRegistry.cleanup();
-
-            // Load all textures to memory
-            for (const auto& [uuidStr, entry] : m_AssetRegistry.getRegistry())
+            // Scan on a worker so slow (e.g. network mounted) project folders never stall a frame. Invalidations
+            // arriving during a scan are picked up by the next one.
+            if (m_DirectoryTreeDirty && !m_PendingDirectoryTree.valid())
             {
-                if (entry.type == vasset::VAssetType::eTexture)
-                {
-                    auto texturePath = m_Paths.importedDir / entry.path;
-                    auto texture     = resource::loadResource<gfx::TextureManager>(texturePath.generic_string());
-                    if (!texture)
-                    {
-                        VULTRA_CORE_ERROR("Failed to load texture asset: {}", entry.path);
-                        continue;
-                    }
+                m_DirectoryTreeDirty   = false;
+                m_PendingDirectoryTree = std::async(std::launch::async, [this]() { return buildDirectorySnapshot(); });
+            }
+        }
 
-                    // Store texture
-                    m_Textures[uuidStr] = texture;
+        std::shared_ptr<const AssetSearchIndex> AssetDatabase::buildDirectorySnapshot()
+        {
+            VULTRA_PROFILE_SCOPE("Build Directory Snapshot");
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eAssets);
 
-                    // Add imgui texture
-                    m_ImGuiTextures[uuidStr] = imgui::addTexture(*texture);
-                }
-            }
+            auto tree = std::make_shared<AssetDirectoryTree>();
+            tree->build(m_Paths.assetDir);
+
+            // Asset types come from the meta index, which is thread safe
+            auto searchIndex = std::make_shared<AssetSearchIndex>();
+            searchIndex->build(std::move(tree),
+                               [this](const std::filesystem::path& metaPath) { return getMetaAssetType(metaPath); });
+            return searchIndex;
         }
 
         bool AssetDatabase::renameAsset(const vasset::VUUID& uuid,
@@ -88,7 +179,7 @@ namespace vultra
                                         const std::string&   parentDir)
         {
             // Find asset entry
-            auto entry = m_AssetRegistry.lookup(uuid);
+            auto entry = lookupAsset(uuid);
             if (entry.path.empty())
             {
                 return false;
@@ -127,19 +218,27 @@ namespace vultra
                 const auto& oldImportedPath = importedPath;
                 auto newImportedPath = importedPath.parent_path() / (newName + importedPath.extension().string());
 
-                // Update asset registry
-                if (!m_AssetRegistry.updateRegistry(
-                        uuid, std::filesystem::relative(newImportedPath, m_Paths.importedDir).string()))
                 {
-                    VULTRA_CORE_ERROR("Failed to update asset registry");
-                    return false;
-                }
+                    std::lock_guard lock(m_RegistryMutex);
+
+                    // Update asset registry
+                    if (!m_AssetRegistry.updateRegistry(
+                            uuid, std::filesystem::relative(newImportedPath, m_Paths.importedDir).string()))
+                    {
+                        VULTRA_CORE_ERROR("Failed to update asset registry");
+                        return false;
+                    }
 
-                // Rename imported file
-                std::filesystem::rename(oldImportedPath, newImportedPath);
+                    // Rename imported file
+                    std::filesystem::rename(oldImportedPath, newImportedPath);
 
-                // Save registry
-                m_AssetRegistry.save(m_Paths.registryFile.string());
+                    // Save registry
+                    journalRegistryEntries(std::span(&uuid, 1));
+                }
+
+                refreshMeta(assetMetaPath);
+                refreshMeta(newAssetMetaPath);
+                invalidateDirectoryTree();
             }
             catch (const std::exception& e)
             {
@@ -152,91 +251,339 @@ namespace vultra
 
         bool AssetDatabase::reimportAsset(const std::filesystem::path& assetPath)
         {
-            assert(std::filesystem::exists(assetPath) && !std::filesystem::is_directory(assetPath));
-
-            auto metaUUID          = getMetaUUID(assetPath);
-            auto metaExt           = getMetaExtension(assetPath);
-            auto assetPathCopy     = assetPath;
-            auto originalAssetPath = assetPathCopy.replace_extension(metaExt);
+            VULTRA_PROFILE_SCOPE("Reimport Asset");
 
-            if (!m_AssetImporter.importOrReimportAsset(originalAssetPath.string(), true))
+            // Queued jobs may run after the file was deleted
+            std::error_code ec;
+            if (!m_ImportPipeline || !std::filesystem::is_regular_file(assetPath, ec))
             {
                 return false;
             }
 
-            m_AssetRegistry.cleanup();
+            // Either the .vmeta or the source file; a source file without meta yet is imported for the first time
+            auto originalAssetPath = assetPath;
+            if (assetPath.extension() == META_FILE_EXTENSION)
+            {
+                originalAssetPath.replace_extension(getMetaExtension(assetPath));
+            }
+
+            // The import runs against a snapshot; the registry lock is only held to take it and to apply the result,
+            // so lookups from the main thread never wait for an import
+            std::vector<std::string> removedUUIDs;
+            const auto produced = m_ImportPipeline->reimport(originalAssetPath, getRegistrySnapshot(), removedUUIDs);
+            if (!produced)
+            {
+                return false;
+            }
 
-            // Update textures and ImGui textures if needed
-            auto entry = m_AssetRegistry.lookup(metaUUID);
-            if (entry.type == vasset::VAssetType::eTexture)
+            std::vector<vasset::VUUID> textureUUIDs;
             {
-                auto texturePath = m_Paths.importedDir / entry.path;
+                std::lock_guard lock(m_RegistryMutex);
 
-                // We don't use resource::loadResource here to ensure we don't get a cached version
-                gfx::TextureLoader tmpTextureLoader {};
+                auto& entries = m_AssetRegistry.getRegistry();
 
-                auto texture = tmpTextureLoader(texturePath.generic_string(), *m_RenderDevice);
-                if (!texture)
+                std::vector<vasset::VUUID> changedUUIDs;
+                for (const auto& [uuidStr, entry] : *produced)
                 {
-                    VULTRA_CORE_ERROR("Failed to load texture asset: {}", entry.path);
-                    return false;
+                    const auto uuid = vasset::VUUID::fromString(uuidStr);
+                    if (entry.type == vasset::VAssetType::eTexture)
+                        textureUUIDs.push_back(uuid);
+
+                    auto it = entries.find(uuidStr);
+                    if (it != entries.end() && it->second.type == entry.type && it->second.path == entry.path)
+                        continue;
+
+                    entries[uuidStr] = entry;
+                    changedUUIDs.push_back(uuid);
+                }
+                for (const auto& uuidStr : removedUUIDs)
+                {
+                    if (entries.erase(uuidStr) > 0)
+                        changedUUIDs.push_back(vasset::VUUID::fromString(uuidStr));
                 }
 
-                auto uuidStr = metaUUID.toString();
+                journalRegistryEntries(changedUUIDs);
+            }
 
-                // Store texture
-                m_Textures[uuidStr] = texture;
+            refreshMeta(originalAssetPath);
+            invalidateDirectoryTree();
 
-                // Add imgui texture
-                m_ImGuiTextures[uuidStr] = imgui::addTexture(*texture);
+            // Resident textures are swapped on the main thread during the next update()
+            for (const auto& uuid : textureUUIDs)
+            {
+                invalidateTexture(uuid.toString());
             }
 
+            m_ContentGeneration.fetch_add(1, std::memory_order_relaxed);
             return true;
         }
 
         bool AssetDatabase::reimportFolder(const std::filesystem::path& folderPath)
         {
-            assert(std::filesystem::exists(folderPath) && std::filesystem::is_directory(folderPath));
+            VULTRA_PROFILE_SCOPE("Reimport Folder");
 
-            if (!m_AssetImporter.importOrReimportAssetFolder(folderPath.string(), true))
+            std::error_code ec;
+            if (!std::filesystem::is_directory(folderPath, ec))
             {
                 return false;
             }
 
-            m_AssetRegistry.cleanup();
+            // Same as reimportAsset: import into a private registry, then apply the difference under a short lock
+            const auto snapshot = getRegistrySnapshot();
+
+            vasset::VAssetRegistry scratch;
+            scratch.setImportedFolder(m_Paths.importedDir.string());
+            scratch.getRegistry() = snapshot;
+
+            vasset::VAssetImporter importer(scratch);
+            if (!importer.importOrReimportAssetFolder(folderPath.string(), true))
+            {
+                return false;
+            }
+            scratch.cleanup();
 
+            const auto changed = engine::diffRegistry(scratch.getRegistry(), snapshot);
+            {
+                std::lock_guard lock(m_RegistryMutex);
+
+                auto& entries = m_AssetRegistry.getRegistry();
+
+                std::vector<vasset::VUUID> changedUUIDs;
+                for (const auto& [uuidStr, entry] : changed)
+                {
+                    entries[uuidStr] = entry;
+                    changedUUIDs.push_back(vasset::VUUID::fromString(uuidStr));
+                }
+                for (const auto& [uuidStr, entry] : snapshot)
+                {
+                    if (!scratch.getRegistry().contains(uuidStr) && entries.erase(uuidStr) > 0)
+                        changedUUIDs.push_back(vasset::VUUID::fromString(uuidStr));
+                }
+
+                journalRegistryEntries(changedUUIDs);
+            }
+
+            rebuildMetaIndex(folderPath);
+            invalidateDirectoryTree();
+
+            m_ContentGeneration.fetch_add(1, std::memory_order_relaxed);
             return true;
         }
 
-        Ref<rhi::Texture> AssetDatabase::getTextureByUUID(const vasset::VUUID& uuid)
+        engine::AssetRegistryMap AssetDatabase::getRegistrySnapshot()
+        {
+            std::lock_guard lock(m_RegistryMutex);
+            return m_AssetRegistry.getRegistry();
+        }
+
+        bool AssetDatabase::exportRegistryJson(const std::filesystem::path& filePath)
         {
-            auto uuidStr = uuid.toString();
-            auto it      = m_Textures.find(uuidStr);
-            if (it != m_Textures.end())
+            const auto outputPath =
+                filePath.empty() ? m_Paths.importedDir / engine::ASSET_REGISTRY_EXPORT_FILE : filePath;
+
+            std::lock_guard lock(m_RegistryMutex);
+
+            try
             {
-                return it->second;
+                m_AssetRegistry.save(outputPath.string());
+            }
+            catch (const std::exception& e)
+            {
+                VULTRA_CORE_ERROR("Failed to export asset registry to {}: {}", outputPath.generic_string(), e.what());
+                return false;
+            }
+
+            VULTRA_CORE_INFO("Exported asset registry to {}", outputPath.generic_string());
+            return true;
+        }
+
+        void AssetDatabase::writeRegistry()
+        {
+            if (!m_BinaryRegistry.write(m_Paths.binaryRegistryFile, m_AssetRegistry))
+            {
+                VULTRA_CORE_ERROR("Failed to write asset registry {}", m_Paths.binaryRegistryFile.generic_string());
+                return;
+            }
+
+            // Migrated; left behind it would be read again whenever the binary registry fails to open
+            std::error_code ec;
+            std::filesystem::remove(m_Paths.registryFile, ec);
+        }
+
+        void AssetDatabase::journalRegistryEntries(std::span<const vasset::VUUID> uuids)
+        {
+            if (uuids.empty())
+                return;
+
+            // The journal is only valid on top of the file it was started for
+            if (!m_BinaryRegistry.isOpen() ||
+                m_BinaryRegistry.getJournalLength() + uuids.size() > REGISTRY_JOURNAL_COMPACT_THRESHOLD)
+            {
+                writeRegistry();
+                return;
+            }
+
+            const auto& entries = m_AssetRegistry.getRegistry();
+            for (const auto& uuid : uuids)
+            {
+                if (uuid.isNil())
+                    continue;
+
+                const auto it       = entries.find(uuid.toString());
+                const bool appended = it != entries.end() ?
+                                          m_BinaryRegistry.appendUpdate({uuid, it->second.type, it->second.path}) :
+                                          m_BinaryRegistry.appendRemove(uuid);
+                if (!appended)
+                {
+                    writeRegistry();
+                    return;
+                }
+            }
+        }
+
+        std::future<void> AssetDatabase::queueReimport(const std::filesystem::path& assetPath)
+        {
+            return submitImportJob([this, assetPath]() {
+                if (!reimportAsset(assetPath))
+                    VULTRA_CORE_ERROR("Failed to reimport asset: {}", assetPath.generic_string());
+            });
+        }
+
+        std::future<void> AssetDatabase::queueReimportFolder(const std::filesystem::path& folderPath)
+        {
+            return submitImportJob([this, folderPath]() {
+                if (!reimportFolder(folderPath))
+                    VULTRA_CORE_ERROR("Failed to reimport folder: {}", folderPath.generic_string());
+            });
+        }
+
+        std::future<void> AssetDatabase::submitImportJob(std::function<void()> job)
+        {
+            auto promise = std::make_shared<std::promise<void>>();
+            auto future  = promise->get_future();
+
+            if (!m_ImportQueue)
+            {
+                job();
+                promise->set_value();
+                return future;
+            }
+
+            m_ImportQueue->submit([this, promise, job = std::move(job)](uint32_t) {
+                engine::MemoryTagScope memoryTag(engine::MemoryTag::eAssets);
+                try
+                {
+                    if (!m_ImportQueueCancelled)
+                        job();
+                }
+                catch (const std::exception& e)
+                {
+                    VULTRA_CORE_ERROR("Import job failed: {}", e.what());
+                }
+                promise->set_value();
+            });
+
+            return future;
+        }
+
+        void AssetDatabase::onAssetsChanged(std::vector<AssetChange> changes)
+        {
+            invalidateDirectoryTree();
+
+            for (const auto& change : changes)
+            {
+                if (change.type == AssetChangeType::eRemoved)
+                {
+                    // Imported outputs of deleted sources are left to the registry cleanup; the index forgets them
+                    if (change.isDirectory)
+                        rebuildMetaIndex(change.path);
+                    else
+                        refreshMeta(change.path);
+                    continue;
+                }
+
+                if (!change.isDirectory)
+                {
+                    queueChangedAsset(change.path);
+                    continue;
+                }
+
+                // Folders moved or copied in arrive as a whole; unchanged files are skipped by the hash check
+                std::error_code ec;
+                for (const auto& entry : std::filesystem::recursive_directory_iterator(change.path, ec))
+                {
+                    std::error_code fileEc;
+                    if (entry.is_regular_file(fileEc))
+                        queueChangedAsset(entry.path());
+                }
             }
-            return nullptr;
+        }
+
+        void AssetDatabase::queueChangedAsset(const std::filesystem::path& assetPath)
+        {
+            if (assetPath.extension() == META_FILE_EXTENSION)
+            {
+                // Mostly written by our own imports, so never reimport from here or every import would trigger another
+                refreshMeta(assetPath);
+                return;
+            }
+
+            // Also filters out the temporary files editors save through
+            if (!engine::AssetImportPipeline::isImportable(assetPath))
+                return;
+
+            submitImportJob([this, assetPath]() {
+                std::error_code ec;
+                if (!std::filesystem::is_regular_file(assetPath, ec))
+                    return; // Deleted again meanwhile
+
+                // Saves without changes, touches and renames also produce events
+                if (m_ImportPipeline &&
+                    engine::AssetImportPipeline::hashFile(assetPath) == m_ImportPipeline->getContentHash(assetPath))
+                    return;
+
+                VULTRA_CORE_INFO("Reimporting changed asset: {}", assetPath.generic_string());
+                if (!reimportAsset(assetPath))
+                    VULTRA_CORE_ERROR("Failed to reimport asset: {}", assetPath.generic_string());
+            });
+        }
+
+        Ref<rhi::Texture> AssetDatabase::getTextureByUUID(const vasset::VUUID& uuid)
+        {
+            return touchTexture(uuid).texture;
         }
 
         imgui::ImGuiTextureID AssetDatabase::getImGuiTextureByUUID(const vasset::VUUID& uuid)
         {
-            auto uuidStr = uuid.toString();
-            auto it      = m_ImGuiTextures.find(uuidStr);
-            if (it != m_ImGuiTextures.end())
+            auto& residency = touchTexture(uuid);
+            if (residency.state != TextureResidencyState::eReady)
             {
-                return it->second;
+                return nullptr;
             }
 
-            // Load ImGui texture
-            Ref<rhi::Texture> texture = getTextureByUUID(uuid);
-            if (texture && m_RenderDevice)
+            if (!residency.imguiTexture)
             {
-                imgui::ImGuiTextureID imguiTexID = imgui::addTexture(*texture);
-                m_ImGuiTextures[uuid.toString()] = imguiTexID;
-                return imguiTexID;
+                residency.imguiTexture = imgui::addTexture(*residency.texture);
             }
 
+            return residency.imguiTexture;
+        }
+
+        imgui::ImGuiTextureID AssetDatabase::getThumbnailByUUID(const vasset::VUUID&         uuid,
+                                                                const std::filesystem::path& assetPath)
+        {
+            imgui::ImGuiTextureID thumbnail = nullptr;
+            if (m_ThumbnailCache.tryGet(uuid, thumbnail))
+            {
+                return thumbnail;
+            }
+
+            auto sourcePath = assetPath;
+            sourcePath.replace_extension(getMetaExtension(assetPath));
+
+            uint64_t contentHash = m_ImportPipeline ? m_ImportPipeline->getContentHash(sourcePath) : 0;
+            m_ThumbnailCache.request(uuid, sourcePath, contentHash);
+
             return nullptr;
         }
 
@@ -255,29 +602,437 @@ namespace vultra
             s_Instance = nullptr;
         }
 
-        vasset::VUUID AssetDatabase::getMetaUUID(const std::filesystem::path& assetPath)
+        std::optional<AssetMetaRecord> AssetDatabase::getMeta(const std::filesystem::path& assetPath)
         {
-            nlohmann::json j = getMetaJson(assetPath);
+            auto key = toMetaKey(assetPath);
+
+            {
+                std::shared_lock lock(m_MetaIndexMutex);
+                auto             it = m_MetaIndex.find(key);
+                if (it != m_MetaIndex.end())
+                {
+                    if (it->second.uuid.isNil())
+                        return std::nullopt;
+                    return it->second;
+                }
+            }
 
-            if (j.contains("uuid"))
+            // Not indexed yet (e.g. created outside the editor): read it once and remember the result
+            auto record = readMetaRecord(key);
             {
-                auto uuidStr = j["uuid"].get<std::string>();
-                return vasset::VUUID::fromString(uuidStr);
+                std::unique_lock lock(m_MetaIndexMutex);
+                m_MetaIndex[key] = record;
             }
 
-            return vasset::VUUID {};
+            if (record.uuid.isNil())
+                return std::nullopt;
+            return record;
+        }
+
+        vasset::VUUID AssetDatabase::getMetaUUID(const std::filesystem::path& assetPath)
+        {
+            auto record = getMeta(assetPath);
+            return record ? record->uuid : vasset::VUUID {};
         }
 
         std::string AssetDatabase::getMetaExtension(const std::filesystem::path& assetPath)
         {
-            nlohmann::json j = getMetaJson(assetPath);
+            auto record = getMeta(assetPath);
+            return record ? record->extension : std::string {};
+        }
+
+        vasset::VAssetType AssetDatabase::getMetaAssetType(const std::filesystem::path& assetPath)
+        {
+            auto record = getMeta(assetPath);
+            return record ? record->type : vasset::VAssetType {};
+        }
+
+        void AssetDatabase::refreshMeta(const std::filesystem::path& assetPath)
+        {
+            auto key = toMetaKey(assetPath);
+
+            std::error_code ec;
+            if (!std::filesystem::exists(key, ec))
+            {
+                std::unique_lock lock(m_MetaIndexMutex);
+                m_MetaIndex.erase(key);
+                return;
+            }
+
+            std::optional<AssetMetaRecord> cached;
+            {
+                std::shared_lock lock(m_MetaIndexMutex);
+                if (auto it = m_MetaIndex.find(key); it != m_MetaIndex.end())
+                    cached = it->second;
+            }
+
+            auto record = readMetaRecord(key, cached ? &*cached : nullptr);
+
+            std::unique_lock lock(m_MetaIndexMutex);
+            m_MetaIndex[key] = std::move(record);
+        }
+
+        AssetMetaRecord AssetDatabase::readMetaRecord(const std::filesystem::path& metaPath,
+                                                      const AssetMetaRecord*       cached)
+        {
+            AssetMetaRecord record {};
+
+            std::error_code ec;
+            record.mtime = std::filesystem::last_write_time(metaPath, ec);
+            if (ec)
+            {
+                return record;
+            }
+
+            if (cached && cached->mtime == record.mtime)
+            {
+                // Unchanged file, only the type can have moved with a reimport
+                record.uuid      = cached->uuid;
+                record.extension = cached->extension;
+            }
+            else
+            {
+                nlohmann::json j = getMetaJson(metaPath);
+                if (j.contains("uuid") && j["uuid"].is_string())
+                {
+                    record.uuid = vasset::VUUID::fromString(j["uuid"].get<std::string>());
+                }
+                if (j.contains("extension") && j["extension"].is_string())
+                {
+                    record.extension = j["extension"].get<std::string>();
+                }
+            }
+
+            if (!record.uuid.isNil())
+            {
+                record.type = lookupAsset(record.uuid).type;
+            }
+
+            return record;
+        }
+
+        void AssetDatabase::rebuildMetaIndex(const std::filesystem::path& folderPath)
+        {
+            auto folderKey = folderPath.lexically_normal().generic_string();
+            if (!folderKey.ends_with('/'))
+                folderKey += '/';
+
+            // Records of files whose mtime did not change are reused instead of parsed again
+            std::unordered_map<std::string, AssetMetaRecord> cached;
+            {
+                std::shared_lock lock(m_MetaIndexMutex);
+                for (const auto& [key, record] : m_MetaIndex)
+                {
+                    if (key.starts_with(folderKey))
+                        cached.emplace(key, record);
+                }
+            }
+
+            std::unordered_map<std::string, AssetMetaRecord> records;
+
+            std::error_code ec;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(folderPath, ec))
+            {
+                if (entry.is_regular_file() && entry.path().extension() == META_FILE_EXTENSION)
+                {
+                    auto key     = toMetaKey(entry.path());
+                    auto it      = cached.find(key);
+                    records[key] = readMetaRecord(key, it != cached.end() ? &it->second : nullptr);
+                }
+            }
+
+            std::unique_lock lock(m_MetaIndexMutex);
+
+            // Replace everything below the folder, including entries for files that disappeared
+            std::erase_if(m_MetaIndex, [&folderKey](const auto& kv) { return kv.first.starts_with(folderKey); });
+            m_MetaIndex.merge(records);
+        }
+
+        AssetDatabase::TextureResidency& AssetDatabase::touchTexture(const vasset::VUUID& uuid)
+        {
+            auto  uuidStr   = uuid.toString();
+            auto& residency = m_Textures[uuidStr];
+
+            residency.lastUsedFrame = m_FrameIndex;
+            if (residency.state == TextureResidencyState::eUnloaded)
+            {
+                requestTextureLoad(uuidStr, residency);
+            }
+
+            return residency;
+        }
+
+        void AssetDatabase::requestTextureLoad(const std::string& uuidStr, TextureResidency& residency)
+        {
+            auto entry = lookupAsset(vasset::VUUID::fromString(uuidStr));
+            if (entry.type != vasset::VAssetType::eTexture || entry.path.empty())
+            {
+                residency.state = TextureResidencyState::eFailed;
+                return;
+            }
+
+            residency.state = TextureResidencyState::eQueued;
+
+            {
+                std::lock_guard lock(m_LoaderMutex);
+                m_LoadRequests.push_back({uuidStr, m_Paths.importedDir / entry.path});
+            }
+            m_LoaderCondition.notify_one();
+        }
+
+        void AssetDatabase::uploadReadyTextures()
+        {
+            std::vector<DecodedTexture> ready;
+            {
+                std::lock_guard lock(m_LoaderMutex);
+                ready.swap(m_ReadyForUpload);
+            }
+
+            if (ready.empty())
+                return;
+
+            const auto start = std::chrono::steady_clock::now();
+
+            size_t uploaded = 0;
+            for (; uploaded < ready.size(); ++uploaded)
+            {
+                // Everything left is a copy, so at least one upload per frame keeps the queue moving
+                if (uploaded > 0 && std::chrono::steady_clock::now() - start > TEXTURE_UPLOAD_BUDGET)
+                    break;
+
+                auto& decoded = ready[uploaded];
+
+                auto it = m_Textures.find(decoded.request.uuidStr);
+                if (it == m_Textures.end() || it->second.state != TextureResidencyState::eQueued)
+                    continue; // Invalidated or evicted while queued
+
+                Ref<rhi::Texture> texture {nullptr};
+                uint64_t          bytes {0};
+                if (decoded.pixels)
+                {
+                    VULTRA_PROFILE_SCOPE("Upload Texture");
+
+                    const uint32_t mipLevels = getMipLevelCount(decoded.width, decoded.height);
+
+                    texture = createRef<rhi::Texture>(
+                        rhi::Texture::Builder {}
+                            .setExtent({.width = decoded.width, .height = decoded.height})
+                            .setPixelFormat(rhi::PixelFormat::eRGBA8_UNorm)
+                            .setNumMipLevels(mipLevels)
+                            .setUsageFlags(rhi::ImageUsage::eTransferDst | rhi::ImageUsage::eTransferSrc |
+                                           rhi::ImageUsage::eSampled)
+                            .setupOptimalSampler(true)
+                            .build(*m_RenderDevice));
+
+                    auto stagingBuffer = m_RenderDevice->createStagingBuffer(
+                        static_cast<uint64_t>(decoded.width) * decoded.height * 4, decoded.pixels.get());
+                    m_RenderDevice->execute([&](rhi::CommandBuffer& cb) {
+                        cb.copyBuffer(stagingBuffer, *texture);
+                        cb.generateMipmaps(*texture);
+                    });
+
+                    bytes = getMipChainBytes(decoded.width, decoded.height, mipLevels, 4);
+                }
+                else
+                {
+                    VULTRA_PROFILE_SCOPE("Load Texture");
+
+                    // Containers stb_image cannot read (GPU-ready formats); we don't use resource::loadResource here,
+                    // its cache would keep evicted textures alive
+                    gfx::TextureLoader textureLoader {};
+                    texture = textureLoader(decoded.request.path.generic_string(), *m_RenderDevice);
+
+                    // These already hold every mip in the format they are uploaded in
+                    bytes = decoded.fileBytes;
+                }
+
+                if (!texture)
+                {
+                    VULTRA_CORE_ERROR("Failed to load texture asset: {}", decoded.request.path.generic_string());
+                    it->second.state = TextureResidencyState::eFailed;
+                    continue;
+                }
+
+                auto& residency   = it->second;
+                residency.texture = texture;
+                residency.bytes   = bytes;
+                residency.state   = TextureResidencyState::eReady;
+
+                m_ResidentTextureBytes += residency.bytes;
+                engine::MemoryTracker::onAllocate(engine::MemoryTag::eGPUTextures, residency.bytes);
+                m_ContentGeneration.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // Leftovers go back to the front of the queue for the next frame
+            if (uploaded < ready.size())
+            {
+                std::lock_guard lock(m_LoaderMutex);
+                m_ReadyForUpload.insert(m_ReadyForUpload.begin(),
+                                        std::make_move_iterator(ready.begin() + uploaded),
+                                        std::make_move_iterator(ready.end()));
+            }
+        }
+
+        void AssetDatabase::applyTextureInvalidations()
+        {
+            std::vector<std::string> invalidations;
+            {
+                std::lock_guard lock(m_LoaderMutex);
+                invalidations.swap(m_PendingInvalidations);
+            }
+
+            for (const auto& uuidStr : invalidations)
+            {
+                auto it = m_Textures.find(uuidStr);
+                if (it == m_Textures.end())
+                    continue;
+
+                // Drop the old version; the next request reloads it, which hot-swaps visible textures
+                retireTexture(it->second);
+                it->second.state = TextureResidencyState::eUnloaded;
+            }
+
+            for (const auto& uuidStr : invalidations)
+            {
+                m_ThumbnailCache.invalidate(vasset::VUUID::fromString(uuidStr));
+            }
+        }
+
+        void AssetDatabase::evictColdTextures()
+        {
+            const uint64_t budgetBytes = getTextureBudget();
+            if (budgetBytes == 0 || m_ResidentTextureBytes <= budgetBytes)
+                return;
+
+            // Least recently used first, never touching anything used in the last few frames
+            std::vector<std::pair<uint64_t, TextureResidency*>> candidates;
+            for (auto& [uuidStr, residency] : m_Textures)
+            {
+                if (residency.state == TextureResidencyState::eReady &&
+                    residency.lastUsedFrame + TEXTURE_RETIRE_FRAMES < m_FrameIndex)
+                {
+                    candidates.emplace_back(residency.lastUsedFrame, &residency);
+                }
+            }
+
+            std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+                return a.first < b.first;
+            });
+
+            for (auto& [lastUsedFrame, residency] : candidates)
+            {
+                if (m_ResidentTextureBytes <= budgetBytes)
+                    break;
+
+                retireTexture(*residency);
+                residency->state = TextureResidencyState::eUnloaded;
+            }
+        }
+
+        void AssetDatabase::retireTexture(TextureResidency& residency)
+        {
+            if (residency.texture || residency.imguiTexture)
+            {
+                m_RetiredTextures.push_back({residency.texture, residency.imguiTexture, m_FrameIndex});
+            }
+
+            const uint64_t bytes = std::min(m_ResidentTextureBytes, residency.bytes);
+            m_ResidentTextureBytes -= bytes;
+            engine::MemoryTracker::onFree(engine::MemoryTag::eGPUTextures, bytes);
+
+            residency.texture      = nullptr;
+            residency.imguiTexture = nullptr;
+            residency.bytes        = 0;
+        }
+
+        void AssetDatabase::destroyRetiredTextures(bool force)
+        {
+            std::erase_if(m_RetiredTextures, [this, force](const RetiredTexture& retired) {
+                if (!force && retired.retiredFrame + TEXTURE_RETIRE_FRAMES > m_FrameIndex)
+                    return false;
+
+                if (retired.imguiTexture)
+                    imgui::removeTexture(*m_RenderDevice, retired.imguiTexture);
+                return true;
+            });
+        }
+
+        void AssetDatabase::invalidateTexture(const std::string& uuidStr)
+        {
+            std::lock_guard lock(m_LoaderMutex);
+            m_PendingInvalidations.push_back(uuidStr);
+        }
+
+        void AssetDatabase::loaderThreadLoop()
+        {
+            engine::TraceRecorder::setThreadName("Texture Loader");
+            engine::MemoryTracker::setThreadTag(engine::MemoryTag::eAssets);
 
-            if (j.contains("extension"))
+            while (true)
             {
-                return j["extension"].get<std::string>();
+                DecodedTexture decoded;
+                {
+                    std::unique_lock lock(m_LoaderMutex);
+                    m_LoaderCondition.wait(lock, [this]() { return m_StopLoader || !m_LoadRequests.empty(); });
+
+                    if (m_StopLoader)
+                        return;
+
+                    decoded.request = std::move(m_LoadRequests.front());
+                    m_LoadRequests.pop_front();
+                }
+
+                // Decode here so the main thread only records the copy. HDR and GPU-ready containers are left to
+                // gfx::TextureLoader on the main thread, see uploadReadyTextures().
+                {
+                    VULTRA_PROFILE_SCOPE("Decode Texture");
+
+                    const auto pathString = decoded.request.path.string();
+
+                    std::error_code ec;
+                    decoded.fileBytes = std::filesystem::file_size(decoded.request.path, ec);
+                    if (ec)
+                        decoded.fileBytes = 0;
+
+                    int width    = 0;
+                    int height   = 0;
+                    int channels = 0;
+                    if (!stbi_is_hdr(pathString.c_str()) &&
+                        stbi_info(pathString.c_str(), &width, &height, &channels))
+                    {
+                        decoded.pixels = {stbi_load(pathString.c_str(), &width, &height, &channels, 4),
+                                          stbi_image_free};
+                        decoded.width  = static_cast<uint32_t>(width);
+                        decoded.height = static_cast<uint32_t>(height);
+                    }
+                }
+
+                {
+                    std::lock_guard lock(m_LoaderMutex);
+                    m_ReadyForUpload.push_back(std::move(decoded));
+                }
             }
+        }
 
-            return {};
+        void AssetDatabase::stopLoaderThread()
+        {
+            {
+                std::lock_guard lock(m_LoaderMutex);
+                m_StopLoader = true;
+                m_LoadRequests.clear();
+                m_ReadyForUpload.clear();
+            }
+            m_LoaderCondition.notify_all();
+
+            if (m_LoaderThread.joinable())
+                m_LoaderThread.join();
+        }
+
+        std::string AssetDatabase::toMetaKey(const std::filesystem::path& assetPath)
+        {
+            auto metaPath = assetPath;
+            metaPath.replace_extension(META_FILE_EXTENSION);
+            return metaPath.lexically_normal().generic_string();
         }
 
         nlohmann::json AssetDatabase::getMetaJson(const std::filesystem::path& assetPath)
@@ -291,9 +1046,12 @@ namespace vultra
                 return nlohmann::json {};
             }
 
-            nlohmann::json j;
-            inFile >> j;
-            inFile.close();
+            // A half-written or hand-edited meta file is treated like a missing one
+            auto j = nlohmann::json::parse(inFile, nullptr, false);
+            if (j.is_discarded() || !j.is_object())
+            {
+                return nlohmann::json {};
+            }
             return j;
         }
     } // namespace editor
@@ -0,0 +1,100 @@
+#include "vultra_editor/asset/asset_directory_tree.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+namespace vultra
+{
+    namespace editor
+    {
+        namespace
+        {
+            std::string toPathKey(const std::filesystem::path& path)
+            {
+                return path.lexically_normal().generic_string();
+            }
+
+            bool lessCaseInsensitive(const std::string& a, const std::string& b)
+            {
+                return std::lexicographical_compare(
+                    a.begin(), a.end(), b.begin(), b.end(), [](unsigned char lhs, unsigned char rhs) {
+                        return std::tolower(lhs) < std::tolower(rhs);
+                    });
+            }
+        } // namespace
+
+        void AssetDirectoryTree::build(const std::filesystem::path& rootPath)
+        {
+            m_Nodes.clear();
+            m_PathToIndex.clear();
+
+            std::error_code ec;
+            if (!std::filesystem::is_directory(rootPath, ec))
+            {
+                return;
+            }
+
+            addNode(rootPath, true, AssetDirectoryNode::INVALID_INDEX);
+            scanDirectory(0);
+        }
+
+        const AssetDirectoryNode* AssetDirectoryTree::find(const std::filesystem::path& path) const
+        {
+            auto it = m_PathToIndex.find(toPathKey(path));
+            return it != m_PathToIndex.end() ? &m_Nodes[it->second] : nullptr;
+        }
+
+        uint32_t AssetDirectoryTree::addNode(const std::filesystem::path& path, bool isDirectory, uint32_t parent)
+        {
+            const auto index = static_cast<uint32_t>(m_Nodes.size());
+
+            auto& node       = m_Nodes.emplace_back();
+            node.path        = path;
+            node.name        = path.filename().string();
+            node.stem        = path.stem().string();
+            node.isDirectory = isDirectory;
+            node.parent      = parent;
+
+            m_PathToIndex.emplace(toPathKey(path), index);
+            return index;
+        }
+
+        void AssetDirectoryTree::scanDirectory(uint32_t dirIndex)
+        {
+            // One directory_iterator pass per folder; the entry already carries the file type on every platform we
+            // care about, so no extra stat() per entry.
+            std::vector<std::pair<std::filesystem::path, bool>> entries;
+
+            std::error_code ec;
+            for (const auto& entry : std::filesystem::directory_iterator(m_Nodes[dirIndex].path, ec))
+            {
+                entries.emplace_back(entry.path(), entry.is_directory(ec));
+            }
+
+            std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+                if (a.second != b.second)
+                    return a.second; // Directories first
+                return lessCaseInsensitive(a.first.filename().string(), b.first.filename().string());
+            });
+
+            std::vector<uint32_t> children;
+            children.reserve(entries.size());
+            for (const auto& [path, isDirectory] : entries)
+            {
+                children.push_back(addNode(path, isDirectory, dirIndex));
+            }
+
+            // m_Nodes may have reallocated, so only index from here on
+            m_Nodes[dirIndex].children = children;
+
+            for (uint32_t child : children)
+            {
+                if (m_Nodes[child].isDirectory)
+                {
+                    m_Nodes[dirIndex].hasSubdirectories = true;
+                    scanDirectory(child);
+                }
+            }
+        }
+    } // namespace editor
+} // namespace vultra
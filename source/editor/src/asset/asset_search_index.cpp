@@ -0,0 +1,416 @@
+#include "vultra_editor/asset/asset_search_index.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <iterator>
+
+namespace vultra
+{
+    namespace editor
+    {
+        namespace
+        {
+            constexpr const char* META_FILE_EXTENSION = ".vmeta";
+            // Typo tolerant candidates are only gathered when exact matches are this scarce
+            constexpr size_t TYPO_PASS_THRESHOLD = 64;
+
+            struct TypeAlias
+            {
+                const char*        name;
+                vasset::VAssetType type;
+            };
+
+            constexpr std::array TYPE_ALIASES = {
+                TypeAlias {"texture", vasset::VAssetType::eTexture},
+                TypeAlias {"tex", vasset::VAssetType::eTexture},
+                TypeAlias {"image", vasset::VAssetType::eTexture},
+                TypeAlias {"mesh", vasset::VAssetType::eMesh},
+                TypeAlias {"model", vasset::VAssetType::eMesh},
+                TypeAlias {"material", vasset::VAssetType::eMaterial},
+                TypeAlias {"mat", vasset::VAssetType::eMaterial},
+            };
+
+            std::string toLower(std::string_view text)
+            {
+                std::string result(text);
+                std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) {
+                    return static_cast<char>(std::tolower(c));
+                });
+                return result;
+            }
+
+            uint32_t packTrigram(const char* p)
+            {
+                return static_cast<uint32_t>(static_cast<uint8_t>(p[0])) |
+                       static_cast<uint32_t>(static_cast<uint8_t>(p[1])) << 8 |
+                       static_cast<uint32_t>(static_cast<uint8_t>(p[2])) << 16;
+            }
+
+            void collectTrigrams(std::string_view text, std::vector<uint32_t>& outTrigrams)
+            {
+                outTrigrams.clear();
+                for (size_t i = 0; i + 3 <= text.size(); ++i)
+                    outTrigrams.push_back(packTrigram(text.data() + i));
+
+                std::sort(outTrigrams.begin(), outTrigrams.end());
+                outTrigrams.erase(std::unique(outTrigrams.begin(), outTrigrams.end()), outTrigrams.end());
+            }
+
+            // One bit per letter and digit, the rest share the remaining bits
+            uint64_t toCharMask(std::string_view text)
+            {
+                uint64_t mask = 0;
+                for (unsigned char c : text)
+                {
+                    if (c >= 'a' && c <= 'z')
+                        mask |= 1ull << (c - 'a');
+                    else if (c >= '0' && c <= '9')
+                        mask |= 1ull << (26 + c - '0');
+                    else
+                        mask |= 1ull << (36 + c % 28);
+                }
+                return mask;
+            }
+
+            // Enough shared trigrams to count as a typo of the term
+            bool isSimilar(size_t sharedTrigrams, size_t termTrigrams) { return sharedTrigrams * 2 >= termTrigrams; }
+
+            // < 0 if name does not match term. Both are lowercase.
+            int32_t scoreTerm(std::string_view name, std::string_view term, bool allowTypos)
+            {
+                // Subsequence first: it is the cheapest test and every better match is also a subsequence. Every
+                // jump between matched characters costs, e.g. "hlmt" in "helmet".
+                size_t  matched = 0;
+                size_t  first   = std::string_view::npos;
+                size_t  last    = 0;
+                int32_t gaps    = 0;
+                for (size_t i = 0; i < name.size() && matched < term.size(); ++i)
+                {
+                    if (name[i] != term[matched])
+                        continue;
+
+                    if (first == std::string_view::npos)
+                        first = i;
+                    else if (i != last + 1)
+                        ++gaps;
+
+                    last = i;
+                    ++matched;
+                }
+
+                if (matched == term.size())
+                {
+                    const auto lengthPenalty = static_cast<int32_t>(std::min<size_t>(name.size() - term.size(), 100));
+
+                    if (gaps == 0 && first == 0)
+                        return name.size() == term.size() ? 1000 : 800 - lengthPenalty;
+
+                    const size_t pos = gaps == 0 ? first : name.find(term, first);
+                    if (pos != std::string_view::npos)
+                        return 600 - static_cast<int32_t>(std::min<size_t>(pos, 100)) * 2 - lengthPenalty;
+
+                    return std::max(1, 300 - gaps * 16 - static_cast<int32_t>(std::min<size_t>(first, 100)));
+                }
+
+                // Trigram similarity catches typos such as "helemt"
+                if (allowTypos && term.size() >= 3)
+                {
+                    size_t shared = 0;
+                    for (size_t i = 0; i + 3 <= term.size(); ++i)
+                    {
+                        if (name.find(term.substr(i, 3)) != std::string_view::npos)
+                            ++shared;
+                    }
+
+                    const size_t total = term.size() - 2;
+                    if (isSimilar(shared, total))
+                        return std::max<int32_t>(1, static_cast<int32_t>(100 * shared / total));
+                }
+
+                return -1;
+            }
+        } // namespace
+
+        AssetSearchQuery AssetSearchQuery::parse(std::string_view text)
+        {
+            AssetSearchQuery query;
+
+            size_t pos = 0;
+            while (pos < text.size())
+            {
+                while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+                    ++pos;
+
+                size_t end = pos;
+                while (end < text.size() && !std::isspace(static_cast<unsigned char>(text[end])))
+                    ++end;
+
+                if (end == pos)
+                    break;
+
+                std::string token = toLower(text.substr(pos, end - pos));
+                pos               = end;
+
+                std::string_view typeName;
+                if (token.starts_with("t:"))
+                    typeName = std::string_view(token).substr(2);
+                else if (token.starts_with("type:"))
+                    typeName = std::string_view(token).substr(5);
+                else
+                {
+                    query.terms.push_back(std::move(token));
+                    continue;
+                }
+
+                if (typeName.empty())
+                    continue; // Still being typed
+
+                auto it = std::find_if(TYPE_ALIASES.begin(), TYPE_ALIASES.end(), [typeName](const TypeAlias& alias) {
+                    return typeName == alias.name;
+                });
+                if (it != TYPE_ALIASES.end())
+                    query.type = it->type;
+                else
+                    query.unknownType = true;
+            }
+
+            return query;
+        }
+
+        void AssetSearchIndex::build(std::shared_ptr<const AssetDirectoryTree> tree, const TypeResolver& resolveType)
+        {
+            m_Tree = std::move(tree);
+            m_Entries.clear();
+            m_Names.clear();
+            m_NodeOrderBegin.clear();
+            m_NodeOrderEnd.clear();
+            m_Trigrams.clear();
+
+            if (!m_Tree || m_Tree->empty())
+                return;
+
+            const auto& nodes = m_Tree->getNodes();
+            m_NodeOrderBegin.resize(nodes.size());
+            m_NodeOrderEnd.resize(nodes.size());
+
+            // Pre-order walk: a subtree is then a contiguous [begin, end) range, so scoping a query is two compares
+            uint32_t                                 order = 0;
+            std::vector<std::pair<uint32_t, size_t>> stack; // Node, next child
+            stack.emplace_back(0, 0);
+            m_NodeOrderBegin[0] = order++;
+
+            std::vector<uint32_t> trigrams;
+            while (!stack.empty())
+            {
+                auto& [nodeIndex, nextChild] = stack.back();
+                const auto& node             = nodes[nodeIndex];
+
+                if (nextChild == node.children.size())
+                {
+                    m_NodeOrderEnd[nodeIndex] = order;
+                    stack.pop_back();
+                    continue;
+                }
+
+                const uint32_t childIndex    = node.children[nextChild++];
+                const auto&    child         = nodes[childIndex];
+                m_NodeOrderBegin[childIndex] = order++;
+
+                if (child.isDirectory)
+                {
+                    stack.emplace_back(childIndex, 0); // Invalidates node, nextChild
+                    continue;
+                }
+
+                m_NodeOrderEnd[childIndex] = m_NodeOrderBegin[childIndex] + 1;
+
+                // Only imported assets are listed by the browser
+                if (child.path.extension() != META_FILE_EXTENSION)
+                    continue;
+
+                const auto  entryIndex = static_cast<uint32_t>(m_Entries.size());
+                std::string name       = toLower(child.stem);
+
+                auto& entry      = m_Entries.emplace_back();
+                entry.nodeIndex  = childIndex;
+                entry.order      = m_NodeOrderBegin[childIndex];
+                entry.nameOffset = static_cast<uint32_t>(m_Names.size());
+                entry.nameLength = static_cast<uint32_t>(name.size());
+                entry.charMask   = toCharMask(name);
+                entry.type       = resolveType ? resolveType(child.path) : vasset::VAssetType {};
+                m_Names += name;
+
+                // Entries are added in increasing order, so posting lists stay sorted
+                collectTrigrams(name, trigrams);
+                for (uint32_t trigram : trigrams)
+                    m_Trigrams[trigram].push_back(entryIndex);
+            }
+        }
+
+        std::vector<AssetSearchResult>
+        AssetSearchIndex::search(const AssetSearchQuery& query, uint32_t scopeNodeIndex, size_t maxResults) const
+        {
+            std::vector<AssetSearchResult> results;
+            if (query.empty() || query.unknownType || m_Entries.empty() || scopeNodeIndex >= m_NodeOrderBegin.size())
+                return results;
+
+            const uint32_t scopeBegin = m_NodeOrderBegin[scopeNodeIndex];
+            const uint32_t scopeEnd   = m_NodeOrderEnd[scopeNodeIndex];
+
+            // Entries are stored in pre-order too, so the scope is also a contiguous entry range for scans
+            auto byOrder = [](const Entry& entry, uint32_t order) { return entry.order < order; };
+            const auto scanBegin = static_cast<uint32_t>(
+                std::lower_bound(m_Entries.begin(), m_Entries.end(), scopeBegin, byOrder) - m_Entries.begin());
+            const auto scanEnd = static_cast<uint32_t>(
+                std::lower_bound(m_Entries.begin(), m_Entries.end(), scopeEnd, byOrder) - m_Entries.begin());
+
+            // Best score first, ties in tree order; plain integers keep the final sort cheap
+            std::vector<uint64_t> matches;
+
+            // Linear scans pass a character mask and match by subsequence only; typos are found through trigrams
+            auto tryEntry = [&](uint32_t entryIndex, uint64_t requiredChars, bool allowTypos) {
+                const auto& entry = m_Entries[entryIndex];
+                if ((entry.charMask & requiredChars) != requiredChars)
+                    return;
+                if (!matchesFilters(entry, query, scopeBegin, scopeEnd))
+                    return;
+
+                const int32_t score = scoreEntry(entry, query, allowTypos);
+                if (score >= 0)
+                    matches.push_back(static_cast<uint64_t>(INT32_MAX - score) << 32 | entryIndex);
+            };
+
+            // The longest term drives candidate generation, the others are checked by scoreEntry
+            const std::string* driver = nullptr;
+            for (const auto& term : query.terms)
+            {
+                if (term.size() >= 3 && (!driver || term.size() > driver->size()))
+                    driver = &term;
+            }
+
+            if (!driver)
+            {
+                // Only short terms or a type: substring and subsequence matches need every character of every term
+                uint64_t requiredChars = 0;
+                for (const auto& term : query.terms)
+                    requiredChars |= toCharMask(term);
+
+                for (uint32_t entryIndex = scanBegin; entryIndex < scanEnd; ++entryIndex)
+                {
+                    tryEntry(entryIndex, requiredChars, false);
+
+                    // Without terms every match scores the same and tree order decides, so the first ones win
+                    if (query.terms.empty() && matches.size() == maxResults)
+                        break;
+                }
+            }
+            else
+            {
+                std::vector<uint32_t> trigrams;
+                collectTrigrams(*driver, trigrams);
+
+                std::vector<const std::vector<uint32_t>*> postings;
+                for (uint32_t trigram : trigrams)
+                {
+                    auto it = m_Trigrams.find(trigram);
+                    if (it != m_Trigrams.end())
+                        postings.push_back(&it->second);
+                }
+
+                // Exact pass: names containing every trigram of the term, intersecting from the shortest list
+                if (postings.size() == trigrams.size())
+                {
+                    std::sort(postings.begin(), postings.end(), [](const auto* a, const auto* b) {
+                        return a->size() < b->size();
+                    });
+
+                    std::vector<uint32_t> candidates = *postings.front();
+                    std::vector<uint32_t> intersection;
+                    for (size_t i = 1; i < postings.size() && !candidates.empty(); ++i)
+                    {
+                        intersection.clear();
+                        std::set_intersection(candidates.begin(),
+                                              candidates.end(),
+                                              postings[i]->begin(),
+                                              postings[i]->end(),
+                                              std::back_inserter(intersection));
+                        candidates.swap(intersection);
+                    }
+
+                    for (uint32_t entryIndex : candidates)
+                        tryEntry(entryIndex, 0, true);
+                }
+
+                // Typo pass, only when the exact pass found little: names sharing enough but not all trigrams
+                if (matches.size() < TYPO_PASS_THRESHOLD && !postings.empty())
+                {
+                    std::vector<uint16_t> sharedCounts(m_Entries.size(), 0);
+                    std::vector<uint32_t> touched;
+                    for (const auto* posting : postings)
+                    {
+                        for (uint32_t entryIndex : *posting)
+                        {
+                            if (sharedCounts[entryIndex]++ == 0)
+                                touched.push_back(entryIndex);
+                        }
+                    }
+
+                    for (uint32_t entryIndex : touched)
+                    {
+                        const size_t shared = sharedCounts[entryIndex];
+                        if (shared < trigrams.size() && isSimilar(shared, trigrams.size()))
+                            tryEntry(entryIndex, 0, true);
+                    }
+                }
+
+                // Abbreviations such as "hlmt" share no trigram with their target, so they need a (masked) scan
+                if (matches.empty())
+                {
+                    const uint64_t requiredChars = toCharMask(*driver);
+                    for (uint32_t entryIndex = scanBegin; entryIndex < scanEnd; ++entryIndex)
+                        tryEntry(entryIndex, requiredChars, false);
+                }
+            }
+
+            const size_t count = std::min(matches.size(), maxResults);
+            std::nth_element(matches.begin(), matches.begin() + count, matches.end());
+            std::sort(matches.begin(), matches.begin() + count);
+
+            results.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto entryIndex = static_cast<uint32_t>(matches[i] & UINT32_MAX);
+                const auto score      = INT32_MAX - static_cast<int32_t>(matches[i] >> 32);
+                results.push_back({m_Entries[entryIndex].nodeIndex, score});
+            }
+
+            return results;
+        }
+
+        bool AssetSearchIndex::matchesFilters(const Entry&            entry,
+                                              const AssetSearchQuery& query,
+                                              uint32_t                scopeBegin,
+                                              uint32_t                scopeEnd) const
+        {
+            if (entry.order < scopeBegin || entry.order >= scopeEnd)
+                return false;
+
+            return !query.type || entry.type == *query.type;
+        }
+
+        int32_t AssetSearchIndex::scoreEntry(const Entry& entry, const AssetSearchQuery& query, bool allowTypos) const
+        {
+            const auto name  = getName(entry);
+            int32_t    total = 0;
+            for (const auto& term : query.terms)
+            {
+                const int32_t score = scoreTerm(name, term, allowTypos);
+                if (score < 0)
+                    return -1;
+                total += score;
+            }
+            return total;
+        }
+    } // namespace editor
+} // namespace vultra
@@ -0,0 +1,281 @@
+#include "vultra_editor/asset/asset_watcher.hpp"
+
+#include <vultra/core/base/common_context.hpp>
+
+#include <algorithm>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+namespace vultra
+{
+    namespace editor
+    {
+        // A path has to be quiet this long before it is reported
+        constexpr auto WATCH_DEBOUNCE = std::chrono::milliseconds(300);
+        // Upper bound for how long the thread blocks, which is also the stop latency
+        constexpr auto WATCH_TICK = std::chrono::milliseconds(50);
+        // Polling fallback only
+        constexpr auto WATCH_POLL_INTERVAL = std::chrono::seconds(1);
+
+        AssetWatcher::~AssetWatcher() { stop(); }
+
+        void AssetWatcher::start(const std::filesystem::path& rootDir, ChangeCallback callback)
+        {
+            stop();
+
+            m_RootDir  = rootDir;
+            m_Callback = std::move(callback);
+            m_Stop     = false;
+            m_Pending.clear();
+            m_PollSnapshot.clear();
+            m_LastPoll = {};
+
+            m_Thread = std::thread([this]() { threadLoop(); });
+        }
+
+        void AssetWatcher::stop()
+        {
+            m_Stop = true;
+            if (m_Thread.joinable())
+                m_Thread.join();
+        }
+
+        void AssetWatcher::threadLoop()
+        {
+#ifdef __linux__
+            if (!openInotify())
+            {
+                VULTRA_CORE_WARN("inotify is not available, polling {} for changes instead",
+                                 m_RootDir.generic_string());
+            }
+#endif
+
+            while (!m_Stop)
+            {
+#ifdef __linux__
+                if (m_InotifyFd >= 0)
+                {
+                    pollfd pfd {m_InotifyFd, POLLIN, 0};
+                    if (::poll(&pfd, 1, static_cast<int>(WATCH_TICK.count())) > 0)
+                        readInotifyEvents();
+
+                    flushQuietChanges();
+                    continue;
+                }
+#endif
+
+                std::this_thread::sleep_for(WATCH_TICK);
+                if (Clock::now() - m_LastPoll >= WATCH_POLL_INTERVAL)
+                    pollChanges();
+
+                flushQuietChanges();
+            }
+
+#ifdef __linux__
+            closeInotify();
+#endif
+        }
+
+        void AssetWatcher::record(const std::filesystem::path& path, AssetChangeType type, bool isDirectory)
+        {
+            // Later events win: a file that is deleted and written again within the window is just modified
+            auto& pending     = m_Pending[path.lexically_normal().generic_string()];
+            pending.change    = {path, type, isDirectory};
+            pending.lastEvent = Clock::now();
+        }
+
+        void AssetWatcher::flushQuietChanges()
+        {
+            if (m_Pending.empty())
+                return;
+
+            const auto now = Clock::now();
+
+            std::vector<AssetChange> changes;
+            std::erase_if(m_Pending, [&changes, now](auto& kv) {
+                if (now - kv.second.lastEvent < WATCH_DEBOUNCE)
+                    return false;
+
+                changes.push_back(std::move(kv.second.change));
+                return true;
+            });
+
+            if (changes.empty() || !m_Callback)
+                return;
+
+            std::sort(changes.begin(), changes.end(), [](const AssetChange& a, const AssetChange& b) {
+                return a.path < b.path;
+            });
+            m_Callback(std::move(changes));
+        }
+
+#ifdef __linux__
+        bool AssetWatcher::openInotify()
+        {
+            m_InotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (m_InotifyFd < 0)
+                return false;
+
+            addWatchRecursive(m_RootDir);
+            return true;
+        }
+
+        void AssetWatcher::closeInotify()
+        {
+            if (m_InotifyFd >= 0)
+                ::close(m_InotifyFd);
+
+            m_InotifyFd = -1;
+            m_WatchDirs.clear();
+        }
+
+        void AssetWatcher::addWatchRecursive(const std::filesystem::path& dirPath)
+        {
+            // Saves are reported once the file is closed or renamed into place, never halfway through a write
+            constexpr uint32_t WATCH_MASK =
+                IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_DELETE_SELF;
+
+            const int wd = inotify_add_watch(m_InotifyFd, dirPath.c_str(), WATCH_MASK);
+            if (wd < 0)
+            {
+                VULTRA_CORE_WARN("Failed to watch {} (errno {}), raise fs.inotify.max_user_watches if this is ENOSPC",
+                                 dirPath.generic_string(),
+                                 errno);
+                return;
+            }
+            m_WatchDirs[wd] = dirPath;
+
+            std::error_code ec;
+            for (const auto& entry : std::filesystem::directory_iterator(dirPath, ec))
+            {
+                if (entry.is_directory(ec) && !entry.is_symlink(ec))
+                    addWatchRecursive(entry.path());
+            }
+        }
+
+        void AssetWatcher::readInotifyEvents()
+        {
+            alignas(inotify_event) char buffer[16 * 1024];
+
+            while (true)
+            {
+                const ssize_t length = ::read(m_InotifyFd, buffer, sizeof(buffer));
+                if (length <= 0)
+                    break; // EAGAIN, drained
+
+                for (const char* ptr = buffer; ptr < buffer + length;)
+                {
+                    const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+                    ptr += sizeof(inotify_event) + event->len;
+
+                    if (event->mask & IN_Q_OVERFLOW)
+                    {
+                        // Events were dropped, let the consumer rescan everything
+                        VULTRA_CORE_WARN("inotify queue overflowed, rescanning {}", m_RootDir.generic_string());
+                        record(m_RootDir, AssetChangeType::eModified, true);
+                        continue;
+                    }
+
+                    auto it = m_WatchDirs.find(event->wd);
+                    if (it == m_WatchDirs.end())
+                        continue;
+
+                    if (event->mask & IN_IGNORED)
+                    {
+                        m_WatchDirs.erase(it);
+                        continue;
+                    }
+
+                    // Events about the watched folder itself are also reported by its parent
+                    if (event->len == 0)
+                        continue;
+
+                    const auto path        = it->second / event->name;
+                    const bool isDirectory = (event->mask & IN_ISDIR) != 0;
+
+                    if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                    {
+                        if (isDirectory && (event->mask & IN_MOVED_FROM))
+                        {
+                            // The watches follow the folder, so drop them; IN_MOVED_TO re-adds them under the new path
+                            const auto prefix = path.generic_string();
+                            std::erase_if(m_WatchDirs, [this, &prefix](const auto& kv) {
+                                const auto dir = kv.second.generic_string();
+                                if (dir != prefix && !dir.starts_with(prefix + "/"))
+                                    return false;
+
+                                inotify_rm_watch(m_InotifyFd, kv.first);
+                                return true;
+                            });
+                        }
+
+                        record(path, AssetChangeType::eRemoved, isDirectory);
+                    }
+                    else if (isDirectory)
+                    {
+                        // New or moved-in folder: watch it and report it as a whole, since files may have landed in
+                        // it before the watch existed
+                        addWatchRecursive(path);
+                        record(path, AssetChangeType::eModified, true);
+                    }
+                    else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+                    {
+                        // IN_CREATE on a file is always followed by IN_CLOSE_WRITE
+                        record(path, AssetChangeType::eModified, false);
+                    }
+                }
+            }
+        }
+#endif
+
+        void AssetWatcher::pollChanges()
+        {
+            const bool initialScan = m_LastPoll == Clock::time_point {};
+
+            std::unordered_map<std::string, std::pair<uintmax_t, std::filesystem::file_time_type>> snapshot;
+            snapshot.reserve(m_PollSnapshot.size());
+
+            std::error_code ec;
+            for (auto it = std::filesystem::recursive_directory_iterator(
+                     m_RootDir, std::filesystem::directory_options::skip_permission_denied, ec);
+                 !ec && it != std::filesystem::recursive_directory_iterator();
+                 it.increment(ec))
+            {
+                // A file vanishing mid-scan must not end the iteration, so it gets its own error code
+                std::error_code fileEc;
+                if (!it->is_regular_file(fileEc))
+                    continue;
+
+                const auto key   = it->path().generic_string();
+                const auto state = std::make_pair(it->file_size(fileEc), it->last_write_time(fileEc));
+
+                if (!initialScan)
+                {
+                    auto previous = m_PollSnapshot.find(key);
+                    if (previous == m_PollSnapshot.end() || previous->second != state)
+                        record(it->path(), AssetChangeType::eModified, false);
+                }
+
+                snapshot.emplace(key, state);
+            }
+
+            if (!initialScan)
+            {
+                for (const auto& [key, state] : m_PollSnapshot)
+                {
+                    if (!snapshot.contains(key))
+                        record(key, AssetChangeType::eRemoved, false);
+                }
+            }
+
+            m_PollSnapshot.swap(snapshot);
+            m_LastPoll = Clock::now();
+        }
+    } // namespace editor
+} // namespace vultra
@@ -0,0 +1,327 @@
+#include "vultra_editor/asset/thumbnail_cache.hpp"
+
+#include <vultra/core/base/common_context.hpp>
+#include <vultra/function/renderer/texture_manager.hpp>
+#include <vultra_engine/asset/asset_import_pipeline.hpp>
+#include <vultra_engine/core/memory_tracker.hpp>
+
+#include <stb_image.h>
+
+// Kept private to this translation unit so it cannot clash with another copy linked elsewhere
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include <algorithm>
+#include <format>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Thumbnail generation must not compete with the editor for every core
+        constexpr uint32_t THUMBNAIL_WORKER_COUNT = 2;
+        // Uploads per frame; each one is a tiny PNG
+        constexpr uint32_t THUMBNAIL_UPLOADS_PER_FRAME = 16;
+        // 256 * 128^2 * 4 bytes = 16 MB of VRAM at most
+        constexpr size_t   MAX_RESIDENT_THUMBNAILS = 256;
+        constexpr uint64_t THUMBNAIL_RETIRE_FRAMES = 3;
+
+        namespace
+        {
+            // Thumbnails are RGBA8 PNGs without mips
+            uint64_t getThumbnailBytes(const rhi::Texture& texture)
+            {
+                const auto extent = texture.getExtent();
+                return static_cast<uint64_t>(extent.width) * extent.height * 4;
+            }
+        } // namespace
+
+        ThumbnailCache::~ThumbnailCache() { shutdown(); }
+
+        void ThumbnailCache::initialize(const std::filesystem::path& cacheDir, rhi::RenderDevice& rd)
+        {
+            shutdown();
+
+            m_CacheDir     = cacheDir;
+            m_RenderDevice = &rd;
+            m_Cancelled    = false;
+
+            std::filesystem::create_directories(m_CacheDir);
+
+            // Files left by earlier sessions, so the first regeneration of an asset can still drop its old thumbnail
+            std::error_code ec;
+            for (const auto& entry : std::filesystem::directory_iterator(m_CacheDir, ec))
+            {
+                const auto stem      = entry.path().stem().string();
+                const auto separator = stem.rfind('_');
+                if (entry.path().extension() == ".png" && separator != std::string::npos)
+                    m_OwnedFiles[stem.substr(0, separator)] = entry.path();
+            }
+
+            m_Workers = std::make_unique<engine::JobSystem>(THUMBNAIL_WORKER_COUNT);
+        }
+
+        void ThumbnailCache::shutdown()
+        {
+            // Pending jobs see the flag and return immediately, so destroying the pool does not wait for them
+            m_Cancelled = true;
+            m_Workers.reset();
+
+            if (!m_RenderDevice)
+                return;
+
+            for (auto& [uuidStr, thumbnail] : m_Thumbnails)
+            {
+                if (thumbnail.imguiTexture)
+                    imgui::removeTexture(*m_RenderDevice, thumbnail.imguiTexture);
+                if (thumbnail.texture)
+                    engine::MemoryTracker::onFree(engine::MemoryTag::eGPUImGui, getThumbnailBytes(*thumbnail.texture));
+            }
+            m_Thumbnails.clear();
+
+            for (auto& retired : m_Retired)
+            {
+                if (retired.imguiTexture)
+                    imgui::removeTexture(*m_RenderDevice, retired.imguiTexture);
+            }
+            m_Retired.clear();
+
+            m_Generated.clear();
+            m_OwnedFiles.clear();
+            m_RenderDevice = nullptr;
+        }
+
+        void ThumbnailCache::update()
+        {
+            ++m_FrameIndex;
+
+            std::vector<GeneratedThumbnail> generated;
+            {
+                std::lock_guard lock(m_GeneratedMutex);
+                const size_t    count = std::min<size_t>(m_Generated.size(), THUMBNAIL_UPLOADS_PER_FRAME);
+                generated.assign(std::make_move_iterator(m_Generated.begin()),
+                                 std::make_move_iterator(m_Generated.begin() + count));
+                m_Generated.erase(m_Generated.begin(), m_Generated.begin() + count);
+            }
+
+            for (auto& result : generated)
+            {
+                if (!result.path.empty())
+                    m_OwnedFiles[result.uuidStr] = result.path;
+
+                auto it = m_Thumbnails.find(result.uuidStr);
+                if (it == m_Thumbnails.end() || it->second.state != ThumbnailState::ePending)
+                    continue; // Evicted or invalidated meanwhile
+
+                auto& thumbnail = it->second;
+                if (result.path.empty())
+                {
+                    thumbnail.state = ThumbnailState::eFailed;
+                    continue;
+                }
+
+                gfx::TextureLoader textureLoader {};
+
+                thumbnail.texture = textureLoader(result.path.generic_string(), *m_RenderDevice);
+                if (!thumbnail.texture)
+                {
+                    thumbnail.state = ThumbnailState::eFailed;
+                    continue;
+                }
+
+                thumbnail.imguiTexture = imgui::addTexture(*thumbnail.texture);
+                thumbnail.state        = ThumbnailState::eReady;
+
+                engine::MemoryTracker::onAllocate(engine::MemoryTag::eGPUImGui, getThumbnailBytes(*thumbnail.texture));
+            }
+
+            evictUnused();
+
+            std::erase_if(m_Retired, [this](const RetiredThumbnail& retired) {
+                if (retired.retiredFrame + THUMBNAIL_RETIRE_FRAMES > m_FrameIndex)
+                    return false;
+
+                if (retired.imguiTexture)
+                    imgui::removeTexture(*m_RenderDevice, retired.imguiTexture);
+                return true;
+            });
+        }
+
+        bool ThumbnailCache::tryGet(const vasset::VUUID& uuid, imgui::ImGuiTextureID& outTexture)
+        {
+            auto it = m_Thumbnails.find(uuid.toString());
+            if (it == m_Thumbnails.end())
+                return false;
+
+            it->second.lastUsedFrame = m_FrameIndex;
+            outTexture               = it->second.imguiTexture;
+            return true;
+        }
+
+        void ThumbnailCache::request(const vasset::VUUID&         uuid,
+                                     const std::filesystem::path& sourcePath,
+                                     uint64_t                     contentHash)
+        {
+            if (!m_Workers)
+                return;
+
+            auto uuidStr = uuid.toString();
+
+            auto [it, inserted]      = m_Thumbnails.try_emplace(uuidStr);
+            it->second.lastUsedFrame = m_FrameIndex;
+            if (!inserted)
+                return;
+
+            // The file this cache last wrote for the asset; the job removes it if the content hash moved on
+            std::filesystem::path ownedPath;
+            if (auto owned = m_OwnedFiles.find(uuidStr); owned != m_OwnedFiles.end())
+                ownedPath = owned->second;
+
+            m_Workers->submit([this, uuidStr, sourcePath, contentHash, ownedPath](uint32_t) {
+                if (m_Cancelled)
+                    return;
+
+                uint64_t hash = contentHash != 0 ? contentHash : engine::AssetImportPipeline::hashFile(sourcePath);
+                auto     path = m_CacheDir / std::format("{}_{:016x}.png", uuidStr, hash);
+
+                // Drop the thumbnail of the previous version of this asset, nothing else
+                if (!ownedPath.empty() && ownedPath != path)
+                {
+                    std::error_code ec;
+                    std::filesystem::remove(ownedPath, ec);
+                }
+
+                if (!std::filesystem::exists(path))
+                {
+                    if (!generate(sourcePath, path))
+                    {
+                        VULTRA_CORE_WARN("Failed to generate thumbnail for {}", sourcePath.generic_string());
+                        path.clear();
+                    }
+                }
+
+                std::lock_guard lock(m_GeneratedMutex);
+                m_Generated.push_back({uuidStr, std::move(path)});
+            });
+        }
+
+        void ThumbnailCache::invalidate(const vasset::VUUID& uuid)
+        {
+            auto it = m_Thumbnails.find(uuid.toString());
+            if (it == m_Thumbnails.end())
+                return;
+
+            retire(it->second);
+            m_Thumbnails.erase(it);
+        }
+
+        bool ThumbnailCache::generate(const std::filesystem::path& sourcePath, const std::filesystem::path& outputPath)
+        {
+            int      width    = 0;
+            int      height   = 0;
+            int      channels = 0;
+            stbi_uc* pixels   = stbi_load(sourcePath.string().c_str(), &width, &height, &channels, 4);
+            if (!pixels)
+            {
+                return false;
+            }
+
+            // Fit into the square while keeping the aspect ratio, then center with transparent padding
+            const float scale =
+                std::min({1.0f, float(THUMBNAIL_SIZE) / float(width), float(THUMBNAIL_SIZE) / float(height)});
+            const int dstWidth  = std::max(1, static_cast<int>(width * scale));
+            const int dstHeight = std::max(1, static_cast<int>(height * scale));
+            const int offsetX   = (THUMBNAIL_SIZE - dstWidth) / 2;
+            const int offsetY   = (THUMBNAIL_SIZE - dstHeight) / 2;
+
+            std::vector<uint8_t> thumbnail(THUMBNAIL_SIZE * THUMBNAIL_SIZE * 4, 0);
+
+            // Box filter: every destination pixel averages the source block it covers
+            for (int y = 0; y < dstHeight; ++y)
+            {
+                const int srcY0 = y * height / dstHeight;
+                const int srcY1 = std::max(srcY0 + 1, (y + 1) * height / dstHeight);
+
+                for (int x = 0; x < dstWidth; ++x)
+                {
+                    const int srcX0 = x * width / dstWidth;
+                    const int srcX1 = std::max(srcX0 + 1, (x + 1) * width / dstWidth);
+
+                    uint32_t sum[4] = {0, 0, 0, 0};
+                    for (int sy = srcY0; sy < srcY1; ++sy)
+                    {
+                        const stbi_uc* row = pixels + (static_cast<size_t>(sy) * width + srcX0) * 4;
+                        for (int sx = srcX0; sx < srcX1; ++sx, row += 4)
+                        {
+                            sum[0] += row[0];
+                            sum[1] += row[1];
+                            sum[2] += row[2];
+                            sum[3] += row[3];
+                        }
+                    }
+
+                    const uint32_t count = static_cast<uint32_t>((srcY1 - srcY0) * (srcX1 - srcX0));
+                    uint8_t*       dst   = &thumbnail[((y + offsetY) * THUMBNAIL_SIZE + (x + offsetX)) * 4];
+                    for (int c = 0; c < 4; ++c)
+                        dst[c] = static_cast<uint8_t>(sum[c] / count);
+                }
+            }
+
+            stbi_image_free(pixels);
+
+            // Write to a temporary file first so a half-written thumbnail is never picked up
+            auto tmpPath = outputPath;
+            tmpPath += ".tmp";
+            if (!stbi_write_png(tmpPath.string().c_str(),
+                                THUMBNAIL_SIZE,
+                                THUMBNAIL_SIZE,
+                                4,
+                                thumbnail.data(),
+                                THUMBNAIL_SIZE * 4))
+            {
+                return false;
+            }
+
+            std::error_code ec;
+            std::filesystem::rename(tmpPath, outputPath, ec);
+            return !ec;
+        }
+
+        void ThumbnailCache::retire(Thumbnail& thumbnail)
+        {
+            if (thumbnail.texture || thumbnail.imguiTexture)
+                m_Retired.push_back({thumbnail.texture, thumbnail.imguiTexture, m_FrameIndex});
+            if (thumbnail.texture)
+                engine::MemoryTracker::onFree(engine::MemoryTag::eGPUImGui, getThumbnailBytes(*thumbnail.texture));
+
+            thumbnail.texture      = nullptr;
+            thumbnail.imguiTexture = nullptr;
+        }
+
+        void ThumbnailCache::evictUnused()
+        {
+            if (m_Thumbnails.size() <= MAX_RESIDENT_THUMBNAILS)
+                return;
+
+            std::vector<std::pair<uint64_t, std::string>> candidates;
+            for (const auto& [uuidStr, thumbnail] : m_Thumbnails)
+            {
+                if (thumbnail.lastUsedFrame + THUMBNAIL_RETIRE_FRAMES < m_FrameIndex)
+                    candidates.emplace_back(thumbnail.lastUsedFrame, uuidStr);
+            }
+
+            std::sort(candidates.begin(), candidates.end());
+
+            for (const auto& [lastUsedFrame, uuidStr] : candidates)
+            {
+                if (m_Thumbnails.size() <= MAX_RESIDENT_THUMBNAILS)
+                    break;
+
+                auto it = m_Thumbnails.find(uuidStr);
+                retire(it->second);
+                m_Thumbnails.erase(it);
+            }
+        }
+    } // namespace editor
+} // namespace vultra
@@ -1,9 +1,14 @@
 #include "vultra_editor/editor_app.hpp"
 #include "vultra_editor/asset/asset_database.hpp"
+#include "vultra_editor/history/command_history.hpp"
+#include "vultra_editor/scene/entity_tombstone.hpp"
+#include "vultra_editor/scene/scene_change_tracker.hpp"
 #include "vultra_editor/ui/windows/asset_browser_window.hpp"
 #include "vultra_editor/ui/windows/console_window.hpp"
 #include "vultra_editor/ui/windows/game_view_window.hpp"
 #include "vultra_editor/ui/windows/inspector_window.hpp"
+#include "vultra_editor/ui/windows/memory_window.hpp"
+#include "vultra_editor/ui/windows/profiler_window.hpp"
 #include "vultra_editor/ui/windows/scene_graph_window.hpp"
 #include "vultra_editor/ui/windows/scene_view_window.hpp"
 #include "vultra_editor/version.hpp"
@@ -16,10 +21,15 @@
 #include <imgui_internal.h>
 #include <implot/implot.h>
 
+#include <format>
+
 namespace vultra
 {
     namespace editor
     {
+        // Time spent per frame on streaming in a scene file
+        constexpr auto SCENE_LOAD_BUDGET = std::chrono::milliseconds(4);
+
         EditorApp::EditorApp(const std::span<char*>& args) :
             ImGuiApp(
                 args,
@@ -28,6 +38,7 @@ namespace vultra
             m_Renderer(*m_RenderDevice, m_Swapchain.getFormat())
         {
             m_CurrentProject.name = "NewVultraProject";
+            engine::TraceRecorder::setThreadName("Main");
 
             VULTRA_CLIENT_TRACE("ArgCount: {}", args.size());
             for (uint32_t i = 0; i < args.size(); ++i)
@@ -37,6 +48,10 @@ namespace vultra
 
             m_ArgParser.add_description("Vultra Engine Editor Application");
             m_ArgParser.add_argument("--project", "Path to the project file").default_value(std::string(""));
+            m_ArgParser.add_argument("--scene", "Path to a scene file (.vscene) to open")
+                .default_value(std::string(""));
+            m_ArgParser.add_argument("--trace", "Record a trace from startup and save it to this path on exit")
+                .default_value(std::string(""));
 
             try
             {
@@ -48,6 +63,13 @@ namespace vultra
                 throw;
             }
 
+            // Started right away so the startup import is part of the trace
+            m_TracePath = m_ArgParser.get<std::string>("--trace");
+            if (!m_TracePath.empty())
+            {
+                startTraceCapture();
+            }
+
             auto projectPath = m_ArgParser.get<std::string>("--project");
 
             if (projectPath.empty())
@@ -77,15 +99,29 @@ namespace vultra
             m_EditingScene = createRef<LogicScene>("Untitled Scene");
             m_EditingScene->setSimulationMode(LogicSceneSimulationMode::eEditor);
 
-            auto  mainCamera          = m_EditingScene->createMainCamera();
-            auto& mainCamTransform    = mainCamera.getComponent<TransformComponent>();
-            auto& mainCamComponent    = mainCamera.getComponent<CameraComponent>();
-            mainCamTransform.position = glm::vec3(2.8f, 3.0f, -1.9f);
-            mainCamTransform.setRotationEuler({0, 120, 0});
-            mainCamComponent.clearFlags         = CameraClearFlags::eSkybox;
-            mainCamComponent.environmentMapPath = (std::filesystem::path(projectPath).parent_path() /
-                                                   "Assets/Textures/EnvMaps/citrus_orchard_puresky_1k.hdr")
-                                                      .generic_string();
+            // An opened scene streams in over the first frames (see onUpdate), otherwise start with a main camera
+            m_ScenePath = m_ArgParser.get<std::string>("--scene");
+            if (!m_ScenePath.empty() && !m_SceneLoader.open(m_ScenePath, *m_EditingScene))
+            {
+                VULTRA_CLIENT_ERROR("Failed to open scene file: {}", m_ScenePath.generic_string());
+            }
+            if (m_ScenePath.empty() && !m_CurrentProject.directory.empty())
+            {
+                m_ScenePath = std::filesystem::path(m_CurrentProject.directory) / "Assets/Scenes/Untitled.vscene";
+            }
+
+            if (!m_SceneLoader.isOpen())
+            {
+                auto  mainCamera          = m_EditingScene->createMainCamera();
+                auto& mainCamTransform    = mainCamera.getComponent<TransformComponent>();
+                auto& mainCamComponent    = mainCamera.getComponent<CameraComponent>();
+                mainCamTransform.position = glm::vec3(2.8f, 3.0f, -1.9f);
+                mainCamTransform.setRotationEuler({0, 120, 0});
+                mainCamComponent.clearFlags         = CameraClearFlags::eSkybox;
+                mainCamComponent.environmentMapPath = (std::filesystem::path(projectPath).parent_path() /
+                                                       "Assets/Textures/EnvMaps/citrus_orchard_puresky_1k.hdr")
+                                                          .generic_string();
+            }
 
             auto  camera                    = m_EditingScene->createEditorCamera();
             auto& camTransform              = camera.getComponent<TransformComponent>();
@@ -97,14 +133,18 @@ namespace vultra
                                                "Assets/Textures/EnvMaps/citrus_orchard_puresky_1k.hdr")
                                                   .generic_string();
 
-            // TODO: Remove, test code
-            auto rawMesh = m_EditingScene->createRawMeshEntity(
-                "DamagedHelmet",
-                (std::filesystem::path(projectPath).parent_path() / "Assets/Models/DamagedHelmet/DamagedHelmet.gltf")
-                    .generic_string());
-            auto& rawMeshTransform = rawMesh.getComponent<TransformComponent>();
-            rawMeshTransform.position = glm::vec3(0.0f, 3.0f, 0.0f);
-            rawMeshTransform.setRotationEuler({0.0f, 45.0f, 0.0f});
+            if (!m_SceneLoader.isOpen())
+            {
+                // TODO: Remove, test code
+                auto rawMesh = m_EditingScene->createRawMeshEntity(
+                    "DamagedHelmet",
+                    (std::filesystem::path(projectPath).parent_path() /
+                     "Assets/Models/DamagedHelmet/DamagedHelmet.gltf")
+                        .generic_string());
+                auto& rawMeshTransform = rawMesh.getComponent<TransformComponent>();
+                rawMeshTransform.position = glm::vec3(0.0f, 3.0f, 0.0f);
+                rawMeshTransform.setRotationEuler({0.0f, 45.0f, 0.0f});
+            }
 
             // Initialize Asset Database
             AssetDatabase::get()->initialize(m_CurrentProject, *m_RenderDevice);
@@ -116,6 +156,14 @@ namespace vultra
             m_UIWindowManager.registerWindow<AssetBrowserWindow>();
             m_UIWindowManager.registerWindow<ConsoleWindow>();
             m_UIWindowManager.registerWindow<InspectorWindow>();
+            m_UIWindowManager.registerWindow<ProfilerWindow>();
+            m_UIWindowManager.registerWindow<MemoryWindow>();
+
+            if (!m_CurrentProject.directory.empty())
+            {
+                m_UIWindowManager.getWindowOfType<MemoryWindow>()->setSnapshotDirectory(
+                    std::filesystem::path(m_CurrentProject.directory) / "MemorySnapshots");
+            }
 
             // Initialize UIWindowManager
             m_UIWindowManager.onInit(*m_RenderDevice);
@@ -126,18 +174,37 @@ namespace vultra
 
         EditorApp::~EditorApp()
         {
+            if (engine::TraceRecorder::isRecording())
+            {
+                stopTraceCapture();
+            }
+
             m_UIWindowManager.onDestroy();
             AssetDatabase::destroy();
         }
 
         void EditorApp::onPreUpdate(const fsec dt)
         {
+            // Frame boundary. Scopes are only recorded while the Profiler window is open and recording.
+            auto* profilerWindow = m_UIWindowManager.getWindowOfType<ProfilerWindow>();
+            engine::Profiler::setEnabled(profilerWindow && profilerWindow->isOpen() && profilerWindow->isRecording());
+            engine::Profiler::beginFrame();
+            engine::MemoryTracker::update();
+
+            VULTRA_PROFILE_SCOPE("PreUpdate");
+            {
+                VULTRA_PROFILE_SCOPE("AssetDatabase");
+                AssetDatabase::get()->update();
+            }
             m_UIWindowManager.onPreUpdate();
             ImGuiApp::onPreUpdate(dt);
         }
 
         void EditorApp::onUpdate(const fsec dt)
         {
+            VULTRA_PROFILE_SCOPE("Update");
+            CommandHistory::setScene(m_EditingScene.get());
+            updateSceneLoading();
             m_UIWindowManager.onUpdate(dt, m_EditingScene.get());
 
             auto editorCamera = m_EditingScene->getEditorCamera();
@@ -155,38 +222,51 @@ namespace vultra
 
         void EditorApp::onPhysicsUpdate(const fsec dt)
         {
+            VULTRA_PROFILE_SCOPE("PhysicsUpdate");
             m_UIWindowManager.onPhysicsUpdate(dt);
             ImGuiApp::onPhysicsUpdate(dt);
         }
 
         void EditorApp::onPostUpdate(const fsec dt)
         {
+            VULTRA_PROFILE_SCOPE("PostUpdate");
             m_UIWindowManager.onPostUpdate(dt);
             ImGuiApp::onPostUpdate(dt);
         }
 
         void EditorApp::onPreRender()
         {
+            VULTRA_PROFILE_SCOPE("PreRender");
             m_UIWindowManager.onPreRender();
             ImGuiApp::onPreRender();
         }
 
         void EditorApp::onRender(rhi::CommandBuffer& cb, const rhi::RenderTargetView rtv, const fsec dt)
         {
+            VULTRA_PROFILE_SCOPE("Render");
+
             // const auto& [frameIndex, target] = rtv;
             UIWindowRenderContext ctx {.cb = cb, .renderer = &m_Renderer, .rtv = rtv, .dt = dt};
             m_UIWindowManager.onRender(ctx);
-            ImGuiApp::onRender(cb, rtv, dt);
+            {
+                VULTRA_PROFILE_SCOPE("ImGuiApp");
+                ImGuiApp::onRender(cb, rtv, dt);
+            }
         }
 
         void EditorApp::onPostRender()
         {
+            VULTRA_PROFILE_SCOPE("PostRender");
             m_UIWindowManager.onPostRender();
             ImGuiApp::onPostRender();
         }
 
         void EditorApp::onImGui()
         {
+            VULTRA_PROFILE_SCOPE("ImGui");
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eUI);
+
+            handleShortcuts();
             drawMainMenuBar();
             m_UIWindowManager.onImGui();
 
@@ -264,6 +344,8 @@ namespace vultra
             auto* assetBrowserWindow = m_UIWindowManager.getWindowOfType<AssetBrowserWindow>();
             auto* consoleWindow      = m_UIWindowManager.getWindowOfType<ConsoleWindow>();
             auto* inspectorWindow    = m_UIWindowManager.getWindowOfType<InspectorWindow>();
+            auto* profilerWindow     = m_UIWindowManager.getWindowOfType<ProfilerWindow>();
+            auto* memoryWindow       = m_UIWindowManager.getWindowOfType<MemoryWindow>();
 
             if (sceneGraphWindow)
                 ImGui::DockBuilderDockWindow(sceneGraphWindow->getName().c_str(), dock_left_top_left_id);
@@ -277,6 +359,10 @@ namespace vultra
                 ImGui::DockBuilderDockWindow(assetBrowserWindow->getName().c_str(), dock_left_bottom_id);
             if (consoleWindow)
                 ImGui::DockBuilderDockWindow(consoleWindow->getName().c_str(), dock_left_bottom_id);
+            if (profilerWindow)
+                ImGui::DockBuilderDockWindow(profilerWindow->getName().c_str(), dock_left_bottom_id);
+            if (memoryWindow)
+                ImGui::DockBuilderDockWindow(memoryWindow->getName().c_str(), dock_left_bottom_id);
 
             if (inspectorWindow)
                 ImGui::DockBuilderDockWindow(inspectorWindow->getName().c_str(), dock_right_id);
@@ -285,12 +371,147 @@ namespace vultra
             ImGui::DockBuilderFinish(dockSpaceId);
         }
 
+        void EditorApp::updateSceneLoading()
+        {
+            if (!m_SceneLoader.isOpen())
+                return;
+
+            VULTRA_PROFILE_SCOPE("Scene Loading");
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eScene);
+
+            // Entities of every loaded chunk show up in the editor right away
+            m_SceneLoader.loadFor(SCENE_LOAD_BUDGET);
+            SceneChangeTracker::markHierarchyChanged();
+
+            if (m_SceneLoader.hasFailed())
+            {
+                m_SceneLoader.close();
+            }
+            else if (m_SceneLoader.isDone())
+            {
+                VULTRA_CLIENT_INFO(
+                    "Loaded scene {} ({} entities)", m_ScenePath.generic_string(), m_SceneLoader.getEntityCount());
+                m_SceneLoader.close();
+            }
+        }
+
+        void EditorApp::saveScene()
+        {
+            if (m_ScenePath.empty() || m_SceneLoader.isOpen())
+                return;
+
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eScene);
+
+            std::error_code ec;
+            std::filesystem::create_directories(m_ScenePath.parent_path(), ec);
+
+            // Deleted entities kept for undo are not part of the scene
+            engine::SceneSaveOptions options;
+            options.filter = [](Entity& entity) { return !isTombstoned(entity); };
+
+            engine::SceneSaveStats stats;
+            if (!engine::saveScene(m_ScenePath, *m_EditingScene, options, &stats))
+            {
+                VULTRA_CLIENT_ERROR("Failed to save scene: {}", m_ScenePath.generic_string());
+                return;
+            }
+
+            VULTRA_CLIENT_INFO("Saved scene {} ({} entities, {} of {} chunks written{})",
+                               m_ScenePath.generic_string(),
+                               stats.entityCount,
+                               stats.writtenChunkCount,
+                               stats.chunkCount,
+                               stats.isFullWrite ? ", full rewrite" : "");
+        }
+
+        void EditorApp::startTraceCapture()
+        {
+            engine::TraceRecorder::start();
+            VULTRA_CLIENT_INFO("Trace capture started");
+        }
+
+        void EditorApp::stopTraceCapture()
+        {
+            engine::TraceRecorder::stop();
+
+            auto tracePath = m_TracePath;
+            if (tracePath.empty())
+            {
+                const auto baseDir = m_CurrentProject.directory.empty() ?
+                                         std::filesystem::current_path() :
+                                         std::filesystem::path(m_CurrentProject.directory);
+                const auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+                tracePath      = baseDir / "Traces" / std::format("trace_{:%Y%m%d_%H%M%S}.json", now);
+            }
+
+            std::error_code ec;
+            std::filesystem::create_directories(tracePath.parent_path(), ec);
+
+            const auto stats = engine::TraceRecorder::getStats();
+            if (!engine::TraceRecorder::writeChromeTrace(tracePath))
+            {
+                VULTRA_CLIENT_ERROR("Failed to write trace: {}", tracePath.generic_string());
+                return;
+            }
+
+            VULTRA_CLIENT_INFO("Saved trace {} ({} events on {} threads, {} dropped)",
+                               tracePath.generic_string(),
+                               stats.eventCount,
+                               stats.threadCount,
+                               stats.droppedCount);
+        }
+
+        void EditorApp::handleShortcuts()
+        {
+            const auto& io = ImGui::GetIO();
+            if (io.WantTextInput || !io.KeyCtrl)
+                return;
+
+            if (ImGui::IsKeyPressed(ImGuiKey_S, false))
+            {
+                saveScene();
+                return;
+            }
+
+            // Ctrl+Z undoes, Ctrl+Y or Ctrl+Shift+Z redoes
+            if (ImGui::IsKeyPressed(ImGuiKey_Z, false))
+            {
+                if (io.KeyShift)
+                    CommandHistory::redo();
+                else
+                    CommandHistory::undo();
+            }
+            else if (ImGui::IsKeyPressed(ImGuiKey_Y, false))
+            {
+                CommandHistory::redo();
+            }
+        }
+
         void EditorApp::drawMainMenuBar()
         {
             if (ImGui::BeginMainMenuBar())
             {
                 if (ImGui::BeginMenu("File"))
                 {
+                    const bool canSaveScene = !m_ScenePath.empty() && !m_SceneLoader.isOpen();
+                    if (ImGui::MenuItem("Save Scene", "Ctrl+S", false, canSaveScene))
+                    {
+                        saveScene();
+                    }
+                    if (ImGui::MenuItem("Export Scene (JSON)", nullptr, false, canSaveScene))
+                    {
+                        auto jsonPath = m_ScenePath;
+                        jsonPath.replace_extension(".json");
+
+                        saveScene();
+                        engine::exportSceneJson(m_ScenePath, jsonPath);
+                    }
+                    ImGui::Separator();
+                    if (ImGui::MenuItem("Export Asset Registry (JSON)"))
+                    {
+                        AssetDatabase::get()->exportRegistryJson();
+                    }
+                    ImGui::Separator();
                     if (ImGui::MenuItem("Exit", "Alt+F4"))
                     {
                         close();
@@ -298,6 +519,22 @@ namespace vultra
                     ImGui::EndMenu();
                 }
 
+                if (ImGui::BeginMenu("Edit"))
+                {
+                    const std::string undoLabel = std::format("Undo {}", CommandHistory::getUndoName());
+                    const std::string redoLabel = std::format("Redo {}", CommandHistory::getRedoName());
+
+                    if (ImGui::MenuItem(undoLabel.c_str(), "Ctrl+Z", false, CommandHistory::canUndo()))
+                    {
+                        CommandHistory::undo();
+                    }
+                    if (ImGui::MenuItem(redoLabel.c_str(), "Ctrl+Y", false, CommandHistory::canRedo()))
+                    {
+                        CommandHistory::redo();
+                    }
+                    ImGui::EndMenu();
+                }
+
                 if (ImGui::BeginMenu("Window"))
                 {
                     for (const auto& w : m_UIWindowManager.getWindows())
@@ -312,6 +549,20 @@ namespace vultra
                     ImGui::EndMenu();
                 }
 
+                if (ImGui::BeginMenu("Trace"))
+                {
+                    const bool isRecording = engine::TraceRecorder::isRecording();
+                    if (ImGui::MenuItem("Start Capture", nullptr, false, !isRecording))
+                    {
+                        startTraceCapture();
+                    }
+                    if (ImGui::MenuItem("Stop Capture and Save", nullptr, false, isRecording))
+                    {
+                        stopTraceCapture();
+                    }
+                    ImGui::EndMenu();
+                }
+
                 if (ImGui::BeginMenu("Help"))
                 {
                     if (ImGui::MenuItem("About Vultra Editor"))
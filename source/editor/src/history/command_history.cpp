@@ -0,0 +1,162 @@
+#include "vultra_editor/history/command_history.hpp"
+
+#include <vultra_engine/core/memory_tracker.hpp>
+
+namespace vultra
+{
+    namespace editor
+    {
+        void CommandHistory::setScene(LogicScene* scene)
+        {
+            if (scene == s_Scene)
+                return;
+
+            // The previous scene may already be gone, so its entries are dropped without being discarded
+            s_UndoStack.clear();
+            s_RedoStack.clear();
+            s_ByteSize = 0;
+            s_Scene    = scene;
+        }
+
+        void CommandHistory::push(std::unique_ptr<EditorCommand> command, const void* mergeSource)
+        {
+            if (!command || !s_Scene)
+                return;
+
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eScene);
+
+            clearRedo();
+
+            if (mergeSource && !s_UndoStack.empty())
+            {
+                auto& top = s_UndoStack.back();
+                if (!top.isSealed && top.mergeSource == mergeSource && top.command->merge(*command))
+                {
+                    s_ByteSize -= top.byteSize;
+                    top.byteSize = top.command->getByteSize();
+                    s_ByteSize += top.byteSize;
+                    enforceBudget();
+                    return;
+                }
+            }
+
+            // A new entry ends whatever continuous edit came before it
+            if (!s_UndoStack.empty())
+                s_UndoStack.back().isSealed = true;
+
+            Entry entry;
+            entry.byteSize    = command->getByteSize();
+            entry.command     = std::move(command);
+            entry.mergeSource = mergeSource;
+            entry.isSealed    = mergeSource == nullptr;
+
+            s_ByteSize += entry.byteSize;
+            s_UndoStack.push_back(std::move(entry));
+            enforceBudget();
+        }
+
+        void CommandHistory::execute(std::unique_ptr<EditorCommand> command, const void* mergeSource)
+        {
+            if (!command || !s_Scene)
+                return;
+
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eScene);
+
+            command->redo(*s_Scene);
+            push(std::move(command), mergeSource);
+        }
+
+        void CommandHistory::seal(const void* mergeSource)
+        {
+            if (!s_UndoStack.empty() && s_UndoStack.back().mergeSource == mergeSource)
+                s_UndoStack.back().isSealed = true;
+        }
+
+        bool CommandHistory::undo()
+        {
+            if (s_UndoStack.empty() || !s_Scene)
+                return false;
+
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eScene);
+
+            auto entry = std::move(s_UndoStack.back());
+            s_UndoStack.pop_back();
+
+            entry.command->undo(*s_Scene);
+            entry.isSealed = true;
+            s_RedoStack.push_back(std::move(entry));
+            return true;
+        }
+
+        bool CommandHistory::redo()
+        {
+            if (s_RedoStack.empty() || !s_Scene)
+                return false;
+
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eScene);
+
+            auto entry = std::move(s_RedoStack.back());
+            s_RedoStack.pop_back();
+
+            entry.command->redo(*s_Scene);
+            s_UndoStack.push_back(std::move(entry));
+            return true;
+        }
+
+        void CommandHistory::clear()
+        {
+            // Newest first: the redo stack holds the newer entries, its front being the newest
+            if (s_Scene)
+            {
+                for (auto& entry : s_RedoStack)
+                    entry.command->discard(*s_Scene, false);
+                for (auto it = s_UndoStack.rbegin(); it != s_UndoStack.rend(); ++it)
+                    it->command->discard(*s_Scene, true);
+            }
+
+            s_UndoStack.clear();
+            s_RedoStack.clear();
+            s_ByteSize = 0;
+        }
+
+        std::string_view CommandHistory::getUndoName()
+        {
+            return s_UndoStack.empty() ? std::string_view {} : s_UndoStack.back().command->getName();
+        }
+
+        std::string_view CommandHistory::getRedoName()
+        {
+            return s_RedoStack.empty() ? std::string_view {} : s_RedoStack.back().command->getName();
+        }
+
+        void CommandHistory::setByteBudget(size_t bytes)
+        {
+            s_ByteBudget = bytes;
+            enforceBudget();
+        }
+
+        void CommandHistory::clearRedo()
+        {
+            // Newest first, so entities created by later commands are discarded before earlier ones
+            while (!s_RedoStack.empty())
+            {
+                auto& entry = s_RedoStack.front();
+                entry.command->discard(*s_Scene, false);
+                s_ByteSize -= entry.byteSize;
+                s_RedoStack.pop_front();
+            }
+        }
+
+        void CommandHistory::enforceBudget()
+        {
+            // The newest entry always stays, however large it is
+            while (s_ByteSize > s_ByteBudget && s_UndoStack.size() > 1)
+            {
+                auto& entry = s_UndoStack.front();
+                entry.command->discard(*s_Scene, true);
+                s_ByteSize -= entry.byteSize;
+                s_UndoStack.pop_front();
+            }
+        }
+    } // namespace editor
+} // namespace vultra
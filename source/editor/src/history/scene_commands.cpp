@@ -0,0 +1,207 @@
+#include "vultra_editor/history/scene_commands.hpp"
+#include "vultra_editor/scene/entity_tombstone.hpp"
+#include "vultra_editor/scene/scene_change_tracker.hpp"
+#include "vultra_editor/selector.hpp"
+
+#include <vultra/function/scenegraph/logic_scene.hpp>
+
+#include <functional>
+#include <span>
+
+namespace vultra
+{
+    namespace editor
+    {
+        namespace
+        {
+            void applyTransforms(LogicScene& scene, const std::vector<TransformCommand::Delta>& deltas, bool useAfter)
+            {
+                for (const auto& delta : deltas)
+                {
+                    Entity entity = scene.getEntityWithCoreUUID(delta.entity);
+                    if (entity && entity.hasComponent<TransformComponent>())
+                    {
+                        entity.getComponent<TransformComponent>() = useAfter ? delta.after : delta.before;
+                    }
+                }
+                SceneChangeTracker::markTransformsChanged();
+            }
+
+            void setParent(LogicScene& scene, const CoreUUID& entityUUID, const CoreUUID& parentUUID)
+            {
+                Entity entity = scene.getEntityWithCoreUUID(entityUUID);
+                if (!entity)
+                    return;
+
+                entity.setParent(parentUUID);
+                SceneChangeTracker::markHierarchyChanged();
+            }
+
+            void setName(LogicScene& scene, const CoreUUID& entityUUID, const std::string& name)
+            {
+                Entity entity = scene.getEntityWithCoreUUID(entityUUID);
+                if (!entity)
+                    return;
+
+                entity.setName(name);
+                SceneChangeTracker::markHierarchyChanged();
+            }
+
+            // Entities and all their descendants, children before their parent
+            std::vector<CoreUUID> collectSubtrees(LogicScene& scene, std::span<const CoreUUID> entityUUIDs)
+            {
+                std::vector<CoreUUID>        subtree;
+                std::function<void(Entity&)> collect = [&](Entity& entity) {
+                    for (auto& child : entity.getChildrenEntities())
+                        collect(child);
+                    subtree.push_back(entity.getCoreUUID());
+                };
+
+                for (const auto& uuid : entityUUIDs)
+                {
+                    Entity entity = scene.getEntityWithCoreUUID(uuid);
+                    if (entity)
+                        collect(entity);
+                }
+                return subtree;
+            }
+
+            void tombstoneEntities(LogicScene& scene, std::span<const CoreUUID> entityUUIDs)
+            {
+                for (const auto& uuid : entityUUIDs)
+                {
+                    Entity entity = scene.getEntityWithCoreUUID(uuid);
+                    if (entity)
+                        tombstoneEntity(entity);
+                }
+
+                // Selected descendants go with their deleted ancestor
+                Selector::unselect(SelectionCategory::eEntity, collectSubtrees(scene, entityUUIDs));
+                SceneChangeTracker::markHierarchyChanged();
+            }
+
+            void restoreEntities(LogicScene& scene, std::span<const CoreUUID> entityUUIDs)
+            {
+                for (const auto& uuid : entityUUIDs)
+                {
+                    Entity entity = scene.getEntityWithCoreUUID(uuid);
+                    if (entity)
+                        restoreEntity(entity);
+                }
+                SceneChangeTracker::markHierarchyChanged();
+            }
+
+            void destroyEntities(LogicScene& scene, std::span<const CoreUUID> entityUUIDs)
+            {
+                // Children first, so nothing is left behind whether or not destroying a parent takes its children
+                const auto subtree = collectSubtrees(scene, entityUUIDs);
+                Selector::unselect(SelectionCategory::eEntity, subtree);
+
+                for (const auto& uuid : subtree)
+                {
+                    Entity entity = scene.getEntityWithCoreUUID(uuid);
+                    if (entity)
+                        scene.destroyEntity(entity);
+                }
+
+                // Windows cache entity handles by selection generation; none of them may outlive the entity
+                Selector::invalidate(SelectionCategory::eEntity);
+                SceneChangeTracker::markHierarchyChanged();
+            }
+        } // namespace
+
+        void TransformCommand::undo(LogicScene& scene) { applyTransforms(scene, m_Deltas, false); }
+
+        void TransformCommand::redo(LogicScene& scene) { applyTransforms(scene, m_Deltas, true); }
+
+        bool TransformCommand::merge(const EditorCommand& next)
+        {
+            const auto* nextTransform = dynamic_cast<const TransformCommand*>(&next);
+            if (!nextTransform || nextTransform->m_Deltas.size() != m_Deltas.size())
+                return false;
+
+            for (size_t i = 0; i < m_Deltas.size(); i++)
+            {
+                if (m_Deltas[i].entity != nextTransform->m_Deltas[i].entity)
+                    return false;
+            }
+
+            for (size_t i = 0; i < m_Deltas.size(); i++)
+            {
+                m_Deltas[i].after = nextTransform->m_Deltas[i].after;
+            }
+            return true;
+        }
+
+        size_t TransformCommand::getByteSize() const { return sizeof(*this) + m_Deltas.capacity() * sizeof(Delta); }
+
+        ReparentCommand::ReparentCommand(LogicScene& scene, const CoreUUID& entity, const CoreUUID& newParent) :
+            m_Entity(entity), m_NewParent(newParent)
+        {
+            // Entities only know their children, so the parent is found with one walk over the tree
+            std::function<bool(Entity&)> findParent = [&](Entity& parent) {
+                for (auto& child : parent.getChildrenEntities())
+                {
+                    if (child.getCoreUUID() == m_Entity)
+                    {
+                        m_OldParent = parent.getCoreUUID();
+                        return true;
+                    }
+                    if (findParent(child))
+                        return true;
+                }
+                return false;
+            };
+
+            for (auto& root : scene.getRootEntities())
+            {
+                if (findParent(root))
+                    break;
+            }
+        }
+
+        void ReparentCommand::undo(LogicScene& scene) { setParent(scene, m_Entity, m_OldParent); }
+
+        void ReparentCommand::redo(LogicScene& scene) { setParent(scene, m_Entity, m_NewParent); }
+
+        void RenameCommand::undo(LogicScene& scene) { setName(scene, m_Entity, m_OldName); }
+
+        void RenameCommand::redo(LogicScene& scene) { setName(scene, m_Entity, m_NewName); }
+
+        size_t RenameCommand::getByteSize() const
+        {
+            return sizeof(*this) + m_OldName.capacity() + m_NewName.capacity();
+        }
+
+        void CreateEntityCommand::undo(LogicScene& scene)
+        {
+            tombstoneEntities(scene, std::span<const CoreUUID>(&m_Entity, 1));
+        }
+
+        void CreateEntityCommand::redo(LogicScene& scene)
+        {
+            restoreEntities(scene, std::span<const CoreUUID>(&m_Entity, 1));
+        }
+
+        void CreateEntityCommand::discard(LogicScene& scene, bool isApplied)
+        {
+            if (!isApplied)
+                destroyEntities(scene, std::span<const CoreUUID>(&m_Entity, 1));
+        }
+
+        void DeleteEntitiesCommand::undo(LogicScene& scene) { restoreEntities(scene, m_Entities); }
+
+        void DeleteEntitiesCommand::redo(LogicScene& scene) { tombstoneEntities(scene, m_Entities); }
+
+        void DeleteEntitiesCommand::discard(LogicScene& scene, bool isApplied)
+        {
+            if (isApplied)
+                destroyEntities(scene, m_Entities);
+        }
+
+        size_t DeleteEntitiesCommand::getByteSize() const
+        {
+            return sizeof(*this) + m_Entities.capacity() * sizeof(CoreUUID);
+        }
+    } // namespace editor
+} // namespace vultra
@@ -0,0 +1,167 @@
+#include "vultra_editor/log/console_log_buffer.hpp"
+
+#include <vultra_engine/core/memory_tracker.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <format>
+
+namespace vultra
+{
+    namespace editor
+    {
+        ConsoleLogBuffer::ConsoleLogBuffer(size_t ringCapacity, size_t maxHistory) :
+            m_Mask(std::bit_ceil(std::max<size_t>(ringCapacity, 2)) - 1), m_MaxHistory(std::max<size_t>(maxHistory, 1))
+        {
+            m_Cells = std::make_unique<Cell[]>(m_Mask + 1);
+            for (size_t i = 0; i <= m_Mask; ++i)
+            {
+                m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ConsoleLogBuffer::~ConsoleLogBuffer() = default;
+
+        bool ConsoleLogBuffer::push(Logger::Level level, std::string_view message)
+        {
+            uint64_t pos  = m_EnqueuePos.load(std::memory_order_relaxed);
+            Cell*    cell = nullptr;
+
+            while (true)
+            {
+                cell = &m_Cells[pos & m_Mask];
+
+                const uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+                const auto     diff     = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+                if (diff == 0)
+                {
+                    // The cell is free for this position, claim it
+                    if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    // The consumer has not freed this cell yet: the ring is full
+                    m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                else
+                {
+                    pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            message = message.substr(0, UINT32_MAX);
+
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eConsole);
+
+            cell->level  = level;
+            cell->length = static_cast<uint32_t>(message.size());
+            if (message.size() <= INLINE_MESSAGE_SIZE)
+                std::memcpy(cell->inlineText, message.data(), message.size());
+            else
+                cell->overflowText.assign(message);
+
+            // Publish to the consumer
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        size_t ConsoleLogBuffer::drain()
+        {
+            engine::MemoryTagScope memoryTag(engine::MemoryTag::eConsole);
+
+            size_t count = 0;
+
+            // At most one ring's worth, so producers that keep logging cannot hold the frame hostage
+            for (size_t i = 0; i <= m_Mask; ++i)
+            {
+                Cell& cell = m_Cells[m_DequeuePos & m_Mask];
+                if (cell.sequence.load(std::memory_order_acquire) != m_DequeuePos + 1)
+                    break;
+
+                if (cell.length <= INLINE_MESSAGE_SIZE)
+                {
+                    append(cell.level, std::string_view(cell.inlineText, cell.length));
+                }
+                else
+                {
+                    append(cell.level, cell.overflowText);
+                    cell.overflowText = std::string();
+                }
+
+                // Hand the cell back to producers for the next lap
+                cell.sequence.store(m_DequeuePos + m_Mask + 1, std::memory_order_release);
+                ++m_DequeuePos;
+                ++count;
+            }
+
+            const uint64_t dropped = m_Dropped.load(std::memory_order_relaxed);
+            if (dropped != m_ReportedDropped)
+            {
+                append(Logger::Level::eWarn,
+                       std::format("{} log messages were dropped, the console could not keep up",
+                                   dropped - m_ReportedDropped));
+                m_ReportedDropped = dropped;
+                ++count;
+            }
+
+            return count;
+        }
+
+        void ConsoleLogBuffer::clear()
+        {
+            m_FirstSequence += m_History.size();
+            m_History.clear();
+            m_Arena.clear();
+        }
+
+        void ConsoleLogBuffer::append(Logger::Level level, std::string_view message)
+        {
+            if (m_History.size() >= m_MaxHistory)
+                releaseOldest();
+
+            Entry entry;
+            entry.text   = intern(message);
+            entry.length = static_cast<uint32_t>(message.size());
+            entry.level  = level;
+            m_History.push_back(entry);
+
+            m_Arena.back().lastSequence = getEndSequence() - 1;
+        }
+
+        const char* ConsoleLogBuffer::intern(std::string_view message)
+        {
+            const size_t required = message.size() + 1;
+            if (m_Arena.empty() || m_Arena.back().capacity - m_Arena.back().used < required)
+            {
+                // Oversized messages get a chunk of their own
+                ArenaChunk chunk;
+                chunk.capacity = std::max(ARENA_CHUNK_SIZE, required);
+                chunk.data     = std::make_unique_for_overwrite<char[]>(chunk.capacity);
+                m_Arena.push_back(std::move(chunk));
+            }
+
+            auto& chunk = m_Arena.back();
+            char* text  = chunk.data.get() + chunk.used;
+            std::memcpy(text, message.data(), message.size());
+            text[message.size()] = '\0';
+            chunk.used += required;
+
+            return text;
+        }
+
+        void ConsoleLogBuffer::releaseOldest()
+        {
+            m_History.pop_front();
+            ++m_FirstSequence;
+
+            // A chunk is freed once none of its entries is retained; the newest chunk is still being filled
+            while (m_Arena.size() > 1 && m_Arena.front().lastSequence < m_FirstSequence)
+            {
+                m_Arena.pop_front();
+            }
+        }
+    } // namespace editor
+} // namespace vultra
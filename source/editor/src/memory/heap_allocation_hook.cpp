@@ -0,0 +1,123 @@
+// Global operator new/delete replacements feeding engine::MemoryTracker. Enabled with the memory_hook option; every
+// C++ heap allocation in the editor carries a small header holding its size and the tag of the allocating thread,
+// so it is released against the same tag whichever thread frees it. malloc'd memory (C libraries, ImGui's own
+// allocator) is not seen here.
+
+#ifdef VULTRA_EDITOR_MEMORY_HOOK
+
+#include <vultra_engine/core/memory_tracker.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    using vultra::engine::MemoryTag;
+    using vultra::engine::MemoryTracker;
+
+    struct alignas(16) AllocationHeader
+    {
+        uint64_t  size;
+        uint32_t  offset; // From the start of the malloc'd block to the user pointer
+        MemoryTag tag;
+    };
+    static_assert(sizeof(AllocationHeader) == 16);
+
+    void* allocate(std::size_t size, std::size_t alignment) noexcept
+    {
+        alignment = std::max<std::size_t>(alignment, alignof(AllocationHeader));
+
+        // Extra room to realign past the header when malloc's alignment isn't enough
+        const std::size_t padding = alignment > alignof(std::max_align_t) ? alignment : 0;
+        auto*             block   = static_cast<std::byte*>(std::malloc(sizeof(AllocationHeader) + padding + size));
+        if (!block)
+            return nullptr;
+
+        const auto address = reinterpret_cast<std::uintptr_t>(block) + sizeof(AllocationHeader);
+        auto*      user    = reinterpret_cast<std::byte*>((address + alignment - 1) & ~(alignment - 1));
+
+        const MemoryTag tag    = MemoryTracker::getThreadTag();
+        auto*           header = reinterpret_cast<AllocationHeader*>(user) - 1;
+        header->size           = size;
+        header->offset         = static_cast<uint32_t>(user - block);
+        header->tag            = tag;
+
+        MemoryTracker::onAllocate(tag, size);
+        return user;
+    }
+
+    void* allocateOrThrow(std::size_t size, std::size_t alignment)
+    {
+        while (true)
+        {
+            if (void* ptr = allocate(size, alignment))
+                return ptr;
+
+            auto handler = std::get_new_handler();
+            if (!handler)
+                throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    void deallocate(void* ptr) noexcept
+    {
+        if (!ptr)
+            return;
+
+        const auto* header = static_cast<AllocationHeader*>(ptr) - 1;
+        MemoryTracker::onFree(header->tag, header->size);
+        std::free(static_cast<std::byte*>(ptr) - header->offset);
+    }
+
+    [[maybe_unused]] const bool s_IsInstalled = [] {
+        MemoryTracker::setHeapTracked(true);
+        return true;
+    }();
+} // namespace
+
+void* operator new(std::size_t size) { return allocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size, alignof(std::max_align_t));
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size, alignof(std::max_align_t));
+}
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(ptr); }
+
+#endif
@@ -0,0 +1,413 @@
+#include "vultra_editor/picking/bounding_volume_hierarchy.hpp"
+#include "vultra_editor/picking/picking_frustum.hpp"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+namespace vultra
+{
+    namespace editor
+    {
+        namespace
+        {
+            constexpr uint32_t SAH_BIN_COUNT = 12;
+            constexpr uint32_t MAX_DEPTH     = 64;
+            // Leaves up to this size are kept when no split beats them under the SAH
+            constexpr uint32_t MAX_SAH_LEAF_SIZE = 16;
+
+            float intersectSlabs(const glm::vec3&   origin,
+                                 const glm::vec3&   invDirection,
+                                 const BoundingBox& box,
+                                 float              maxDistance)
+            {
+                const glm::vec3 t0 = (box.min - origin) * invDirection;
+                const glm::vec3 t1 = (box.max - origin) * invDirection;
+
+                const glm::vec3 tNear = glm::min(t0, t1);
+                const glm::vec3 tFar  = glm::max(t0, t1);
+
+                const float entry = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+                const float exit  = std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, maxDistance));
+
+                return entry <= exit ? entry : FLT_MAX;
+            }
+
+            glm::vec3 safeInverse(const glm::vec3& direction)
+            {
+                // Huge instead of infinite, so 0 * inv never produces NaN for rays inside a slab
+                constexpr float LARGE = 1e30f;
+
+                glm::vec3 inv;
+                for (int axis = 0; axis < 3; axis++)
+                {
+                    inv[axis] = std::abs(direction[axis]) > 1e-12f ? 1.0f / direction[axis] :
+                                                                     std::copysign(LARGE, direction[axis]);
+                }
+                return inv;
+            }
+        } // namespace
+
+        BoundingBox BoundingBox::transform(const glm::mat4& matrix) const
+        {
+            if (!isValid())
+                return {};
+
+            // Arvo: the extent maps through the absolute linear part
+            const glm::vec3 center = glm::vec3(matrix * glm::vec4(getCenter(), 1.0f));
+            const glm::vec3 half   = getExtent() * 0.5f;
+
+            glm::vec3 extent {0.0f};
+            for (int column = 0; column < 3; column++)
+            {
+                extent += glm::abs(glm::vec3(matrix[column])) * half[column];
+            }
+
+            return {center - extent, center + extent};
+        }
+
+        std::optional<float> intersectRayBox(const PickingRay& ray, const BoundingBox& box)
+        {
+            const float distance = intersectSlabs(ray.origin, safeInverse(ray.direction), box, FLT_MAX);
+            if (distance == FLT_MAX)
+                return std::nullopt;
+
+            return distance;
+        }
+
+        void BoundingVolumeHierarchy::build(std::span<const BoundingBox> itemBounds)
+        {
+            clear();
+            if (itemBounds.empty())
+                return;
+
+            const auto itemCount = static_cast<uint32_t>(itemBounds.size());
+
+            m_ItemBounds.assign(itemBounds.begin(), itemBounds.end());
+            m_ItemLeaf.assign(itemCount, INVALID_INDEX);
+            m_ItemIndices.resize(itemCount);
+            std::iota(m_ItemIndices.begin(), m_ItemIndices.end(), 0u);
+
+            std::vector<glm::vec3> centroids(itemCount);
+            for (uint32_t i = 0; i < itemCount; i++)
+            {
+                centroids[i] = m_ItemBounds[i].getCenter();
+            }
+
+            m_Nodes.reserve(static_cast<size_t>(itemCount) * 2);
+            auto& root = m_Nodes.emplace_back();
+            root.first = 0;
+            root.count = itemCount;
+
+            buildNode(0, centroids, 0);
+        }
+
+        void BoundingVolumeHierarchy::clear()
+        {
+            m_Nodes.clear();
+            m_ItemIndices.clear();
+            m_ItemBounds.clear();
+            m_ItemLeaf.clear();
+        }
+
+        void BoundingVolumeHierarchy::buildNode(uint32_t                      nodeIndex,
+                                                const std::vector<glm::vec3>& centroids,
+                                                uint32_t                      depth)
+        {
+            const uint32_t first = m_Nodes[nodeIndex].first;
+            const uint32_t count = m_Nodes[nodeIndex].count;
+
+            BoundingBox bounds;
+            BoundingBox centroidBounds;
+            for (uint32_t i = first; i < first + count; i++)
+            {
+                bounds.expand(m_ItemBounds[m_ItemIndices[i]]);
+                centroidBounds.expand(centroids[m_ItemIndices[i]]);
+            }
+            m_Nodes[nodeIndex].bounds = bounds;
+
+            if (count <= MAX_LEAF_SIZE || depth >= MAX_DEPTH)
+            {
+                makeLeaf(nodeIndex);
+                return;
+            }
+
+            // Binned SAH over all three axes
+            struct Bin
+            {
+                BoundingBox bounds;
+                uint32_t    count {0};
+            };
+
+            const glm::vec3 centroidExtent = centroidBounds.getExtent();
+
+            auto getBin = [&](uint32_t item, int axis) {
+                const float offset = (centroids[item][axis] - centroidBounds.min[axis]) / centroidExtent[axis];
+                return std::min(SAH_BIN_COUNT - 1, static_cast<uint32_t>(offset * SAH_BIN_COUNT));
+            };
+
+            float    bestCost  = FLT_MAX;
+            int      bestAxis  = -1;
+            uint32_t bestSplit = 0;
+
+            for (int axis = 0; axis < 3; axis++)
+            {
+                if (centroidExtent[axis] <= 0.0f)
+                    continue;
+
+                std::array<Bin, SAH_BIN_COUNT> bins {};
+                for (uint32_t i = first; i < first + count; i++)
+                {
+                    const uint32_t item = m_ItemIndices[i];
+                    const uint32_t bin  = getBin(item, axis);
+                    bins[bin].bounds.expand(m_ItemBounds[item]);
+                    bins[bin].count++;
+                }
+
+                // Sweep from the right to get the area and count of every right side
+                std::array<float, SAH_BIN_COUNT - 1>    rightArea {};
+                std::array<uint32_t, SAH_BIN_COUNT - 1> rightCount {};
+                BoundingBox                             rightBounds;
+                uint32_t                                rightSum = 0;
+                for (uint32_t split = SAH_BIN_COUNT - 1; split > 0; split--)
+                {
+                    rightBounds.expand(bins[split].bounds);
+                    rightSum += bins[split].count;
+                    rightArea[split - 1]  = rightBounds.getSurfaceArea();
+                    rightCount[split - 1] = rightSum;
+                }
+
+                BoundingBox leftBounds;
+                uint32_t    leftSum = 0;
+                for (uint32_t split = 0; split < SAH_BIN_COUNT - 1; split++)
+                {
+                    leftBounds.expand(bins[split].bounds);
+                    leftSum += bins[split].count;
+                    if (leftSum == 0 || rightCount[split] == 0)
+                        continue;
+
+                    const float cost = leftBounds.getSurfaceArea() * leftSum + rightArea[split] * rightCount[split];
+                    if (cost < bestCost)
+                    {
+                        bestCost  = cost;
+                        bestAxis  = axis;
+                        bestSplit = split;
+                    }
+                }
+            }
+
+            // Cost relative to intersecting every item of this node (traversal step costs one item test)
+            const float parentArea = std::max(bounds.getSurfaceArea(), FLT_MIN);
+            const float splitCost  = 1.0f + bestCost / parentArea;
+            // No split exists when all centroids coincide; they cannot be separated spatially
+            if (bestAxis < 0 || (splitCost >= static_cast<float>(count) && count <= MAX_SAH_LEAF_SIZE))
+            {
+                makeLeaf(nodeIndex);
+                return;
+            }
+
+            auto* begin = m_ItemIndices.data() + first;
+            auto* end   = begin + count;
+            auto* mid   = std::partition(begin, end, [&](uint32_t item) {
+                return getBin(item, bestAxis) <= bestSplit;
+            });
+
+            if (mid == begin || mid == end)
+            {
+                // Degenerate binning, fall back to a median split on the widest axis
+                int axis = 0;
+                if (centroidExtent.y > centroidExtent[axis])
+                    axis = 1;
+                if (centroidExtent.z > centroidExtent[axis])
+                    axis = 2;
+
+                mid = begin + count / 2;
+                std::nth_element(begin, mid, end, [&](uint32_t a, uint32_t b) {
+                    return centroids[a][axis] < centroids[b][axis];
+                });
+            }
+
+            const auto leftCount = static_cast<uint32_t>(mid - begin);
+            const auto left      = static_cast<uint32_t>(m_Nodes.size());
+
+            m_Nodes.resize(m_Nodes.size() + 2);
+            m_Nodes[left]     = {.first = first, .count = leftCount, .parent = nodeIndex};
+            m_Nodes[left + 1] = {.first = first + leftCount, .count = count - leftCount, .parent = nodeIndex};
+
+            m_Nodes[nodeIndex].first = left;
+            m_Nodes[nodeIndex].count = 0;
+
+            buildNode(left, centroids, depth + 1);
+            buildNode(left + 1, centroids, depth + 1);
+        }
+
+        void BoundingVolumeHierarchy::makeLeaf(uint32_t nodeIndex)
+        {
+            const auto& node = m_Nodes[nodeIndex];
+            for (uint32_t i = node.first; i < node.first + node.count; i++)
+            {
+                m_ItemLeaf[m_ItemIndices[i]] = nodeIndex;
+            }
+        }
+
+        void BoundingVolumeHierarchy::updateItem(uint32_t item, const BoundingBox& bounds)
+        {
+            if (item >= m_ItemBounds.size() || m_ItemBounds[item] == bounds)
+                return;
+
+            m_ItemBounds[item] = bounds;
+            refitLeaf(m_ItemLeaf[item]);
+        }
+
+        void BoundingVolumeHierarchy::refitLeaf(uint32_t nodeIndex)
+        {
+            BoundingBox leafBounds;
+            for (const auto item : getLeafItems(m_Nodes[nodeIndex]))
+            {
+                leafBounds.expand(m_ItemBounds[item]);
+            }
+            if (leafBounds == m_Nodes[nodeIndex].bounds)
+                return;
+
+            m_Nodes[nodeIndex].bounds = leafBounds;
+
+            // Walk up until a node's bounds stay the same
+            for (uint32_t parent = m_Nodes[nodeIndex].parent; parent != INVALID_INDEX; parent = m_Nodes[parent].parent)
+            {
+                auto&       node   = m_Nodes[parent];
+                BoundingBox bounds = m_Nodes[node.first].bounds;
+                bounds.expand(m_Nodes[node.first + 1].bounds);
+                if (bounds == node.bounds)
+                    break;
+
+                node.bounds = bounds;
+            }
+        }
+
+        std::optional<BoundingVolumeHierarchy::RayHit> BoundingVolumeHierarchy::raycast(
+            const PickingRay& ray, float maxDistance, const ItemIntersector& intersector) const
+        {
+            if (m_Nodes.empty())
+                return std::nullopt;
+
+            const glm::vec3 invDirection = safeInverse(ray.direction);
+
+            RayHit best;
+            best.distance = maxDistance;
+
+            struct StackEntry
+            {
+                uint32_t node;
+                float    entry;
+            };
+
+            std::array<StackEntry, MAX_DEPTH * 2 + 2> stack;
+            uint32_t                                  stackSize = 0;
+
+            const float rootEntry = intersectSlabs(ray.origin, invDirection, m_Nodes[0].bounds, best.distance);
+            if (rootEntry == FLT_MAX)
+                return std::nullopt;
+            stack[stackSize++] = {0, rootEntry};
+
+            while (stackSize > 0)
+            {
+                const auto [nodeIndex, entry] = stack[--stackSize];
+                if (entry >= best.distance)
+                    continue;
+
+                const auto& node = m_Nodes[nodeIndex];
+                if (node.isLeaf())
+                {
+                    for (const auto item : getLeafItems(node))
+                    {
+                        float distance = intersectSlabs(ray.origin, invDirection, m_ItemBounds[item], best.distance);
+                        if (distance == FLT_MAX || distance >= best.distance)
+                            continue;
+
+                        if (intersector)
+                        {
+                            const auto exact = intersector(item, ray);
+                            if (!exact || *exact >= best.distance)
+                                continue;
+                            distance = *exact;
+                        }
+
+                        best = {item, distance};
+                    }
+                    continue;
+                }
+
+                const auto& leftBounds  = m_Nodes[node.first].bounds;
+                const auto& rightBounds = m_Nodes[node.first + 1].bounds;
+
+                float leftEntry  = intersectSlabs(ray.origin, invDirection, leftBounds, best.distance);
+                float rightEntry = intersectSlabs(ray.origin, invDirection, rightBounds, best.distance);
+
+                // Push the farther child first so the nearer one is visited next
+                uint32_t nearChild = node.first;
+                uint32_t farChild  = node.first + 1;
+                if (rightEntry < leftEntry)
+                {
+                    std::swap(nearChild, farChild);
+                    std::swap(leftEntry, rightEntry);
+                }
+
+                if (rightEntry != FLT_MAX)
+                    stack[stackSize++] = {farChild, rightEntry};
+                if (leftEntry != FLT_MAX)
+                    stack[stackSize++] = {nearChild, leftEntry};
+            }
+
+            if (best.item == INVALID_INDEX)
+                return std::nullopt;
+
+            return best;
+        }
+
+        void BoundingVolumeHierarchy::queryFrustum(const PackedFrustum& frustum, std::vector<uint32_t>& outItems) const
+        {
+            if (m_Nodes.empty())
+                return;
+
+            struct StackEntry
+            {
+                uint32_t node;
+                bool     inside;
+            };
+
+            std::array<StackEntry, MAX_DEPTH * 2 + 2> stack;
+            uint32_t                                  stackSize = 0;
+
+            stack[stackSize++] = {0, false};
+
+            while (stackSize > 0)
+            {
+                auto [nodeIndex, inside] = stack[--stackSize];
+
+                const auto& node = m_Nodes[nodeIndex];
+                if (!inside)
+                {
+                    const auto containment = frustum.classify(node.bounds);
+                    if (containment == Containment::eOutside)
+                        continue;
+                    inside = containment == Containment::eInside;
+                }
+
+                if (!node.isLeaf())
+                {
+                    stack[stackSize++] = {node.first + 1, inside};
+                    stack[stackSize++] = {node.first, inside};
+                    continue;
+                }
+
+                for (const auto item : getLeafItems(node))
+                {
+                    if (inside || frustum.intersects(m_ItemBounds[item]))
+                    {
+                        outItems.push_back(item);
+                    }
+                }
+            }
+        }
+    } // namespace editor
+} // namespace vultra
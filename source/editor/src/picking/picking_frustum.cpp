@@ -0,0 +1,125 @@
+#include "vultra_editor/picking/picking_frustum.hpp"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VULTRA_EDITOR_PICKING_SSE 1
+#include <xmmintrin.h>
+#endif
+
+namespace vultra
+{
+    namespace editor
+    {
+        void PickingFrustum::addPlane(const glm::vec3& normal, const glm::vec3& point)
+        {
+            // Degenerate planes (e.g. from a zero-area rectangle) would only produce NaN distances
+            const float length = glm::length(normal);
+            if (planeCount >= MAX_PLANES || length <= FLT_MIN)
+                return;
+
+            const glm::vec3 n    = normal / length;
+            planes[planeCount++] = glm::vec4(n, -glm::dot(n, point));
+        }
+
+        PickingFrustum PickingFrustum::fromCornerRays(const glm::vec3&                origin,
+                                                      const std::array<glm::vec3, 4>& directions)
+        {
+            const glm::vec3 center = directions[0] + directions[1] + directions[2] + directions[3];
+
+            PickingFrustum frustum;
+            for (size_t i = 0; i < directions.size(); i++)
+            {
+                glm::vec3 normal = glm::cross(directions[i], directions[(i + 1) % directions.size()]);
+                if (glm::dot(normal, center) < 0.0f)
+                {
+                    normal = -normal;
+                }
+                frustum.addPlane(normal, origin);
+            }
+
+            // Nothing behind the origin
+            frustum.addPlane(center, origin);
+            return frustum;
+        }
+
+        PackedFrustum::PackedFrustum(const PickingFrustum& frustum)
+        {
+            // Padding planes have a zero normal and a positive distance, so every box is fully inside them
+            m_Distance.fill(1.0f);
+
+            for (uint32_t i = 0; i < frustum.planeCount; i++)
+            {
+                const auto& plane = frustum.planes[i];
+
+                m_NormalX[i]    = plane.x;
+                m_NormalY[i]    = plane.y;
+                m_NormalZ[i]    = plane.z;
+                m_AbsNormalX[i] = std::abs(plane.x);
+                m_AbsNormalY[i] = std::abs(plane.y);
+                m_AbsNormalZ[i] = std::abs(plane.z);
+                m_Distance[i]   = plane.w;
+            }
+        }
+
+#if defined(VULTRA_EDITOR_PICKING_SSE)
+        Containment PackedFrustum::classify(const BoundingBox& box) const
+        {
+            const glm::vec3 center = box.getCenter();
+            const glm::vec3 half   = box.getExtent() * 0.5f;
+
+            const __m128 cx   = _mm_set1_ps(center.x);
+            const __m128 cy   = _mm_set1_ps(center.y);
+            const __m128 cz   = _mm_set1_ps(center.z);
+            const __m128 hx   = _mm_set1_ps(half.x);
+            const __m128 hy   = _mm_set1_ps(half.y);
+            const __m128 hz   = _mm_set1_ps(half.z);
+            const __m128 zero = _mm_setzero_ps();
+
+            int outsideMask  = 0;
+            int straddleMask = 0;
+            for (uint32_t i = 0; i < PickingFrustum::MAX_PLANES; i += 4)
+            {
+                __m128 distance = _mm_load_ps(m_Distance.data() + i);
+                distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_load_ps(m_NormalX.data() + i), cx));
+                distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_load_ps(m_NormalY.data() + i), cy));
+                distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_load_ps(m_NormalZ.data() + i), cz));
+
+                __m128 radius = _mm_mul_ps(_mm_load_ps(m_AbsNormalX.data() + i), hx);
+                radius        = _mm_add_ps(radius, _mm_mul_ps(_mm_load_ps(m_AbsNormalY.data() + i), hy));
+                radius        = _mm_add_ps(radius, _mm_mul_ps(_mm_load_ps(m_AbsNormalZ.data() + i), hz));
+
+                outsideMask |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+                straddleMask |= _mm_movemask_ps(_mm_cmplt_ps(_mm_sub_ps(distance, radius), zero));
+            }
+
+            if (outsideMask != 0)
+                return Containment::eOutside;
+
+            return straddleMask != 0 ? Containment::eIntersecting : Containment::eInside;
+        }
+#else
+        Containment PackedFrustum::classify(const BoundingBox& box) const
+        {
+            const glm::vec3 center = box.getCenter();
+            const glm::vec3 half   = box.getExtent() * 0.5f;
+
+            bool straddles = false;
+            for (uint32_t i = 0; i < PickingFrustum::MAX_PLANES; i++)
+            {
+                const float distance =
+                    m_NormalX[i] * center.x + m_NormalY[i] * center.y + m_NormalZ[i] * center.z + m_Distance[i];
+                const float radius = m_AbsNormalX[i] * half.x + m_AbsNormalY[i] * half.y + m_AbsNormalZ[i] * half.z;
+
+                if (distance + radius < 0.0f)
+                    return Containment::eOutside;
+                straddles |= distance - radius < 0.0f;
+            }
+
+            return straddles ? Containment::eIntersecting : Containment::eInside;
+        }
+#endif
+
+        bool PackedFrustum::intersects(const BoundingBox& box) const { return classify(box) != Containment::eOutside; }
+    } // namespace editor
+} // namespace vultra
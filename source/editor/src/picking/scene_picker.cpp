@@ -0,0 +1,228 @@
+#include "vultra_editor/picking/scene_picker.hpp"
+#include "vultra_editor/scene/entity_tombstone.hpp"
+#include "vultra_editor/scene/scene_change_tracker.hpp"
+
+#include <vultra/function/scenegraph/components.hpp>
+#include <vultra/function/scenegraph/logic_scene.hpp>
+#include <vultra_engine/scene/entity_bounds.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Refitting many moved entities degrades the tree, rebuilding is about as cheap at that point
+        constexpr size_t REBUILD_MOVED_DIVISOR = 4;
+
+        void ScenePicker::update(LogicScene* scene)
+        {
+            const auto hierarchyGeneration = SceneChangeTracker::getHierarchyGeneration();
+            const auto transformGeneration = SceneChangeTracker::getTransformGeneration();
+
+            if (scene != m_Scene || hierarchyGeneration != m_HierarchyGeneration)
+            {
+                m_Scene               = scene;
+                m_HierarchyGeneration = hierarchyGeneration;
+                m_TransformGeneration = transformGeneration;
+                rebuild();
+            }
+            else if (transformGeneration != m_TransformGeneration)
+            {
+                m_TransformGeneration = transformGeneration;
+                refit();
+            }
+        }
+
+        void ScenePicker::rebuild()
+        {
+            // Entities that are gone drop out of the cache, the rest keep their bounds unless their mesh changed
+            const BoundsCache previousBounds = std::move(m_BoundsCache);
+            m_BoundsCache.clear();
+
+            m_Items.clear();
+            m_BVH.clear();
+            if (!m_Scene)
+                return;
+
+            std::function<void(Entity&)> collect = [&](Entity& entity) {
+                // Deleted entities kept for undo are not part of the scene either, nor are their children
+                if (isTombstoned(entity))
+                    return;
+
+                // The editor camera is not part of the scene being edited
+                bool isEditorCamera =
+                    entity.hasComponent<CameraComponent>() && entity.getComponent<CameraComponent>().isEditorCamera;
+
+                if (!isEditorCamera && entity.hasComponent<TransformComponent>())
+                {
+                    auto& item       = m_Items.emplace_back();
+                    item.entity      = entity;
+                    item.transform   = entity.getComponent<TransformComponent>().getTransform();
+                    item.localBounds = resolveLocalBounds(entity, previousBounds);
+                }
+
+                for (auto& child : entity.getChildrenEntities())
+                    collect(child);
+            };
+            for (auto& root : m_Scene->getRootEntities())
+                collect(root);
+
+            std::vector<BoundingBox> worldBounds;
+            worldBounds.reserve(m_Items.size());
+            for (const auto& item : m_Items)
+            {
+                worldBounds.push_back(item.localBounds.transform(item.transform));
+            }
+            m_BVH.build(worldBounds);
+        }
+
+        void ScenePicker::refit()
+        {
+            std::vector<uint32_t> moved;
+            for (uint32_t i = 0; i < m_Items.size(); i++)
+            {
+                auto& item = m_Items[i];
+
+                const auto transform = item.entity.getComponent<TransformComponent>().getTransform();
+                if (transform != item.transform)
+                {
+                    item.transform = transform;
+                    moved.push_back(i);
+                }
+            }
+
+            if (moved.size() > m_Items.size() / REBUILD_MOVED_DIVISOR)
+            {
+                rebuild();
+                return;
+            }
+
+            for (const auto i : moved)
+            {
+                m_BVH.updateItem(i, m_Items[i].localBounds.transform(m_Items[i].transform));
+            }
+        }
+
+        BoundingBox ScenePicker::resolveLocalBounds(Entity& entity, const BoundsCache& previous)
+        {
+            const BoundingBox unitBounds {glm::vec3(-0.5f), glm::vec3(0.5f)};
+            if (!entity.hasComponent<RawMeshComponent>())
+                return unitBounds;
+
+            const auto& mesh = entity.getComponent<RawMeshComponent>().mesh;
+            if (!mesh)
+                return unitBounds;
+
+            CachedBounds cached;
+            cached.mesh        = std::to_address(mesh);
+            cached.vertexCount = mesh->vertices.size();
+
+            const auto uuid = entity.getCoreUUID();
+            const auto it   = previous.find(uuid);
+            if (it != previous.end() && it->second.mesh == cached.mesh && it->second.vertexCount == cached.vertexCount)
+            {
+                cached.bounds = it->second.bounds;
+            }
+            else if (auto bounds = engine::getEntityLocalBounds(entity))
+            {
+                cached.bounds = BoundingBox {bounds->min, bounds->max};
+            }
+            else
+            {
+                return unitBounds;
+            }
+
+            m_BoundsCache.emplace(uuid, cached);
+            return cached.bounds;
+        }
+
+        bool ScenePicker::isPickable(const PickItem& item) const
+        {
+            // Hidden entities are skipped at query time, toggling visibility does not touch the BVH
+            Entity      entity = item.entity;
+            const auto& flags  = entity.getComponent<EntityFlagsComponent>().flags;
+            return (flags & static_cast<uint32_t>(EntityFlags::eVisible)) != 0;
+        }
+
+        std::optional<float> ScenePicker::intersectItem(uint32_t item, const PickingRay& ray) const
+        {
+            const auto& pickItem = m_Items[item];
+            if (!isPickable(pickItem))
+                return std::nullopt;
+
+            // Oriented box test in local space. The local direction is not renormalized, so the distance along it is
+            // the same as along the world ray.
+            const glm::mat4 worldToLocal = glm::inverse(pickItem.transform);
+
+            PickingRay localRay;
+            localRay.origin    = glm::vec3(worldToLocal * glm::vec4(ray.origin, 1.0f));
+            localRay.direction = glm::vec3(worldToLocal * glm::vec4(ray.direction, 0.0f));
+
+            return intersectRayBox(localRay, pickItem.localBounds);
+        }
+
+        std::optional<ScenePickResult> ScenePicker::pick(const PickingRay& ray) const
+        {
+            const auto hit = m_BVH.raycast(ray, FLT_MAX, [this](uint32_t item, const PickingRay& itemRay) {
+                return intersectItem(item, itemRay);
+            });
+            if (!hit)
+                return std::nullopt;
+
+            ScenePickResult result;
+            result.entity   = m_Items[hit->item].entity;
+            result.distance = hit->distance;
+            result.bounds   = m_BVH.getItemBounds(hit->item);
+            return result;
+        }
+
+        std::vector<Entity> ScenePicker::pickAll(const PickingFrustum& frustum) const
+        {
+            std::vector<uint32_t> items;
+            m_BVH.queryFrustum(PackedFrustum(frustum), items);
+
+            std::vector<Entity> entities;
+            entities.reserve(items.size());
+            for (const auto item : items)
+            {
+                if (isPickable(m_Items[item]))
+                {
+                    entities.push_back(m_Items[item].entity);
+                }
+            }
+            return entities;
+        }
+
+        PickingRay ScenePicker::makeRay(const glm::mat4& view, const glm::mat4& projection, const glm::vec2& ndc)
+        {
+            // Any depth inside the clip volume lies on the ray, whatever the depth convention of the projection
+            const glm::mat4 inverseViewProjection = glm::inverse(projection * view);
+            glm::vec4       target                = inverseViewProjection * glm::vec4(ndc.x, ndc.y, 0.5f, 1.0f);
+            target /= target.w;
+
+            PickingRay ray;
+            ray.origin    = glm::vec3(glm::inverse(view)[3]);
+            ray.direction = glm::normalize(glm::vec3(target) - ray.origin);
+            return ray;
+        }
+
+        PickingFrustum ScenePicker::makeFrustum(const glm::mat4& view,
+                                                const glm::mat4& projection,
+                                                const glm::vec2& ndcMin,
+                                                const glm::vec2& ndcMax)
+        {
+            const std::array<glm::vec2, 4> corners = {
+                ndcMin, glm::vec2(ndcMax.x, ndcMin.y), ndcMax, glm::vec2(ndcMin.x, ndcMax.y)};
+
+            std::array<glm::vec3, 4> directions;
+            for (size_t i = 0; i < corners.size(); i++)
+            {
+                directions[i] = makeRay(view, projection, corners[i]).direction;
+            }
+
+            return PickingFrustum::fromCornerRays(glm::vec3(glm::inverse(view)[3]), directions);
+        }
+    } // namespace editor
+} // namespace vultra
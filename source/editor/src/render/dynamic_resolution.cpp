@@ -0,0 +1,67 @@
+#include "vultra_editor/render/dynamic_resolution.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // Weight of the newest frame in the average
+        constexpr float FRAME_TIME_SMOOTHING = 0.1f;
+        // No adjustment while the average is within this band around the budget
+        constexpr float OVER_BUDGET_RATIO  = 1.05f;
+        constexpr float UNDER_BUDGET_RATIO = 0.85f;
+
+        void DynamicResolutionController::setTargetFrameTime(float milliseconds)
+        {
+            m_TargetFrameTime = std::max(milliseconds, 1.0f);
+        }
+
+        void DynamicResolutionController::addFrameTime(float milliseconds)
+        {
+            if (m_SampleCount == 0 && m_AverageFrameTime == 0.0f)
+            {
+                m_AverageFrameTime = milliseconds;
+            }
+            else
+            {
+                m_AverageFrameTime += (milliseconds - m_AverageFrameTime) * FRAME_TIME_SMOOTHING;
+            }
+            m_SampleCount++;
+        }
+
+        bool DynamicResolutionController::update()
+        {
+            if (m_SampleCount < ADJUST_INTERVAL_FRAMES)
+                return false;
+            m_SampleCount = 0;
+
+            float scale = m_Scale;
+            if (m_AverageFrameTime > m_TargetFrameTime * OVER_BUDGET_RATIO)
+            {
+                // Pixel cost grows with the square of the scale
+                scale *= std::sqrt(m_TargetFrameTime / m_AverageFrameTime);
+                scale = std::floor(scale / SCALE_STEP) * SCALE_STEP;
+            }
+            else if (m_AverageFrameTime < m_TargetFrameTime * UNDER_BUDGET_RATIO)
+            {
+                scale += SCALE_STEP;
+            }
+
+            scale = std::clamp(scale, MIN_SCALE, MAX_SCALE);
+            if (scale == m_Scale)
+                return false;
+
+            m_Scale = scale;
+            return true;
+        }
+
+        void DynamicResolutionController::reset()
+        {
+            m_Scale            = MAX_SCALE;
+            m_AverageFrameTime = 0.0f;
+            m_SampleCount      = 0;
+        }
+    } // namespace editor
+} // namespace vultra
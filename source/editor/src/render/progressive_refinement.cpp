@@ -0,0 +1,36 @@
+#include "vultra_editor/render/progressive_refinement.hpp"
+
+namespace vultra
+{
+    namespace editor
+    {
+        void ProgressiveRefinement::update(bool isNavigating)
+        {
+            if (isNavigating)
+            {
+                m_Stage      = 0;
+                m_IdleFrames = 0;
+                return;
+            }
+
+            // Short pauses in the middle of navigating stay cheap
+            if (m_IdleFrames < IDLE_FRAMES_BEFORE_REFINE)
+            {
+                m_IdleFrames++;
+                return;
+            }
+
+            if (m_Stage + 1 < REFINEMENT_SCALES.size())
+            {
+                m_Stage++;
+            }
+        }
+
+        void ProgressiveRefinement::setEnabled(bool enabled)
+        {
+            m_IsEnabled  = enabled;
+            m_Stage      = static_cast<uint32_t>(REFINEMENT_SCALES.size() - 1);
+            m_IdleFrames = IDLE_FRAMES_BEFORE_REFINE;
+        }
+    } // namespace editor
+} // namespace vultra
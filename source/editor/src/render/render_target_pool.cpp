@@ -0,0 +1,143 @@
+#include "vultra_editor/render/render_target_pool.hpp"
+
+#include <vultra_engine/core/memory_tracker.hpp>
+
+#include <algorithm>
+
+namespace vultra
+{
+    namespace editor
+    {
+        // A free target is reused for an at-least request when it is at most this much larger in area
+        constexpr float MAX_REUSE_AREA_RATIO = 2.0f;
+
+        namespace
+        {
+            // RGBA8, single mip
+            uint64_t getTargetBytes(const PooledRenderTarget& target)
+            {
+                return static_cast<uint64_t>(target.getWidth()) * target.getHeight() * 4;
+            }
+        } // namespace
+
+        RenderTargetPool::~RenderTargetPool() { shutdown(); }
+
+        void RenderTargetPool::initialize(rhi::RenderDevice& rd)
+        {
+            shutdown();
+            m_RenderDevice = &rd;
+        }
+
+        void RenderTargetPool::shutdown()
+        {
+            if (!m_RenderDevice)
+                return;
+
+            for (auto& free : m_Free)
+            {
+                destroy(free.target);
+            }
+            m_Free.clear();
+            m_RenderDevice = nullptr;
+        }
+
+        void RenderTargetPool::update()
+        {
+            ++m_FrameIndex;
+
+            std::erase_if(m_Free, [this](FreeTarget& free) {
+                if (free.releasedFrame + POOL_IDLE_FRAMES > m_FrameIndex)
+                    return false;
+
+                destroy(free.target);
+                return true;
+            });
+        }
+
+        PooledRenderTarget RenderTargetPool::acquire(uint32_t width, uint32_t height)
+        {
+            auto it = std::find_if(m_Free.begin(), m_Free.end(), [&](const FreeTarget& free) {
+                return free.target.getWidth() == width && free.target.getHeight() == height;
+            });
+            if (it != m_Free.end())
+            {
+                auto target = std::move(it->target);
+                m_Free.erase(it);
+                return target;
+            }
+
+            return create(width, height);
+        }
+
+        PooledRenderTarget RenderTargetPool::acquireAtLeast(uint32_t width, uint32_t height)
+        {
+            const float requestedArea = static_cast<float>(width) * static_cast<float>(height);
+
+            // Smallest free target that fits
+            auto best = m_Free.end();
+            for (auto it = m_Free.begin(); it != m_Free.end(); ++it)
+            {
+                const auto& target = it->target;
+                if (target.getWidth() < width || target.getHeight() < height)
+                    continue;
+
+                const float area = static_cast<float>(target.getWidth()) * static_cast<float>(target.getHeight());
+                if (area > requestedArea * MAX_REUSE_AREA_RATIO)
+                    continue;
+
+                if (best == m_Free.end() ||
+                    area < static_cast<float>(best->target.getWidth()) * static_cast<float>(best->target.getHeight()))
+                {
+                    best = it;
+                }
+            }
+
+            if (best != m_Free.end())
+            {
+                auto target = std::move(best->target);
+                m_Free.erase(best);
+                return target;
+            }
+
+            auto roundUp = [](uint32_t size) {
+                return (size + SIZE_CLASS_STEP - 1) / SIZE_CLASS_STEP * SIZE_CLASS_STEP;
+            };
+            return create(roundUp(width), roundUp(height));
+        }
+
+        void RenderTargetPool::release(PooledRenderTarget target)
+        {
+            if (!target)
+                return;
+
+            m_Free.push_back({std::move(target), m_FrameIndex});
+        }
+
+        PooledRenderTarget RenderTargetPool::create(uint32_t width, uint32_t height)
+        {
+            PooledRenderTarget target;
+            target.texture      = createRef<rhi::Texture>(
+                rhi::Texture::Builder {}
+                    .setExtent({.width = std::max(width, 1u), .height = std::max(height, 1u)})
+                    .setPixelFormat(rhi::PixelFormat::eRGBA8_UNorm)
+                    .setNumMipLevels(1)
+                    .setUsageFlags(rhi::ImageUsage::eRenderTarget | rhi::ImageUsage::eSampled |
+                                   rhi::ImageUsage::eTransferDst)
+                    .setupOptimalSampler(true)
+                    .build(*m_RenderDevice));
+            target.imguiTexture = imgui::addTexture(*target.texture);
+
+            engine::MemoryTracker::onAllocate(engine::MemoryTag::eGPUImGui, getTargetBytes(target));
+            return target;
+        }
+
+        void RenderTargetPool::destroy(PooledRenderTarget& target)
+        {
+            if (target.imguiTexture)
+                imgui::removeTexture(*m_RenderDevice, target.imguiTexture);
+
+            engine::MemoryTracker::onFree(engine::MemoryTag::eGPUImGui, getTargetBytes(target));
+            target = {};
+        }
+    } // namespace editor
+} // namespace vultra
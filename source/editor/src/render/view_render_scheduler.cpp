@@ -0,0 +1,93 @@
+#include "vultra_editor/render/view_render_scheduler.hpp"
+
+#include <vultra/function/scenegraph/component_utils.hpp>
+#include <vultra/function/scenegraph/logic_scene.hpp>
+
+#include <cstring>
+#include <functional>
+
+namespace vultra
+{
+    namespace editor
+    {
+        constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+        bool ViewRenderScheduler::update(bool isVisible, const ViewState& state)
+        {
+            if (!isVisible)
+            {
+                // Whatever changed while hidden is picked up by the state comparison once the view shows again
+                m_ShouldRender = false;
+                return false;
+            }
+
+            if (!m_HasRendered || m_AlwaysRender || state != m_LastState)
+            {
+                m_SettleFramesLeft = SETTLE_FRAME_COUNT;
+            }
+
+            m_ShouldRender = m_SettleFramesLeft > 0;
+            if (m_ShouldRender)
+            {
+                m_SettleFramesLeft--;
+                m_HasRendered = true;
+                m_LastState   = state;
+            }
+            else
+            {
+                m_SkippedFrameCount++;
+            }
+
+            return m_ShouldRender;
+        }
+
+        uint64_t ViewRenderScheduler::hashCamera(Entity& camera)
+        {
+            auto& cameraComponent = camera.getComponent<CameraComponent>();
+            auto& cameraTransform = camera.getComponent<TransformComponent>();
+
+            const glm::mat4 view       = getCameraViewMatrix(cameraTransform);
+            const glm::mat4 projection = getCameraProjectionMatrix(cameraComponent, false);
+
+            return FrameStateHasher {}.add(view).add(projection).get();
+        }
+
+        uint64_t ViewRenderScheduler::hashSceneTransforms(LogicScene& scene)
+        {
+            FrameStateHasher hasher;
+
+            std::function<void(Entity&)> visit = [&](Entity& entity) {
+                hasher.add(static_cast<uint32_t>(entity));
+                hasher.add(entity.getComponent<EntityFlagsComponent>().flags);
+                if (entity.hasComponent<TransformComponent>())
+                {
+                    hasher.add(entity.getComponent<TransformComponent>().getTransform());
+                }
+
+                for (auto& child : entity.getChildrenEntities())
+                    visit(child);
+            };
+            for (auto& root : scene.getRootEntities())
+                visit(root);
+
+            return hasher.get();
+        }
+
+        void FrameStateHasher::addBytes(const void* data, size_t size)
+        {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+
+            size_t offset = 0;
+            for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+            {
+                uint64_t word;
+                std::memcpy(&word, bytes + offset, sizeof(word));
+                m_Hash = (m_Hash ^ word) * FNV_PRIME;
+            }
+            for (; offset < size; offset++)
+            {
+                m_Hash = (m_Hash ^ bytes[offset]) * FNV_PRIME;
+            }
+        }
+    } // namespace editor
+} // namespace vultra
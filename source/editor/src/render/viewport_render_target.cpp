@@ -0,0 +1,82 @@
+#include "vultra_editor/render/viewport_render_target.hpp"
+
+#include <algorithm>
+
+namespace vultra
+{
+    namespace editor
+    {
+        ViewportRenderTarget::~ViewportRenderTarget() { shutdown(); }
+
+        void ViewportRenderTarget::initialize(rhi::RenderDevice& rd, uint32_t width, uint32_t height)
+        {
+            shutdown();
+
+            m_Pool.initialize(rd);
+            m_ViewWidth  = std::max(width, 1u);
+            m_ViewHeight = std::max(height, 1u);
+            m_Target     = m_Pool.acquire(m_ViewWidth, m_ViewHeight);
+        }
+
+        void ViewportRenderTarget::shutdown()
+        {
+            m_Pool.release(std::move(m_Target));
+            m_Target = {};
+            m_Pool.shutdown();
+        }
+
+        bool ViewportRenderTarget::update(uint32_t viewWidth, uint32_t viewHeight, double time, bool immediate)
+        {
+            m_Pool.update();
+
+            viewWidth  = std::max(viewWidth, 1u);
+            viewHeight = std::max(viewHeight, 1u);
+            if (viewWidth != m_ViewWidth || viewHeight != m_ViewHeight)
+            {
+                m_ViewWidth      = viewWidth;
+                m_ViewHeight     = viewHeight;
+                m_LastResizeTime = time;
+            }
+
+            if (getWidth() == m_ViewWidth && getHeight() == m_ViewHeight)
+            {
+                m_IsResizing = false;
+                return false;
+            }
+
+            if (immediate || time - m_LastResizeTime >= RESIZE_DEBOUNCE_SECONDS)
+            {
+                m_IsResizing = false;
+                replaceTarget(m_Pool.acquire(m_ViewWidth, m_ViewHeight));
+                return true;
+            }
+
+            // Still resizing: keep the current target while the view fits in it
+            m_IsResizing = true;
+            if (getWidth() < m_ViewWidth || getHeight() < m_ViewHeight)
+            {
+                replaceTarget(m_Pool.acquireAtLeast(m_ViewWidth, m_ViewHeight));
+                return true;
+            }
+
+            return false;
+        }
+
+        glm::vec2 ViewportRenderTarget::getUVMin() const
+        {
+            if (!m_Target)
+                return glm::vec2(0.0f);
+
+            const glm::vec2 targetSize(static_cast<float>(getWidth()), static_cast<float>(getHeight()));
+            const glm::vec2 viewSize(static_cast<float>(m_ViewWidth), static_cast<float>(m_ViewHeight));
+
+            return glm::max((targetSize - viewSize) * 0.5f / targetSize, glm::vec2(0.0f));
+        }
+
+        void ViewportRenderTarget::replaceTarget(PooledRenderTarget target)
+        {
+            m_Pool.release(std::move(m_Target));
+            m_Target = std::move(target);
+        }
+    } // namespace editor
+} // namespace vultra
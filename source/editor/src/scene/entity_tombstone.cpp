@@ -0,0 +1,73 @@
+#include "vultra_editor/scene/entity_tombstone.hpp"
+
+#include <utility>
+
+namespace vultra
+{
+    namespace editor
+    {
+        namespace
+        {
+            template<typename T>
+            void stashComponent(Entity& entity, std::optional<T>& slot)
+            {
+                if (!entity.hasComponent<T>())
+                    return;
+
+                slot = std::move(entity.getComponent<T>());
+                entity.removeComponent<T>();
+            }
+
+            template<typename T>
+            void unstashComponent(Entity& entity, std::optional<T>& slot)
+            {
+                if (!slot)
+                    return;
+
+                entity.addComponent<T>(std::move(*slot));
+                slot.reset();
+            }
+        } // namespace
+
+        void tombstoneEntity(Entity& entity)
+        {
+            if (!entity.hasComponent<TombstoneComponent>())
+            {
+                auto& flags          = entity.getComponent<EntityFlagsComponent>().flags;
+                auto& tombstone      = entity.addComponent<TombstoneComponent>();
+                tombstone.savedFlags = flags;
+                flags &= ~static_cast<uint32_t>(EntityFlags::eVisible);
+
+                std::apply([&entity](auto&... slots) { (stashComponent(entity, slots), ...); }, tombstone.stash);
+            }
+            entity.getComponent<TombstoneComponent>().count++;
+
+            for (auto& child : entity.getChildrenEntities())
+                tombstoneEntity(child);
+        }
+
+        void restoreEntity(Entity& entity)
+        {
+            for (auto& child : entity.getChildrenEntities())
+                restoreEntity(child);
+
+            if (!entity.hasComponent<TombstoneComponent>())
+                return;
+
+            auto& tombstone = entity.getComponent<TombstoneComponent>();
+            if (--tombstone.count > 0)
+                return;
+
+            // Only visibility and the stashed components were changed by the tombstone, so only they are restored
+            constexpr auto visibleFlag = static_cast<uint32_t>(EntityFlags::eVisible);
+
+            auto& flags = entity.getComponent<EntityFlagsComponent>().flags;
+            flags       = (flags & ~visibleFlag) | (tombstone.savedFlags & visibleFlag);
+
+            std::apply([&entity](auto&... slots) { (unstashComponent(entity, slots), ...); }, tombstone.stash);
+            entity.removeComponent<TombstoneComponent>();
+        }
+
+        bool isTombstoned(Entity& entity) { return entity.hasComponent<TombstoneComponent>(); }
+    } // namespace editor
+} // namespace vultra
@@ -181,6 +181,7 @@ namespace vultra
                 }
             }
 
+            m_IsZooming = false;
             if (m_IsWindowHovered)
             {
                 // Zoom in / out
@@ -190,6 +191,7 @@ namespace vultra
 
                 float yOffset = ImGui::GetIO().MouseWheel * m_BaseSpeed * 5.0f;
                 transform.position += yOffset * forward;
+                m_IsZooming = yOffset != 0.0f;
 
                 // Focus
                 if (ImGui::IsKeyDown(ImGuiKey_F))
@@ -2,6 +2,8 @@
 
 #include <vultra/core/base/common_context.hpp>
 
+#include <algorithm>
+
 namespace vultra
 {
     namespace editor
@@ -21,64 +23,90 @@ namespace vultra
             }
         }
 
-        std::unordered_map<SelectionCategory, std::vector<CoreUUID>> Selector::s_SelectionMap;
+        std::unordered_map<SelectionCategory, Selector::SelectionSet> Selector::s_SelectionMap;
         SelectionCategory Selector::s_LastSelectionCategory = SelectionCategory::eNone;
         CoreUUID          Selector::s_LastSelectionUUID;
+        uint64_t          Selector::s_Generation = 0;
 
         void Selector::select(SelectionCategory category, CoreUUID selectionId)
         {
             auto& selections = s_SelectionMap[category];
-            if (std::find(selections.begin(), selections.end(), selectionId) != selections.end())
+            if (!insert(selections, selectionId))
             {
                 return;
             }
 
-            selections.emplace_back(selectionId);
-
             s_LastSelectionCategory = category;
             s_LastSelectionUUID     = selectionId;
+            markChanged(selections);
 
             VULTRA_CLIENT_TRACE("Selected ID: {} in category: {}", selectionId.toString(), to_string(category));
         }
 
+        void Selector::select(SelectionCategory category, std::span<const CoreUUID> selectionIds)
+        {
+            auto& selections = s_SelectionMap[category];
+            selections.items.reserve(selections.items.size() + selectionIds.size());
+            selections.indices.reserve(selections.indices.size() + selectionIds.size());
+
+            bool changed = false;
+            for (const auto& selectionId : selectionIds)
+            {
+                changed |= insert(selections, selectionId);
+            }
+
+            if (!changed)
+            {
+                return;
+            }
+
+            s_LastSelectionCategory = category;
+            s_LastSelectionUUID     = selectionIds.back();
+            markChanged(selections);
+
+            VULTRA_CLIENT_TRACE("Selected {} IDs in category: {}", selectionIds.size(), to_string(category));
+        }
+
         void Selector::unselect(SelectionCategory category, CoreUUID selectionId)
         {
             auto& selections = s_SelectionMap[category];
-            auto  it         = std::find(selections.begin(), selections.end(), selectionId);
-            if (it == selections.end())
+            if (!erase(selections, selectionId))
             {
                 return;
             }
 
-            selections.erase(it);
+            resetLastSelection(category, selections);
+            markChanged(selections);
+        }
+
+        void Selector::unselect(SelectionCategory category, std::span<const CoreUUID> selectionIds)
+        {
+            auto& selections = s_SelectionMap[category];
 
-            // Reset last selection if it matches the unselected one
-            if (s_LastSelectionCategory == category && s_LastSelectionUUID == selectionId)
+            bool changed = false;
+            for (const auto& selectionId : selectionIds)
             {
-                s_LastSelectionCategory = SelectionCategory::eNone;
-                s_LastSelectionUUID     = CoreUUID {};
+                changed |= erase(selections, selectionId);
             }
+
+            if (!changed)
+            {
+                return;
+            }
+
+            resetLastSelection(category, selections);
+            markChanged(selections);
         }
 
         void Selector::unselect(CoreUUID selectionId)
         {
             for (auto& [category, selections] : s_SelectionMap)
             {
-                auto it = std::find(selections.begin(), selections.end(), selectionId);
-                if (it == selections.end())
+                if (selections.indices.contains(selectionId))
                 {
-                    continue;
+                    unselect(category, selectionId);
+                    break;
                 }
-
-                selections.erase(it);
-                break;
-            }
-
-            // Reset last selection if it matches the unselected one
-            if (s_LastSelectionUUID == selectionId)
-            {
-                s_LastSelectionCategory = SelectionCategory::eNone;
-                s_LastSelectionUUID     = CoreUUID {};
             }
         }
 
@@ -86,7 +114,14 @@ namespace vultra
         {
             for (auto& [category, selections] : s_SelectionMap)
             {
-                selections.clear();
+                if (selections.indices.empty())
+                {
+                    continue;
+                }
+
+                selections.items.clear();
+                selections.indices.clear();
+                markChanged(selections);
             }
 
             s_LastSelectionCategory = SelectionCategory::eNone;
@@ -95,7 +130,13 @@ namespace vultra
 
         void Selector::unselectAll(SelectionCategory category)
         {
-            s_SelectionMap[category].clear();
+            auto& selections = s_SelectionMap[category];
+            if (!selections.indices.empty())
+            {
+                selections.items.clear();
+                selections.indices.clear();
+                markChanged(selections);
+            }
 
             if (s_LastSelectionCategory == category)
             {
@@ -104,12 +145,79 @@ namespace vultra
             }
         }
 
+        void Selector::toggle(SelectionCategory category, CoreUUID selectionId)
+        {
+            if (isSelected(category, selectionId))
+            {
+                unselect(category, selectionId);
+            }
+            else
+            {
+                select(category, selectionId);
+            }
+        }
+
+        void Selector::setSelection(SelectionCategory category, std::span<const CoreUUID> selectionIds)
+        {
+            auto& selections = s_SelectionMap[category];
+
+            // Dedupe first, so repeated IDs in the input cannot make an unchanged set look different
+            SelectionSet next;
+            next.items.reserve(selectionIds.size());
+            next.indices.reserve(selectionIds.size());
+            for (const auto& selectionId : selectionIds)
+            {
+                insert(next, selectionId);
+            }
+
+            const bool sameSet = next.items.size() == selections.indices.size() &&
+                                 std::all_of(next.items.begin(), next.items.end(), [&selections](const CoreUUID& id) {
+                                     return selections.indices.contains(id);
+                                 });
+
+            if (next.items.empty())
+            {
+                if (s_LastSelectionCategory == category)
+                {
+                    s_LastSelectionCategory = SelectionCategory::eNone;
+                    s_LastSelectionUUID     = CoreUUID {};
+                }
+            }
+            else
+            {
+                // Also for a reordered but otherwise unchanged set: the last ID is what the user picked last
+                s_LastSelectionCategory = category;
+                s_LastSelectionUUID     = next.items.back();
+            }
+
+            if (sameSet)
+            {
+                return;
+            }
+
+            selections.items   = std::move(next.items);
+            selections.indices = std::move(next.indices);
+            markChanged(selections);
+        }
+
+        void Selector::invalidate(SelectionCategory category) { markChanged(s_SelectionMap[category]); }
+
         CoreUUID Selector::getSelection(SelectionCategory category, size_t index)
         {
-            return s_SelectionMap[category][index];
+            return getSelections(category)[index];
         }
 
-        size_t Selector::getSelectionCount(SelectionCategory category) { return s_SelectionMap[category].size(); }
+        size_t Selector::getSelectionCount(SelectionCategory category)
+        {
+            return s_SelectionMap[category].indices.size();
+        }
+
+        const std::vector<CoreUUID>& Selector::getSelections(SelectionCategory category)
+        {
+            auto& selections = s_SelectionMap[category];
+            compact(selections);
+            return selections.items;
+        }
 
         CoreUUID Selector::getLastSelection(SelectionCategory category)
         {
@@ -120,10 +228,10 @@ namespace vultra
 
             CoreUUID result {};
 
-            auto selections = getSelections(category);
+            const auto& selections = getSelections(category);
             if (!selections.empty())
             {
-                result = selections[selections.size() - 1];
+                result = selections.back();
             }
 
             return result;
@@ -131,8 +239,81 @@ namespace vultra
 
         bool Selector::isSelected(SelectionCategory category, CoreUUID selectionId)
         {
-            const auto& selections = s_SelectionMap[category];
-            return std::find(selections.begin(), selections.end(), selectionId) != selections.end();
+            return s_SelectionMap[category].indices.contains(selectionId);
+        }
+
+        bool Selector::insert(SelectionSet& selections, const CoreUUID& selectionId)
+        {
+            auto [it, inserted] =
+                selections.indices.try_emplace(selectionId, static_cast<uint32_t>(selections.items.size()));
+            if (inserted)
+            {
+                selections.items.push_back(selectionId);
+            }
+            return inserted;
+        }
+
+        bool Selector::erase(SelectionSet& selections, const CoreUUID& selectionId)
+        {
+            // The slot stays behind as a hole; bounded so that select/unselect cycles without reads cannot pile them up
+            if (selections.indices.erase(selectionId) == 0)
+            {
+                return false;
+            }
+
+            if (selections.items.size() > 2 * selections.indices.size() + 64)
+            {
+                compact(selections);
+            }
+            return true;
+        }
+
+        void Selector::compact(SelectionSet& selections)
+        {
+            if (selections.items.size() == selections.indices.size())
+            {
+                return;
+            }
+
+            // A slot is live if its item is indexed at exactly that slot; a re-selected item has a newer slot
+            uint32_t next = 0;
+            for (uint32_t slot = 0; slot < selections.items.size(); slot++)
+            {
+                const auto it = selections.indices.find(selections.items[slot]);
+                if (it == selections.indices.end() || it->second != slot)
+                {
+                    continue;
+                }
+
+                it->second               = next;
+                selections.items[next++] = selections.items[slot];
+            }
+            selections.items.resize(next);
+        }
+
+        void Selector::markChanged(SelectionSet& selections)
+        {
+            selections.generation++;
+            s_Generation++;
+        }
+
+        void Selector::resetLastSelection(SelectionCategory category, const SelectionSet& selections)
+        {
+            if (s_LastSelectionCategory != category || selections.indices.contains(s_LastSelectionUUID))
+            {
+                return;
+            }
+
+            // Fall back to the newest remaining selection
+            if (selections.indices.empty())
+            {
+                s_LastSelectionCategory = SelectionCategory::eNone;
+                s_LastSelectionUUID     = CoreUUID {};
+            }
+            else
+            {
+                s_LastSelectionUUID = getSelections(category).back();
+            }
         }
     } // namespace editor
 } // namespace vultra
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <imgui.h>
 #include <imgui_internal.h>
 
+#include <chrono>
 #include <future>
 
 namespace vultra
@@ -38,6 +39,9 @@ namespace vultra
         {
             ImGui::Begin(m_Name.c_str(), nullptr, ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse);
 
+            // Both panels render from the cached snapshot; the filesystem is only scanned when it is invalidated
+            m_DirectoryTree = AssetDatabase::get()->getDirectoryTree();
+
             const ImVec2 region            = ImGui::GetContentRegionAvail();
             const float  splitterThickness = 4.0f;
             const float  minRatio          = 0.1f;
@@ -58,13 +62,15 @@ namespace vultra
             // Left: FileSystem Tree
             ImGui::BeginChild("##LeftPanel", ImVec2(leftWidth, 0), true);
             {
-                if (exists(m_AssetRoot))
+                if (m_DirectoryTree && !m_DirectoryTree->empty())
                 {
+                    const auto& root = m_DirectoryTree->getRoot();
+
                     ImGui::SetNextItemOpen(true, ImGuiCond_Always);
-                    if (ImGui::TreeNodeEx(m_AssetRoot.filename().string().c_str(),
+                    if (ImGui::TreeNodeEx(root.name.c_str(),
                                           ImGuiTreeNodeFlags_DefaultOpen | ImGuiTreeNodeFlags_SpanAvailWidth))
                     {
-                        drawDirectoryRecursive(m_AssetRoot);
+                        drawDirectoryRecursive(root);
                         ImGui::TreePop();
                     }
                 }
@@ -114,19 +120,20 @@ namespace vultra
             ImGui::End();
         }
 
-        void AssetBrowserWindow::drawDirectoryRecursive(const std::filesystem::path& dirPath)
+        void AssetBrowserWindow::drawDirectoryRecursive(const AssetDirectoryNode& dirNode)
         {
-            using namespace std::filesystem;
-
-            for (const auto& entry : directory_iterator(dirPath))
+            for (uint32_t childIndex : dirNode.children)
             {
-                if (!entry.is_directory())
-                    continue; // Skip files
+                const auto& child = m_DirectoryTree->getNode(childIndex);
+                if (!child.isDirectory)
+                    break; // Directories are sorted first
 
-                const auto&       path = entry.path();
-                const std::string name = path.filename().string();
+                const auto&        path = child.path;
+                const std::string& name = child.name;
 
                 ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_SpanAvailWidth;
+                if (!child.hasSubdirectories)
+                    flags |= ImGuiTreeNodeFlags_Leaf;
 
                 if (path == m_CurrentDir)
                     flags |= ImGuiTreeNodeFlags_Selected;
@@ -151,7 +158,7 @@ namespace vultra
                 // Recursively draw subfolders
                 if (open)
                 {
-                    drawDirectoryRecursive(path);
+                    drawDirectoryRecursive(child);
                     ImGui::TreePop();
                 }
             }
@@ -159,7 +166,8 @@ namespace vultra
 
         void AssetBrowserWindow::drawRightPanel()
         {
-            if (!exists(m_CurrentDir))
+            const AssetDirectoryNode* currentNode = m_DirectoryTree ? m_DirectoryTree->find(m_CurrentDir) : nullptr;
+            if (!currentNode || !currentNode->isDirectory)
             {
                 ImGui::TextDisabled("No valid directory selected.");
                 return;
@@ -172,11 +180,22 @@ namespace vultra
                     m_SelectedPath.clear();
             }
 
+            // Rescan
+            if (ImGui::SmallButton(ICON_MDI_REFRESH))
+            {
+                AssetDatabase::get()->invalidateDirectoryTree();
+            }
+            if (ImGui::IsItemHovered())
+            {
+                ImGui::SetTooltip("Rescan the asset folder");
+            }
+            ImGui::SameLine();
+
             // Filter input
             ImGui::TextUnformatted("Filter:");
             ImGui::SameLine();
             ImGui::PushItemWidth(-1);
-            ImGui::InputText("##Filter", m_FilterBuffer, sizeof(m_FilterBuffer));
+            ImGui::InputTextWithHint("##Filter", "e.g. t:texture helmet", m_FilterBuffer, sizeof(m_FilterBuffer));
             ImGui::PopItemWidth();
 
             ImGui::Separator();
@@ -217,6 +236,12 @@ namespace vultra
                 }
             }
 
+            if (m_FilterBuffer[0] != '\0')
+            {
+                updateSearchResults(*currentNode);
+                ImGui::TextDisabled("%zu results (%.2f ms)", m_SearchResults.size(), m_SearchMs);
+            }
+
             ImGui::Separator();
 
             // Icon grid
@@ -233,45 +258,28 @@ namespace vultra
             }
             ImGui::Columns(columns, nullptr, false);
 
-            std::vector<std::filesystem::path> filesToShow;
+            std::vector<const AssetDirectoryNode*> filesToShow;
 
-            std::string filter = m_FilterBuffer;
-            if (!filter.empty())
+            if (m_FilterBuffer[0] != '\0')
             {
-                // --- Recursive search when filter is active ---
-                std::function<void(const std::filesystem::path&)> searchRecursive =
-                    [&](const std::filesystem::path& dir) {
-                        for (const auto& entry : std::filesystem::directory_iterator(dir))
-                        {
-                            const auto&       path = entry.path();
-                            const std::string name = path.filename().string();
-
-                            if (entry.is_directory())
-                            {
-                                searchRecursive(path);
-                            }
-                            else
-                            {
-                                if (name.find(filter) != std::string::npos)
-                                    filesToShow.push_back(path);
-                            }
-                        }
-                    };
-
-                searchRecursive(m_CurrentDir);
+                // --- Indexed search below the current directory when filter is active ---
+                updateSearchResults(*currentNode);
+                for (uint32_t nodeIndex : m_SearchResults)
+                    filesToShow.push_back(&m_DirectoryTree->getNode(nodeIndex));
             }
             else
             {
                 // --- Normal listing of current directory ---
-                for (const auto& entry : std::filesystem::directory_iterator(m_CurrentDir))
-                    filesToShow.push_back(entry.path());
+                for (uint32_t childIndex : currentNode->children)
+                    filesToShow.push_back(&m_DirectoryTree->getNode(childIndex));
             }
 
             // Draw items
-            for (const auto& path : filesToShow)
+            for (const auto* node : filesToShow)
             {
-                std::string name  = path.stem().string();
-                bool        isDir = std::filesystem::is_directory(path);
+                const auto&        path  = node->path;
+                const std::string& name  = node->stem;
+                bool               isDir = node->isDirectory;
 
                 ImGui::PushID(name.c_str());
 
@@ -289,12 +297,14 @@ namespace vultra
                         continue;
                     }
 
-                    auto uuid       = AssetDatabase::get()->getMetaUUID(path);
-                    auto assetEntry = AssetDatabase::get()->getRegistry().lookup(uuid);
+                    auto meta      = AssetDatabase::get()->getMeta(path);
+                    auto uuid      = meta ? meta->uuid : vasset::VUUID {};
+                    auto assetType = meta ? meta->type : vasset::VAssetType {};
 
-                    if (assetEntry.type == vasset::VAssetType::eTexture)
+                    if (assetType == vasset::VAssetType::eTexture)
                     {
-                        auto* texId      = AssetDatabase::get()->getImGuiTextureByUUID(uuid);
+                        // Only the small cached preview is ever uploaded for the grid
+                        auto* texId      = AssetDatabase::get()->getThumbnailByUUID(uuid, path);
                         auto  imguiTexId = static_cast<ImTextureID>(reinterpret_cast<intptr_t>(texId));
 
                         ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(0, 0));
@@ -307,11 +317,11 @@ namespace vultra
 
                         ImGui::PopStyleVar(2);
                     }
-                    else if (assetEntry.type == vasset::VAssetType::eMesh)
+                    else if (assetType == vasset::VAssetType::eMesh)
                     {
                         ImGui::Button(ICON_MDI_CUBE, ImVec2(iconSize, iconSize));
                     }
-                    else if (assetEntry.type == vasset::VAssetType::eMaterial)
+                    else if (assetType == vasset::VAssetType::eMaterial)
                     {
                         ImGui::Button(ICON_MDI_FORMAT_PAINT, ImVec2(iconSize, iconSize));
                     }
@@ -384,17 +394,9 @@ namespace vultra
                 {
                     if (ImGui::MenuItem("Reimport"))
                     {
-                        std::future<void> future;
-                        if (isDir)
-                        {
-                            future = std::async(std::launch::async,
-                                                [path]() { AssetDatabase::get()->reimportFolder(path); });
-                        }
-                        else
-                        {
-                            future =
-                                std::async(std::launch::async, [path]() { AssetDatabase::get()->reimportAsset(path); });
-                        }
+                        // Goes through the same queue as file watcher reimports, so the two never overlap
+                        std::future<void> future = isDir ? AssetDatabase::get()->queueReimportFolder(path) :
+                                                           AssetDatabase::get()->queueReimport(path);
                         m_ReimportProgressWidget.setFuture(std::move(future));
                         m_ReimportProgressWidget.open("Reimporting asset...");
                     }
@@ -421,13 +423,38 @@ namespace vultra
             ImGui::Columns(1);
         }
 
+        void AssetBrowserWindow::updateSearchResults(const AssetDirectoryNode& scopeNode)
+        {
+            const uint64_t generation = AssetDatabase::get()->getDirectoryTreeGeneration();
+            if (m_SearchText == m_FilterBuffer && m_SearchScope == m_CurrentDir && m_SearchGeneration == generation)
+                return;
+
+            m_SearchText       = m_FilterBuffer;
+            m_SearchScope      = m_CurrentDir;
+            m_SearchGeneration = generation;
+            m_SearchResults.clear();
+
+            auto searchIndex = AssetDatabase::get()->getSearchIndex();
+            if (!searchIndex)
+                return;
+
+            const auto start = std::chrono::steady_clock::now();
+
+            auto query = AssetSearchQuery::parse(m_SearchText);
+            for (const auto& result : searchIndex->search(query, m_DirectoryTree->getNodeIndex(scopeNode)))
+                m_SearchResults.push_back(result.nodeIndex);
+
+            m_SearchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
         void AssetBrowserWindow::selectPath(const std::filesystem::path& path)
         {
-            if (exists(path))
+            const AssetDirectoryNode* node = m_DirectoryTree ? m_DirectoryTree->find(path) : nullptr;
+            if (node)
             {
                 m_SelectedPath = path;
 
-                if (!std::filesystem::is_directory(path))
+                if (!node->isDirectory)
                 {
                     // Single selection for now
                     Selector::unselectAll(SelectionCategory::eAsset);
@@ -2,6 +2,8 @@
 
 #include <IconsMaterialDesignIcons.h>
 
+#include <algorithm>
+
 namespace
 {
     // Helper function to convert log level to ImGui color
@@ -57,12 +59,8 @@ namespace vultra
             eType
         };
 
-        const uint32_t MAX_LOG_MESSAGES = 3500;
-
         ConsoleWindow::ConsoleWindow() : UIWindow("Console")
         {
-            m_LogMessages.resize(MAX_LOG_MESSAGES);
-            m_LogMessagesEnd    = 0;
             m_LogMessagesFilter = getLogLevelFlag(LogLevel::eMaxLevels) - 1;
             m_AllowToBottom     = true;
             m_RequestToBottom   = false;
@@ -71,13 +69,7 @@ namespace vultra
                 // Only log client events
                 if (event.region != Logger::Region::eClient)
                     return;
-                if (m_LogMessagesEnd >= MAX_LOG_MESSAGES)
-                {
-                    m_LogMessagesEnd = 0;
-                }
-                m_LogMessages[m_LogMessagesEnd++] = {event.level, event.msg};
-                if (m_AllowToBottom)
-                    m_RequestToBottom = true;
+                m_LogBuffer.push(event.level, event.msg);
             });
         }
 
@@ -85,6 +77,11 @@ namespace vultra
 
         void ConsoleWindow::onImGui()
         {
+            if (m_LogBuffer.drain() > 0 && m_AllowToBottom)
+            {
+                m_RequestToBottom = true;
+            }
+
             ImGui::Begin(m_Name.c_str());
 
             ImGuiStyle& style = ImGui::GetStyle();
@@ -99,13 +96,17 @@ namespace vultra
 
             float levelButtonWidth = ImGui::CalcTextSize(getLogLevelIcon(static_cast<LogLevel>(1))).x +
                                      ImGui::GetStyle().FramePadding.x * 2.0f;
-            float levelButtonWidths = (levelButtonWidth + ImGui::GetStyle().ItemSpacing.x) * 5;
+            // Regex toggle plus one button per level
+            float levelButtonWidths = (levelButtonWidth + ImGui::GetStyle().ItemSpacing.x) * 6;
 
             {
                 ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[0]);
                 ImGui::PushStyleVar(ImGuiStyleVar_FrameBorderSize, 0.0f);
                 ImGui::PushStyleColor(ImGuiCol_FrameBg, IM_COL32(0, 0, 0, 0));
-                m_Filter.Draw("###ConsoleFilter", ImGui::GetContentRegionAvail().x - (levelButtonWidths));
+                if (m_Filter.Draw("###ConsoleFilter", ImGui::GetContentRegionAvail().x - (levelButtonWidths)))
+                {
+                    m_VisibleRowsDirty = true;
+                }
                 auto*  drawList = ImGui::GetWindowDrawList();
                 ImVec2 min      = ImGui::GetItemRectMin();
                 ImVec2 max      = ImGui::GetItemRectMax();
@@ -121,11 +122,38 @@ namespace vultra
                 {
                     drawList->AddRect(min, max, ImColor(80, 80, 80), 2.0f, 0, 1.0f);
                 }
+                if (m_UseRegex && !m_FilterRegexError.empty())
+                {
+                    drawList->AddRect(min, max, ImColor(255, 64, 64), 2.0f, 0, 1.5f);
+                    if (ImGui::IsItemHovered())
+                    {
+                        ImGui::SetTooltip("%s", m_FilterRegexError.c_str());
+                    }
+                }
                 ImGui::PopStyleColor();
                 ImGui::PopStyleVar();
                 ImGui::PopFont();
             }
 
+            // Regex toggle
+            ImGui::SameLine();
+            {
+                ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.0f, 0.0f, 0.0f, 0.0f));
+                ImGui::PushStyleColor(ImGuiCol_Text,
+                                      m_UseRegex ? ImGui::GetStyleColorVec4(ImGuiCol_Text) :
+                                                   ImVec4(0.5f, 0.5f, 0.5f, 0.5f));
+                if (ImGui::Button(ICON_MDI_REGEX))
+                {
+                    m_UseRegex         = !m_UseRegex;
+                    m_VisibleRowsDirty = true;
+                }
+                if (ImGui::IsItemHovered())
+                {
+                    ImGui::SetTooltip("Regular expression (case insensitive)");
+                }
+                ImGui::PopStyleColor(2);
+            }
+
             // Log level buttons
             ImGui::SameLine();
             for (int i = 0; i < 5; i++)
@@ -146,6 +174,7 @@ namespace vultra
                 if (ImGui::Button(getLogLevelIcon(level)))
                 {
                     m_LogMessagesFilter ^= levelFlag;
+                    m_VisibleRowsDirty = true;
                 }
 
                 if (ImGui::IsItemHovered())
@@ -159,7 +188,7 @@ namespace vultra
             ImGui::GetStyle().ItemSpacing.x = spacing;
 
             // Clear button
-            if (!m_Filter.IsActive())
+            if (m_Filter.InputBuf[0] == '\0')
             {
                 ImGui::SameLine();
                 ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[0]);
@@ -172,6 +201,19 @@ namespace vultra
 
             ImGui::Separator();
 
+            const bool filtered =
+                isTextFilterActive() || m_LogMessagesFilter != getLogLevelFlag(LogLevel::eMaxLevels) - 1;
+            if (filtered)
+            {
+                updateVisibleRows();
+            }
+            else
+            {
+                // Nothing to index; rebuilt once a filter is set again
+                m_VisibleRows.clear();
+                m_VisibleRowsDirty = true;
+            }
+
             if (ImGui::BeginTable("Messages",
                                   2,
                                   ImGuiTableFlags_NoSavedSettings | ImGuiTableFlags_Borders |
@@ -188,57 +230,20 @@ namespace vultra
                 ImGui::TableHeadersRow();
                 // ImGuiUtilities::AlternatingRowsBackground();
 
-                ImGui::TableNextRow();
+                // Only the rows inside the scroll region are submitted
+                const auto rowCount = filtered ? m_VisibleRows.size() : m_LogBuffer.size();
 
-                for (uint16_t i = 0; i < m_LogMessagesEnd; i++)
+                ImGuiListClipper clipper;
+                clipper.Begin(static_cast<int>(rowCount));
+                while (clipper.Step())
                 {
-                    const auto& level      = m_LogMessages[i].level;
-                    const auto& messageStr = m_LogMessages[i].message;
-                    const auto  levelFlag  = getLogLevelFlag(level);
-
-                    if (m_Filter.IsActive())
-                    {
-                        if (m_Filter.PassFilter(messageStr.c_str()))
-                        {
-                            if (m_LogMessagesFilter & levelFlag)
-                            {
-                                ImGui::TableNextColumn();
-
-                                ImGui::PushStyleColor(ImGuiCol_Text, getLogLevelColor(level));
-                                const auto* levelIcon = getLogLevelIcon(level);
-                                ImGui::SetCursorPosX(ImGui::GetCursorPosX() + ImGui::GetColumnWidth() -
-                                                     ImGui::CalcTextSize(levelIcon).x - ImGui::GetScrollX() -
-                                                     2 * ImGui::GetStyle().ItemSpacing.x);
-                                ImGui::TextUnformatted(levelIcon);
-
-                                ImGui::PopStyleColor();
-
-                                ImGui::TableNextColumn();
-                                ImGui::TextUnformatted(messageStr.c_str());
-                                ImGui::TableNextRow();
-                            }
-                        }
-                    }
-                    else
+                    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
                     {
-                        if (m_LogMessagesFilter & levelFlag)
-                        {
-                            ImGui::TableNextColumn();
-                            ImGui::PushStyleColor(ImGuiCol_Text, getLogLevelColor(level));
-                            const auto* levelIcon = getLogLevelIcon(level);
-                            ImGui::SetCursorPosX(ImGui::GetCursorPosX() + ImGui::GetColumnWidth() -
-                                                 ImGui::CalcTextSize(levelIcon).x - ImGui::GetScrollX() -
-                                                 2 * ImGui::GetStyle().ItemSpacing.x);
-                            ImGui::TextUnformatted(levelIcon);
-
-                            ImGui::PopStyleColor();
-
-                            ImGui::TableNextColumn();
-                            ImGui::TextUnformatted(messageStr.c_str());
-                            ImGui::TableNextRow();
-                        }
+                        const auto index = filtered ? m_VisibleRows[row] - m_LogBuffer.getFirstSequence() : row;
+                        drawLogEntry(m_LogBuffer[index]);
                     }
                 }
+
                 if (m_RequestToBottom && ImGui::GetScrollMaxY() > 0)
                 {
                     ImGui::SetScrollHereY(1.0f);
@@ -249,5 +254,84 @@ namespace vultra
 
             ImGui::End();
         }
+
+        bool ConsoleWindow::isTextFilterActive() const
+        {
+            // ImGuiTextFilter ignores patterns made of separators only, a regex does not
+            return m_UseRegex ? m_Filter.InputBuf[0] != '\0' : m_Filter.IsActive();
+        }
+
+        bool ConsoleWindow::passesFilters(const ConsoleLogBuffer::Entry& entry) const
+        {
+            if (!(m_LogMessagesFilter & getLogLevelFlag(entry.level)))
+                return false;
+
+            if (!isTextFilterActive())
+                return true;
+
+            if (m_UseRegex)
+                return m_FilterRegex && std::regex_search(entry.text, entry.text + entry.length, *m_FilterRegex);
+
+            return m_Filter.PassFilter(entry.text, entry.text + entry.length);
+        }
+
+        void ConsoleWindow::updateVisibleRows()
+        {
+            if (m_VisibleRowsDirty)
+            {
+                m_VisibleRows.clear();
+                m_IndexedEnd       = 0;
+                m_VisibleRowsDirty = false;
+
+                m_FilterRegex.reset();
+                m_FilterRegexError.clear();
+                if (m_UseRegex && isTextFilterActive())
+                {
+                    try
+                    {
+                        m_FilterRegex.emplace(m_Filter.InputBuf,
+                                              std::regex::ECMAScript | std::regex::icase | std::regex::optimize);
+                    }
+                    catch (const std::regex_error& e)
+                    {
+                        m_FilterRegexError = e.what();
+                    }
+                }
+            }
+
+            // Drop rows whose entries have been released from the history
+            const uint64_t firstSequence = m_LogBuffer.getFirstSequence();
+            while (!m_VisibleRows.empty() && m_VisibleRows.front() < firstSequence)
+            {
+                m_VisibleRows.pop_front();
+            }
+
+            // Only test what arrived since the last frame
+            for (uint64_t sequence = std::max(m_IndexedEnd, firstSequence); sequence < m_LogBuffer.getEndSequence();
+                 sequence++)
+            {
+                if (passesFilters(m_LogBuffer[sequence - firstSequence]))
+                {
+                    m_VisibleRows.push_back(sequence);
+                }
+            }
+            m_IndexedEnd = m_LogBuffer.getEndSequence();
+        }
+
+        void ConsoleWindow::drawLogEntry(const ConsoleLogBuffer::Entry& entry)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+
+            ImGui::PushStyleColor(ImGuiCol_Text, getLogLevelColor(entry.level));
+            const auto* levelIcon = getLogLevelIcon(entry.level);
+            ImGui::SetCursorPosX(ImGui::GetCursorPosX() + ImGui::GetColumnWidth() - ImGui::CalcTextSize(levelIcon).x -
+                                 ImGui::GetScrollX() - 2 * ImGui::GetStyle().ItemSpacing.x);
+            ImGui::TextUnformatted(levelIcon);
+            ImGui::PopStyleColor();
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(entry.text, entry.text + entry.length);
+        }
     } // namespace editor
 } // namespace vultra
\ No newline at end of file
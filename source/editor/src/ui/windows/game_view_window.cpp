@@ -1,4 +1,6 @@
 #include "vultra_editor/ui/windows/game_view_window.hpp"
+#include "vultra_editor/asset/asset_database.hpp"
+#include "vultra_editor/scene/scene_change_tracker.hpp"
 
 #include <vultra/function/scenegraph/entity.hpp>
 #include <vultra/function/scenegraph/logic_scene.hpp>
@@ -6,12 +8,21 @@
 #include <IconsMaterialDesignIcons.h>
 #include <imgui.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
 namespace vultra
 {
     using namespace imgui_literals;
 
     namespace editor
     {
+        constexpr float MIN_FRAME_BUDGET_MS = 4.0f;
+        constexpr float MAX_FRAME_BUDGET_MS = 100.0f;
+        // Per frame, how fast the refresh interval estimate follows longer frames
+        constexpr float REFRESH_ESTIMATE_RISE = 0.002f;
+
         GameViewWindow::GameViewWindow() : UIWindow("Game View") {}
 
         GameViewWindow::~GameViewWindow() = default;
@@ -19,9 +30,11 @@ namespace vultra
         void GameViewWindow::onInit(rhi::RenderDevice& renderDevice)
         {
             UIWindow::onInit(renderDevice);
-            recreateRenderTexture(800, 600);
+            m_RenderTarget.initialize(renderDevice, 800, 600);
         }
 
+        void GameViewWindow::onDestroy() { m_RenderTarget.shutdown(); }
+
         void GameViewWindow::onImGui()
         {
             ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
@@ -32,6 +45,7 @@ namespace vultra
             {
                 ImGui::End();
                 m_FirstFrame = false;
+                m_RenderScheduler.update(false, {});
                 return;
             }
 
@@ -75,21 +89,53 @@ namespace vultra
 
             m_TargetSize *= scale;
 
-            // Resize render texture & update main camera viewport size if needed
-            if (static_cast<uint32_t>(m_TargetSize.x) != m_GameRenderTexture.getExtent().width ||
-                static_cast<uint32_t>(m_TargetSize.y) != m_GameRenderTexture.getExtent().height)
+            // With dynamic resolution the scene renders at a fraction of the target size and the image is upscaled
+            bool  scaleChanged = m_IsDynamicResolutionEnabled && m_DynamicResolution.update();
+            float renderScale  = m_IsDynamicResolutionEnabled ? m_DynamicResolution.getScale() : 1.0f;
+
+            // A scene streaming in from a file may not have its main camera yet
+            auto mainCamera = m_LogicScene->getMainCamera();
+            if (!mainCamera || !mainCamera.hasComponent<CameraComponent>())
             {
-                auto  mainCamera               = m_LogicScene->getMainCamera();
-                auto& cameraComponent          = mainCamera.getComponent<CameraComponent>();
-                cameraComponent.viewPortWidth  = static_cast<uint32_t>(m_TargetSize.x);
-                cameraComponent.viewPortHeight = static_cast<uint32_t>(m_TargetSize.y);
-                recreateRenderTexture(static_cast<uint32_t>(m_TargetSize.x), static_cast<uint32_t>(m_TargetSize.y));
+                ImGui::TextDisabled("No main camera");
+                ImGui::EndChild();
+                ImGui::End();
+                m_RenderScheduler.update(false, {});
+                return;
             }
 
-            ImGui::Image(m_GameTexture, renderSize);
+            // Resize render target & update main camera viewport size; the camera projects to the whole target
+            if (m_RenderTarget.update(static_cast<uint32_t>(std::round(m_TargetSize.x * renderScale)),
+                                      static_cast<uint32_t>(std::round(m_TargetSize.y * renderScale)),
+                                      ImGui::GetTime(),
+                                      scaleChanged))
+            {
+                m_RenderScheduler.invalidate();
+            }
+
+            auto& cameraComponent          = mainCamera.getComponent<CameraComponent>();
+            cameraComponent.viewPortWidth  = m_RenderTarget.getWidth();
+            cameraComponent.viewPortHeight = m_RenderTarget.getHeight();
+
+            const auto uvMin = m_RenderTarget.getUVMin();
+            const auto uvMax = m_RenderTarget.getUVMax();
+            ImGui::Image(m_RenderTarget.getImGuiTexture(), renderSize, {uvMin.x, uvMin.y}, {uvMax.x, uvMax.y});
 
             ImGui::EndChild();
             ImGui::End();
+
+            // The game view shows the simulated scene, which changes without going through the editor
+            ViewRenderScheduler::ViewState viewState;
+            viewState.scene      = m_LogicScene;
+            viewState.sceneHash  = FrameStateHasher {}
+                                      .add(SceneChangeTracker::getGeneration())
+                                      .add(AssetDatabase::get()->getContentGeneration())
+                                      .add(ViewRenderScheduler::hashSceneTransforms(*m_LogicScene))
+                                      .get();
+            viewState.cameraHash = ViewRenderScheduler::hashCamera(mainCamera);
+            viewState.width      = m_RenderTarget.getWidth();
+            viewState.height     = m_RenderTarget.getHeight();
+            m_RenderScheduler.update(m_IsWindowOpen, viewState);
         }
 
         void GameViewWindow::drawToolbar()
@@ -150,10 +196,81 @@ namespace vultra
                 ImGui::SliderFloat("##ZoomSlider", &m_UserZoom, 0.25f, 4.0f, "%.2fx");
             }
 
+            ImGui::SameLine(0, 16_dpx);
+            {
+                bool alwaysRender = m_RenderScheduler.isAlwaysRender();
+                if (alwaysRender)
+                    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.18f, 0.46f, 0.98f, 1.0f));
+                if (ImGui::Button(ICON_MDI_AUTORENEW))
+                    m_RenderScheduler.setAlwaysRender(!alwaysRender);
+                if (alwaysRender)
+                    ImGui::PopStyleColor();
+
+                if (ImGui::IsItemHovered())
+                {
+                    ImGui::SetTooltip("Always refresh. Otherwise the view only renders when something in it changed.");
+                }
+            }
+
+            // --- Dynamic Resolution ---
+            ImGui::SameLine(0, 16_dpx);
+            {
+                bool enabled = m_IsDynamicResolutionEnabled;
+                if (enabled)
+                    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.18f, 0.46f, 0.98f, 1.0f));
+                if (ImGui::Button(ICON_MDI_SPEEDOMETER))
+                {
+                    m_IsDynamicResolutionEnabled = !enabled;
+                    m_DynamicResolution.reset();
+                }
+                if (enabled)
+                    ImGui::PopStyleColor();
+
+                if (ImGui::IsItemHovered())
+                {
+                    ImGui::SetTooltip("Dynamic resolution: lower the render scale to hold the render time budget.");
+                }
+            }
+
+            if (m_IsDynamicResolutionEnabled)
+            {
+                // A budget below the refresh interval cannot buy anything, frames are not shown any sooner
+                const float minBudget = std::max(MIN_FRAME_BUDGET_MS, m_RefreshIntervalEstimate);
+
+                float budget = std::max(m_DynamicResolution.getTargetFrameTime(), minBudget);
+                if (budget != m_DynamicResolution.getTargetFrameTime())
+                {
+                    m_DynamicResolution.setTargetFrameTime(budget);
+                }
+
+                ImGui::SameLine();
+                ImGui::SetNextItemWidth(80_dpx);
+                if (ImGui::DragFloat("##FrameBudget",
+                                     &budget,
+                                     0.1f,
+                                     minBudget,
+                                     MAX_FRAME_BUDGET_MS,
+                                     "%.1f ms",
+                                     ImGuiSliderFlags_AlwaysClamp))
+                {
+                    m_DynamicResolution.setTargetFrameTime(budget);
+                }
+                if (ImGui::IsItemHovered())
+                {
+                    ImGui::SetTooltip("CPU render time budget of this view, at least the refresh interval (%.1f ms)",
+                                      m_RefreshIntervalEstimate);
+                }
+
+                ImGui::SameLine();
+                ImGui::Text("Scale: %d%% (CPU %.1f ms)",
+                            static_cast<int>(std::round(m_DynamicResolution.getScale() * 100.0f)),
+                            m_DynamicResolution.getAverageFrameTime());
+            }
+
             ImGui::SameLine(0, 16_dpx);
             ImGui::Text("Res: %dx%d",
-                        static_cast<int>(m_GameRenderTexture.getExtent().width),
-                        static_cast<int>(m_GameRenderTexture.getExtent().height));
+                        static_cast<int>(m_RenderTarget.getWidth()),
+                        static_cast<int>(m_RenderTarget.getHeight()));
         }
 
         glm::vec3 GameViewWindow::computeTargetResolution(const ImVec2& avail) const
@@ -207,25 +324,30 @@ namespace vultra
             {
                 m_LogicScene->setSimulationMode(LogicSceneSimulationMode::eGame);
             }
+
+            // Frames are never presented faster than the display refreshes, so the shortest recent frame is a good
+            // estimate of the refresh interval. It follows drops at once and rises back slowly.
+            const float frameInterval = ctx.dt.count() * 1000.0f;
+            if (m_RefreshIntervalEstimate == 0.0f || frameInterval < m_RefreshIntervalEstimate)
+                m_RefreshIntervalEstimate = frameInterval;
+            else
+                m_RefreshIntervalEstimate += (frameInterval - m_RefreshIntervalEstimate) * REFRESH_ESTIMATE_RISE;
+
+            if (!m_RenderScheduler.shouldRender())
+                return;
+
             ctx.renderer->setScene(m_LogicScene);
-            ctx.renderer->render(ctx.cb, &m_GameRenderTexture, ctx.dt);
-        }
 
-        void GameViewWindow::recreateRenderTexture(uint32_t width, uint32_t height)
-        {
-            m_GameRenderTexture = rhi::Texture::Builder {}
-                                      .setExtent({.width = width, .height = height})
-                                      .setPixelFormat(rhi::PixelFormat::eRGBA8_UNorm)
-                                      .setNumMipLevels(1)
-                                      .setUsageFlags(rhi::ImageUsage::eRenderTarget | rhi::ImageUsage::eSampled |
-                                                     rhi::ImageUsage::eTransferDst)
-                                      .setupOptimalSampler(true)
-                                      .build(*m_RenderDevice);
-
-            if (m_GameTexture)
-                imgui::removeTexture(*m_RenderDevice, m_GameTexture);
-
-            m_GameTexture = imgui::addTexture(m_GameRenderTexture);
+            // The view's own cost drives the render scale, not the whole editor frame (other views, vsync waits). This
+            // is the CPU time spent recording the view: the RHI has no timestamp queries to read back the GPU time.
+            const auto renderStart = std::chrono::steady_clock::now();
+            ctx.renderer->render(ctx.cb, m_RenderTarget.getTexture(), ctx.dt);
+            const std::chrono::duration<float, std::milli> renderTime = std::chrono::steady_clock::now() - renderStart;
+
+            if (m_IsDynamicResolutionEnabled)
+            {
+                m_DynamicResolution.addFrameTime(renderTime.count());
+            }
         }
     } // namespace editor
 } // namespace vultra
\ No newline at end of file
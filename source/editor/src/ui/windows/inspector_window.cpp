@@ -1,5 +1,8 @@
 #include "vultra_editor/ui/windows/inspector_window.hpp"
 #include "vultra_editor/asset/asset_database.hpp"
+#include "vultra_editor/history/command_history.hpp"
+#include "vultra_editor/history/scene_commands.hpp"
+#include "vultra_editor/scene/scene_change_tracker.hpp"
 
 #include <vultra/function/renderer/imgui_renderer.hpp>
 
@@ -10,6 +13,12 @@ namespace vultra
 {
     namespace editor
     {
+        namespace
+        {
+            // Merge source of the Inspector's history entries: edits merge until no widget is active anymore
+            const char s_InspectorEditSource = 0;
+        } // namespace
+
         InspectorWindow::InspectorWindow() : UIWindow("Inspector") {}
 
         InspectorWindow::~InspectorWindow() = default;
@@ -24,10 +33,23 @@ namespace vultra
             {
                 if (m_LogicScene)
                 {
-                    Entity entity = m_LogicScene->getEntityWithCoreUUID(lastSelectionUUID);
-                    if (entity)
+                    // Resolve the entity only when the selection or the scene changed
+                    const auto selectionGeneration = Selector::getGeneration();
+                    if (selectionGeneration != m_SelectionGeneration || m_LogicScene != m_SelectionScene)
                     {
-                        drawEntityProperties(entity);
+                        m_SelectionGeneration = selectionGeneration;
+                        m_SelectionScene      = m_LogicScene;
+                        m_SelectedEntity      = m_LogicScene->getEntityWithCoreUUID(lastSelectionUUID);
+                    }
+
+                    if (m_SelectedEntity)
+                    {
+                        drawEntityProperties(m_SelectedEntity);
+                    }
+
+                    if (!ImGui::IsAnyItemActive())
+                    {
+                        CommandHistory::seal(&s_InspectorEditSource);
                     }
                 }
             }
@@ -49,7 +71,7 @@ namespace vultra
 
             if (entity.hasComponent<TransformComponent>())
             {
-                drawComponentTransform(entity.getComponent<TransformComponent>());
+                drawComponentTransform(entity, entity.getComponent<TransformComponent>());
             }
         }
 
@@ -57,13 +79,16 @@ namespace vultra
 
         void InspectorWindow::drawComponentFlags(EntityFlagsComponent& comp) { ImGui::Text("Flags: 0x%X", comp.flags); }
 
-        void InspectorWindow::drawComponentTransform(TransformComponent& comp)
+        void InspectorWindow::drawComponentTransform(Entity& entity, TransformComponent& comp)
         {
             if (!ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen))
                 return;
 
             ImGui::Indent();
 
+            const TransformComponent before       = comp;
+            const glm::mat4          oldTransform = comp.getTransform();
+
             // Position
             ImGuiExt::DrawVec3Control("Position", comp.position);
 
@@ -75,13 +100,21 @@ namespace vultra
             // Scale
             ImGuiExt::DrawVec3Control("Scale", comp.scale, 1.0f);
 
+            if (comp.getTransform() != oldTransform)
+            {
+                SceneChangeTracker::markTransformsChanged();
+
+                std::vector<TransformCommand::Delta> deltas = {{entity.getCoreUUID(), before, comp}};
+                CommandHistory::push(std::make_unique<TransformCommand>(std::move(deltas)), &s_InspectorEditSource);
+            }
+
             ImGui::Unindent();
         }
 
         void InspectorWindow::drawAssetProperties(const CoreUUID& assetUUID)
         {
             auto* assetDB    = AssetDatabase::get();
-            auto  assetEntry = assetDB->getRegistry().lookup(assetUUID);
+            auto  assetEntry = assetDB->lookupAsset(assetUUID);
             if (assetEntry.type == vasset::VAssetType::eTexture)
             {
                 ImGui::Text("Texture Asset:");
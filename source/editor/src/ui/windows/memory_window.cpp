@@ -0,0 +1,206 @@
+#include "vultra_editor/ui/windows/memory_window.hpp"
+
+#include <vultra/core/base/common_context.hpp>
+
+#include <IconsMaterialDesignIcons.h>
+#include <imgui.h>
+#include <implot/implot.h>
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <string>
+
+namespace
+{
+    using vultra::engine::MemoryTag;
+    using vultra::engine::MemoryTracker;
+
+    constexpr double BYTES_PER_MEGABYTE = 1024.0 * 1024.0;
+
+    std::string formatBytes(double bytes)
+    {
+        if (bytes < 0.0)
+            return "-" + formatBytes(-bytes);
+        if (bytes >= 1024.0 * BYTES_PER_MEGABYTE)
+            return std::format("{:.2f} GB", bytes / (1024.0 * BYTES_PER_MEGABYTE));
+        if (bytes >= BYTES_PER_MEGABYTE)
+            return std::format("{:.1f} MB", bytes / BYTES_PER_MEGABYTE);
+        if (bytes >= 1024.0)
+            return std::format("{:.1f} KB", bytes / 1024.0);
+        return std::format("{:.0f} B", bytes);
+    }
+} // namespace
+
+namespace vultra
+{
+    namespace editor
+    {
+        MemoryWindow::MemoryWindow() : UIWindow("Memory")
+        {
+            // Opened from the Window menu; the tracker counts either way
+            m_IsOpen = false;
+        }
+
+        void MemoryWindow::onImGui()
+        {
+            if (!ImGui::Begin(m_Name.c_str(), &m_IsOpen))
+            {
+                ImGui::End();
+                return;
+            }
+
+            if (ImGui::Button(ICON_MDI_RESTORE " Reset Peaks"))
+            {
+                MemoryTracker::resetPeaks();
+            }
+            ImGui::SameLine();
+            if (ImGui::Button(ICON_MDI_EXPORT " Export Snapshot"))
+            {
+                exportSnapshot();
+            }
+            if (!MemoryTracker::isHeapTracked())
+            {
+                ImGui::SameLine();
+                ImGui::TextDisabled("Heap tracking is off, only GPU memory is counted (build with memory_hook).");
+            }
+
+            drawHistory();
+            drawTagTable();
+
+            ImGui::End();
+        }
+
+        void MemoryWindow::drawHistory()
+        {
+            const auto&  history = MemoryTracker::getHistory();
+            const size_t count   = MemoryTracker::getHistoryCount();
+            const size_t offset  = MemoryTracker::getHistoryOffset();
+            if (count == 0)
+                return;
+
+            const float displayScale = ImGui::GetStyle().FontScaleDpi;
+            if (ImPlot::BeginPlot("##MemoryHistory",
+                                  ImVec2(-1.0f, 140.0f * displayScale),
+                                  ImPlotFlags_NoMenus | ImPlotFlags_NoBoxSelect))
+            {
+                ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoDecorations, ImPlotAxisFlags_AutoFit);
+                ImPlot::SetupAxisLimits(ImAxis_X1,
+                                        0.0,
+                                        static_cast<double>(MemoryTracker::HISTORY_SIZE) *
+                                            MemoryTracker::SAMPLE_INTERVAL_SECONDS,
+                                        ImPlotCond_Always);
+                ImPlot::SetupAxisFormat(ImAxis_Y1, "%.0f MB");
+                ImPlot::SetupLegend(ImPlotLocation_NorthWest, ImPlotLegendFlags_Outside);
+
+                for (size_t i = 0; i < MemoryTracker::TAG_COUNT; i++)
+                {
+                    const auto label = engine::to_string(static_cast<MemoryTag>(i));
+                    ImPlot::PlotLines(label.c_str(),
+                                      history[i].data(),
+                                      static_cast<int>(count),
+                                      MemoryTracker::SAMPLE_INTERVAL_SECONDS,
+                                      0.0,
+                                      0,
+                                      static_cast<int>(offset));
+                }
+
+                ImPlot::EndPlot();
+            }
+        }
+
+        void MemoryWindow::drawTagTable()
+        {
+            const ImGuiTableFlags flags = ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_RowBg |
+                                          ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable;
+            if (!ImGui::BeginTable("##MemoryTags", 7, flags))
+                return;
+
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Tag", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Live", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Peak", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Allocs/s", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Bytes/s", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Budget (MB)", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Usage", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableHeadersRow();
+
+            int64_t cpuLiveBytes = 0;
+            int64_t gpuLiveBytes = 0;
+            for (size_t i = 0; i < MemoryTracker::TAG_COUNT; i++)
+            {
+                const auto tag   = static_cast<MemoryTag>(i);
+                const auto stats = MemoryTracker::getStats(tag);
+                (engine::isGPUMemoryTag(tag) ? gpuLiveBytes : cpuLiveBytes) += stats.liveBytes;
+
+                ImGui::PushID(static_cast<int>(i));
+                ImGui::TableNextRow();
+
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(engine::to_string(tag).c_str());
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(formatBytes(static_cast<double>(stats.liveBytes)).c_str());
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(formatBytes(static_cast<double>(stats.peakBytes)).c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f", stats.allocationsPerSecond);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(std::format("{}/s", formatBytes(stats.bytesPerSecond)).c_str());
+
+                // 0 = no budget
+                ImGui::TableNextColumn();
+                double budgetMegabytes = static_cast<double>(stats.budgetBytes) / BYTES_PER_MEGABYTE;
+                ImGui::SetNextItemWidth(90.0f * ImGui::GetStyle().FontScaleDpi);
+                if (ImGui::InputDouble(
+                        "##Budget", &budgetMegabytes, 0.0, 0.0, "%.0f", ImGuiInputTextFlags_EnterReturnsTrue))
+                {
+                    const double budgetBytes = std::max(budgetMegabytes, 0.0) * BYTES_PER_MEGABYTE;
+                    MemoryTracker::setBudget(tag, static_cast<uint64_t>(budgetBytes));
+                }
+
+                ImGui::TableNextColumn();
+                if (stats.budgetBytes > 0)
+                {
+                    const float usage = static_cast<float>(stats.liveBytes) / static_cast<float>(stats.budgetBytes);
+                    if (usage > 1.0f)
+                        ImGui::PushStyleColor(ImGuiCol_PlotHistogram, ImVec4(0.85f, 0.25f, 0.25f, 1.0f));
+                    ImGui::ProgressBar(std::min(usage, 1.0f),
+                                       ImVec2(-FLT_MIN, 0.0f),
+                                       std::format("{:.0f}%", usage * 100.0f).c_str());
+                    if (usage > 1.0f)
+                        ImGui::PopStyleColor();
+                }
+
+                ImGui::PopID();
+            }
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextDisabled("Total CPU / GPU");
+            ImGui::TableNextColumn();
+            ImGui::TextDisabled("%s / %s",
+                                formatBytes(static_cast<double>(cpuLiveBytes)).c_str(),
+                                formatBytes(static_cast<double>(gpuLiveBytes)).c_str());
+
+            ImGui::EndTable();
+        }
+
+        void MemoryWindow::exportSnapshot()
+        {
+            const auto directory = m_SnapshotDirectory.empty() ? std::filesystem::current_path() : m_SnapshotDirectory;
+            const auto now       = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+            const auto filePath  = directory / std::format("memory_{:%Y%m%d_%H%M%S}.json", now);
+
+            std::error_code ec;
+            std::filesystem::create_directories(directory, ec);
+
+            if (!MemoryTracker::writeSnapshot(filePath))
+            {
+                VULTRA_CLIENT_ERROR("Failed to write memory snapshot: {}", filePath.generic_string());
+                return;
+            }
+            VULTRA_CLIENT_INFO("Saved memory snapshot {}", filePath.generic_string());
+        }
+    } // namespace editor
+} // namespace vultra
@@ -0,0 +1,253 @@
+#include "vultra_editor/ui/windows/profiler_window.hpp"
+
+#include <IconsMaterialDesignIcons.h>
+#include <imgui.h>
+#include <implot/implot.h>
+
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr double FRAME_TARGETS_MS[] = {1000.0 / 60.0, 1000.0 / 30.0};
+
+    double toMilliseconds(uint64_t ns) { return static_cast<double>(ns) / 1e6; }
+
+    // Stable color per scope name, so a window keeps its color from frame to frame
+    ImU32 getScopeColor(std::string_view name)
+    {
+        const size_t hash = std::hash<std::string_view> {}(name);
+        const float  hue  = static_cast<float>(hash % 360) / 360.0f;
+
+        float r, g, b;
+        ImGui::ColorConvertHSVtoRGB(hue, 0.45f, 0.75f, r, g, b);
+        return ImGui::ColorConvertFloat4ToU32(ImVec4(r, g, b, 1.0f));
+    }
+
+    // Inclusive time minus the inclusive time of the direct children
+    std::vector<uint64_t> computeSelfTimes(const vultra::engine::ProfileFrame& frame)
+    {
+        std::vector<uint64_t> selfNs(frame.scopes.size());
+        std::vector<uint32_t> parents;
+        for (uint32_t i = 0; i < frame.scopes.size(); i++)
+        {
+            const auto& scope = frame.scopes[i];
+            selfNs[i]         = scope.endNs - scope.beginNs;
+
+            while (parents.size() > scope.depth)
+                parents.pop_back();
+            if (!parents.empty())
+                selfNs[parents.back()] -= std::min(selfNs[parents.back()], scope.endNs - scope.beginNs);
+
+            parents.push_back(i);
+        }
+        return selfNs;
+    }
+} // namespace
+
+namespace vultra
+{
+    namespace editor
+    {
+        ProfilerWindow::ProfilerWindow() : UIWindow("Profiler")
+        {
+            // Nothing is recorded until the window is opened from the Window menu
+            m_IsOpen = false;
+        }
+
+        void ProfilerWindow::onImGui()
+        {
+            if (!m_IsFrozen)
+            {
+                m_Frame = engine::Profiler::getLastFrame();
+            }
+
+            if (!ImGui::Begin(m_Name.c_str(), &m_IsOpen))
+            {
+                ImGui::End();
+                return;
+            }
+
+            ImGui::Checkbox(ICON_MDI_RECORD " Record", &m_IsRecording);
+            ImGui::SameLine();
+            ImGui::Checkbox(ICON_MDI_PAUSE " Freeze", &m_IsFrozen);
+            ImGui::SameLine();
+            ImGui::TextDisabled("Frame %llu: %.2f ms",
+                                static_cast<unsigned long long>(m_Frame.index),
+                                toMilliseconds(m_Frame.durationNs));
+
+            drawFrameTimeHistory();
+
+            if (m_Frame.scopes.empty())
+            {
+                ImGui::TextDisabled("%s", m_IsRecording ? "Waiting for the next frame..." : "Recording is off.");
+            }
+            else
+            {
+                drawFlameGraph();
+                drawScopeTable();
+            }
+
+            ImGui::End();
+        }
+
+        void ProfilerWindow::drawFrameTimeHistory()
+        {
+            const auto&  frameTimes = engine::Profiler::getFrameTimes();
+            const size_t count      = engine::Profiler::getFrameTimeCount();
+            const size_t offset     = engine::Profiler::getFrameTimeOffset();
+            if (count == 0)
+                return;
+
+            float sum = 0.0f;
+            float max = 0.0f;
+            for (size_t i = 0; i < count; i++)
+            {
+                sum += frameTimes[i];
+                max = std::max(max, frameTimes[i]);
+            }
+            const float average = sum / static_cast<float>(count);
+            ImGui::Text("Average %.2f ms (%.0f FPS), max %.2f ms over %zu frames",
+                        average,
+                        average > 0.0f ? 1000.0f / average : 0.0f,
+                        max,
+                        count);
+
+            const float displayScale = ImGui::GetStyle().FontScaleDpi;
+            if (ImPlot::BeginPlot("##FrameTimes",
+                                  ImVec2(-1.0f, 120.0f * displayScale),
+                                  ImPlotFlags_NoMenus | ImPlotFlags_NoBoxSelect | ImPlotFlags_NoLegend))
+            {
+                ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoDecorations, ImPlotAxisFlags_AutoFit);
+                ImPlot::SetupAxisLimits(
+                    ImAxis_X1, 0.0, static_cast<double>(engine::Profiler::FRAME_HISTORY_SIZE), ImPlotCond_Always);
+                ImPlot::SetupAxisFormat(ImAxis_Y1, "%.0f ms");
+
+                ImPlot::PlotShaded(
+                    "Frame", frameTimes.data(), static_cast<int>(count), 0.0, 1.0, 0.0, 0, static_cast<int>(offset));
+                ImPlot::PlotLines(
+                    "Frame", frameTimes.data(), static_cast<int>(count), 1.0, 0.0, 0, static_cast<int>(offset));
+                ImPlot::PlotInfLines("Targets", FRAME_TARGETS_MS, 2, ImPlotInfLinesFlags_Horizontal);
+
+                ImPlot::EndPlot();
+            }
+        }
+
+        void ProfilerWindow::drawFlameGraph()
+        {
+            const float displayScale = ImGui::GetStyle().FontScaleDpi;
+            const float rowHeight    = ImGui::GetTextLineHeight() + 4.0f * displayScale;
+
+            uint32_t maxDepth = 0;
+            for (const auto& scope : m_Frame.scopes)
+                maxDepth = std::max(maxDepth, scope.depth);
+
+            const ImVec2 origin = ImGui::GetCursorScreenPos();
+            const float  width  = std::max(ImGui::GetContentRegionAvail().x, 1.0f);
+            const float  height = rowHeight * static_cast<float>(maxDepth + 1);
+            ImGui::InvisibleButton("##FlameGraph", ImVec2(width, height));
+
+            const bool   isHovered = ImGui::IsItemHovered();
+            const ImVec2 mouse     = ImGui::GetIO().MousePos;
+
+            const double nsToPixels = width / static_cast<double>(std::max<uint64_t>(m_Frame.durationNs, 1));
+            auto*        drawList   = ImGui::GetWindowDrawList();
+            drawList->PushClipRect(origin, ImVec2(origin.x + width, origin.y + height), true);
+
+            const auto selfNs = computeSelfTimes(m_Frame);
+            for (size_t i = 0; i < m_Frame.scopes.size(); i++)
+            {
+                const auto& scope = m_Frame.scopes[i];
+
+                const ImVec2 min(origin.x + static_cast<float>(scope.beginNs * nsToPixels),
+                                 origin.y + rowHeight * static_cast<float>(scope.depth));
+                const ImVec2 max(std::max(origin.x + static_cast<float>(scope.endNs * nsToPixels), min.x + 1.0f),
+                                 min.y + rowHeight - 1.0f);
+
+                drawList->AddRectFilled(min, max, getScopeColor(scope.name));
+
+                // Label only where it fits
+                const float textWidth = ImGui::CalcTextSize(scope.name).x;
+                if (max.x - min.x > textWidth + 4.0f * displayScale)
+                {
+                    drawList->AddText(ImVec2(min.x + 2.0f * displayScale, min.y + 2.0f * displayScale),
+                                      IM_COL32(20, 20, 20, 255),
+                                      scope.name);
+                }
+
+                if (isHovered && mouse.x >= min.x && mouse.x < max.x && mouse.y >= min.y && mouse.y < max.y)
+                {
+                    drawList->AddRect(min, max, IM_COL32(255, 255, 255, 255));
+                    ImGui::SetTooltip("%s\n%.3f ms (self %.3f ms)",
+                                      scope.name,
+                                      toMilliseconds(scope.endNs - scope.beginNs),
+                                      toMilliseconds(selfNs[i]));
+                }
+            }
+
+            drawList->PopClipRect();
+        }
+
+        void ProfilerWindow::drawScopeTable()
+        {
+            struct ScopeTotals
+            {
+                std::string_view name;
+                uint64_t         totalNs {0};
+                uint64_t         selfNs {0};
+                uint32_t         calls {0};
+            };
+
+            // Per name, since a window shows up once in every phase
+            const auto                                   selfNs = computeSelfTimes(m_Frame);
+            std::unordered_map<std::string_view, size_t> indices;
+            std::vector<ScopeTotals>                     totals;
+            for (size_t i = 0; i < m_Frame.scopes.size(); i++)
+            {
+                const auto& scope = m_Frame.scopes[i];
+
+                auto [it, inserted] = indices.try_emplace(scope.name, totals.size());
+                if (inserted)
+                    totals.push_back({scope.name});
+
+                auto& entry = totals[it->second];
+                entry.totalNs += scope.endNs - scope.beginNs;
+                entry.selfNs += selfNs[i];
+                entry.calls++;
+            }
+
+            std::sort(totals.begin(), totals.end(), [](const ScopeTotals& a, const ScopeTotals& b) {
+                return a.selfNs > b.selfNs;
+            });
+
+            const ImGuiTableFlags flags = ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_RowBg |
+                                          ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable;
+            if (!ImGui::BeginTable("##ProfilerScopes", 4, flags))
+                return;
+
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Self (ms)", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Total (ms)", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableHeadersRow();
+
+            for (const auto& entry : totals)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(entry.name.data(), entry.name.data() + entry.name.size());
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", toMilliseconds(entry.selfNs));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", toMilliseconds(entry.totalNs));
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", entry.calls);
+            }
+
+            ImGui::EndTable();
+        }
+    } // namespace editor
+} // namespace vultra
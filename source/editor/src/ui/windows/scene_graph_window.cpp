@@ -1,4 +1,8 @@
 #include "vultra_editor/ui/windows/scene_graph_window.hpp"
+#include "vultra_editor/history/command_history.hpp"
+#include "vultra_editor/history/scene_commands.hpp"
+#include "vultra_editor/scene/entity_tombstone.hpp"
+#include "vultra_editor/scene/scene_change_tracker.hpp"
 #include "vultra_editor/selector.hpp"
 
 #include <vultra/function/scenegraph/logic_scene.hpp>
@@ -6,6 +10,9 @@
 #include <IconsMaterialDesignIcons.h>
 #include <imgui.h>
 
+#include <algorithm>
+#include <functional>
+
 namespace vultra
 {
     namespace editor
@@ -13,9 +20,10 @@ namespace vultra
         SceneGraphWindow::SceneGraphWindow() : UIWindow("Scene Graph")
         {
             m_RenamePopupWidget.setRenameCallback([this](const char* newName) {
-                if (m_RenamingEntity)
+                if (m_RenamingEntity && m_RenamingEntity.getName() != newName)
                 {
-                    m_RenamingEntity.setName(newName);
+                    CommandHistory::execute(std::make_unique<RenameCommand>(
+                        m_RenamingEntity.getCoreUUID(), m_RenamingEntity.getName(), std::string(newName)));
                 }
             });
         }
@@ -28,6 +36,15 @@ namespace vultra
 
             if (m_LogicScene)
             {
+                syncSelection();
+
+                // --- Ctrl+A selects every entity ---
+                if (ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows) && !ImGui::GetIO().WantTextInput &&
+                    ImGui::GetIO().KeyCtrl && ImGui::IsKeyPressed(ImGuiKey_A))
+                {
+                    selectAllEntities();
+                }
+
                 // --- F2 rename shortcut ---
                 if (m_SelectedEntity && ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows) &&
                     ImGui::IsKeyPressed(ImGuiKey_F2))
@@ -46,9 +63,22 @@ namespace vultra
                     ImGui::TableSetupColumn("Status", ImGuiTableColumnFlags_WidthFixed, 80.0f);
                     ImGui::TableHeadersRow();
 
-                    // Draw all root entities
-                    for (auto& root : m_LogicScene->getRootEntities())
-                        drawEntityNode(root);
+                    // Only the rows inside the scroll region are submitted
+                    updateRows();
+
+                    ImGuiListClipper clipper;
+                    clipper.Begin(static_cast<int>(m_Rows.size()));
+                    while (clipper.Step())
+                    {
+                        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                            drawEntityRow(m_Rows[row]);
+                    }
+
+                    if (!m_PendingClickUUID.isNil())
+                    {
+                        handleEntityClick(m_PendingClickUUID, m_PendingClickToggle, m_PendingClickRange);
+                        m_PendingClickUUID = CoreUUID {};
+                    }
 
                     ImGui::TableNextRow();
                     ImGui::TableNextColumn();
@@ -65,7 +95,8 @@ namespace vultra
                             // Reparent to root
                             uint32_t draggedID     = *static_cast<const uint32_t*>(payload->Data);
                             Entity   draggedEntity = {static_cast<entt::entity>(draggedID), m_LogicScene};
-                            draggedEntity.setParent(CoreUUID());
+                            CommandHistory::execute(std::make_unique<ReparentCommand>(
+                                *m_LogicScene, draggedEntity.getCoreUUID(), CoreUUID()));
                         }
                         ImGui::EndDragDropTarget();
                     }
@@ -82,6 +113,8 @@ namespace vultra
                         {
                             auto entity = m_LogicScene->createEntity("New Entity");
                             entity.addComponent<TransformComponent>();
+                            SceneChangeTracker::markHierarchyChanged();
+                            CommandHistory::push(std::make_unique<CreateEntityCommand>(entity.getCoreUUID()));
                         }
                         ImGui::EndPopup();
                     }
@@ -89,13 +122,17 @@ namespace vultra
                     ImGui::EndTable();
 
                     // --- Process pending deletions ---
+                    // One undo entry for the whole batch; the entities are kept hidden until the entry is discarded
                     if (!m_PendingDeleteEntities.empty())
                     {
+                        std::vector<CoreUUID> deleted;
+                        deleted.reserve(m_PendingDeleteEntities.size());
                         for (auto& e : m_PendingDeleteEntities)
                         {
-                            m_LogicScene->destroyEntity(e);
+                            deleted.push_back(e.getCoreUUID());
                         }
                         m_PendingDeleteEntities.clear();
+                        CommandHistory::execute(std::make_unique<DeleteEntitiesCommand>(std::move(deleted)));
                     }
                 }
 
@@ -109,38 +146,81 @@ namespace vultra
             ImGui::End();
         }
 
-        void SceneGraphWindow::drawEntityNode(Entity& entity)
+        void SceneGraphWindow::updateRows()
         {
-            // Skip drawing editor camera
-            if (entity.hasComponent<CameraComponent>())
-            {
-                auto& cameraComp = entity.getComponent<CameraComponent>();
-                if (cameraComp.isEditorCamera)
+            const auto hierarchyGeneration = SceneChangeTracker::getHierarchyGeneration();
+            if (!m_RowsDirty && hierarchyGeneration == m_RowsGeneration && m_LogicScene == m_RowsScene)
+                return;
+
+            m_RowsDirty      = false;
+            m_RowsGeneration = hierarchyGeneration;
+            m_RowsScene      = m_LogicScene;
+            m_Rows.clear();
+
+            // Depth-first, children only below expanded entities
+            std::function<void(Entity&, uint32_t)> addRows = [&](Entity& entity, uint32_t depth) {
+                // Skip drawing editor camera
+                if (entity.hasComponent<CameraComponent>())
+                {
+                    auto& cameraComp = entity.getComponent<CameraComponent>();
+                    if (cameraComp.isEditorCamera)
+                        return;
+                }
+
+                // Deleted entities kept for undo
+                if (isTombstoned(entity))
                     return;
-            }
 
-            // Select icon based on components
-            const char* icon = ICON_MDI_CUBE; // Default icon for generic entity
-            if (entity.hasComponent<CameraComponent>() || entity.hasComponent<XrCameraComponent>())
-                icon = ICON_MDI_CAMERA;
-            else if (entity.hasComponent<DirectionalLightComponent>() || entity.hasComponent<PointLightComponent>() ||
-                     entity.hasComponent<AreaLightComponent>())
-                icon = ICON_MDI_LIGHTBULB_ON;
+                // Select icon based on components
+                const char* icon = ICON_MDI_CUBE; // Default icon for generic entity
+                if (entity.hasComponent<CameraComponent>() || entity.hasComponent<XrCameraComponent>())
+                    icon = ICON_MDI_CAMERA;
+                else if (entity.hasComponent<DirectionalLightComponent>() ||
+                         entity.hasComponent<PointLightComponent>() || entity.hasComponent<AreaLightComponent>())
+                    icon = ICON_MDI_LIGHTBULB_ON;
+
+                // TODO: More icons for different components
+
+                SceneGraphRow& row = m_Rows.emplace_back();
+                row.entity         = entity;
+                row.uuid           = entity.getCoreUUID();
+                row.label          = std::string(icon) + "  " + entity.getName(); // Combine label (with icon)
+                row.depth          = depth;
+                row.hasChildren    = hasLiveChildren(entity);
+                row.expanded       = row.hasChildren && m_ExpandedEntities.contains(row.uuid);
+
+                if (row.expanded)
+                {
+                    for (auto& child : entity.getChildrenEntities())
+                        addRows(child, depth + 1);
+                }
+            };
+
+            for (auto& root : m_LogicScene->getRootEntities())
+                addRows(root, 0);
+        }
 
-            // TODO: More icons for different components
+        bool SceneGraphWindow::hasLiveChildren(Entity& entity)
+        {
+            if (!entity.hasChildren())
+                return false;
 
-            // Combine label (with icon)
-            std::string nodeLabel = std::string(icon) + "  " + entity.getName();
+            auto children = entity.getChildrenEntities();
+            return std::any_of(children.begin(), children.end(), [](Entity& child) { return !isTombstoned(child); });
+        }
 
-            bool               hasChildren = entity.hasChildren();
-            ImGuiTreeNodeFlags flags       = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanFullWidth;
-            if (!hasChildren)
-                flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+        void SceneGraphWindow::drawEntityRow(SceneGraphRow& row)
+        {
+            Entity&  entity = row.entity;
+            uint32_t id     = entity;
 
-            if (m_SelectedEntity == entity)
-                flags |= ImGuiTreeNodeFlags_Selected;
+            ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanFullWidth |
+                                       ImGuiTreeNodeFlags_NoTreePushOnOpen;
+            if (!row.hasChildren)
+                flags |= ImGuiTreeNodeFlags_Leaf;
 
-            uint32_t id = entity;
+            if (Selector::isSelected(SelectionCategory::eEntity, row.uuid))
+                flags |= ImGuiTreeNodeFlags_Selected;
 
             // Each entity = one table row
             ImGui::PushID(id);
@@ -148,10 +228,31 @@ namespace vultra
             ImGui::TableNextRow();
             ImGui::TableNextColumn();
 
-            bool open = ImGui::TreeNodeEx((void*)(intptr_t)id, flags, "%s", nodeLabel.c_str());
+            // Rows are flat, so the tree is drawn by indenting instead of pushing tree nodes
+            const float indent = static_cast<float>(row.depth) * ImGui::GetStyle().IndentSpacing;
+            if (indent > 0.0f)
+                ImGui::Indent(indent);
+
+            ImGui::SetNextItemOpen(row.expanded);
+            bool open = ImGui::TreeNodeEx((void*)(intptr_t)id, flags, "%s", row.label.c_str());
+            if (row.hasChildren && open != row.expanded)
+            {
+                if (open)
+                    m_ExpandedEntities.insert(row.uuid);
+                else
+                    m_ExpandedEntities.erase(row.uuid);
+                m_RowsDirty = true;
+            }
+
+            if (indent > 0.0f)
+                ImGui::Unindent(indent);
+
             if (ImGui::IsItemClicked())
             {
-                selectEntity(entity);
+                // Ctrl toggles, Shift extends from the anchor; applied after the tree is drawn
+                m_PendingClickUUID   = row.uuid;
+                m_PendingClickToggle = ImGui::GetIO().KeyCtrl;
+                m_PendingClickRange  = ImGui::GetIO().KeyShift;
             }
 
             // --- Drag source ---
@@ -184,7 +285,8 @@ namespace vultra
                 {
                     uint32_t draggedID     = *static_cast<const uint32_t*>(payload->Data);
                     Entity   draggedEntity = {static_cast<entt::entity>(draggedID), m_LogicScene};
-                    draggedEntity.setParent(entity.getCoreUUID());
+                    CommandHistory::execute(
+                        std::make_unique<ReparentCommand>(*m_LogicScene, draggedEntity.getCoreUUID(), row.uuid));
                 }
                 ImGui::EndDragDropTarget();
             }
@@ -192,36 +294,106 @@ namespace vultra
             // --- Right column: Status buttons ---
             ImGui::TableNextColumn();
 
-            auto&       entityFlagsComp = entity.getComponent<EntityFlagsComponent>();
-            bool        visible         = (entityFlagsComp.flags & static_cast<uint32_t>(EntityFlags::eVisible)) != 0;
-            std::string visibleBtnID =
-                std::string(visible ? ICON_MDI_EYE : ICON_MDI_EYE_OFF) + "##visible" + std::to_string(id);
+            auto& entityFlagsComp = entity.getComponent<EntityFlagsComponent>();
+            bool  visible         = (entityFlagsComp.flags & static_cast<uint32_t>(EntityFlags::eVisible)) != 0;
 
-            // Align buttons horizontally
+            // Align buttons horizontally; the row's PushID keeps the button ID unique
             ImGui::SetCursorPosX(ImGui::GetCursorPosX() + 8.0f);
-            if (ImGui::SmallButton(visibleBtnID.c_str()))
+            if (ImGui::SmallButton(visible ? ICON_MDI_EYE "##visible" : ICON_MDI_EYE_OFF "##visible"))
             {
                 entityFlagsComp.flags ^= static_cast<uint32_t>(EntityFlags::eVisible);
+                SceneChangeTracker::markPropertiesChanged();
             }
 
-            // Draw children recursively
-            if (open && hasChildren)
+            ImGui::PopID();
+        }
+
+        void SceneGraphWindow::selectEntity(Entity& entity)
+        {
+            m_SelectedEntity  = entity;
+            m_SelectionAnchor = entity.getCoreUUID();
+
+            const CoreUUID selection[] = {m_SelectionAnchor};
+            Selector::setSelection(SelectionCategory::eEntity, selection);
+        }
+
+        void SceneGraphWindow::handleEntityClick(const CoreUUID& entityUUID, bool toggle, bool range)
+        {
+            auto findRow = [this](const CoreUUID& uuid) {
+                return std::find_if(
+                    m_Rows.begin(), m_Rows.end(), [&uuid](const SceneGraphRow& row) { return row.uuid == uuid; });
+            };
+
+            auto anchorIt = findRow(m_SelectionAnchor);
+            if (range && anchorIt != m_Rows.end())
             {
-                for (auto& child : entity.getChildrenEntities())
-                    drawEntityNode(child);
-                ImGui::TreePop();
+                auto clickedIt = findRow(entityUUID);
+                if (clickedIt == m_Rows.end())
+                    return;
+
+                // Rows between the anchor and the clicked one, anchor side first so the clicked entity ends up last
+                std::vector<CoreUUID> rangeSelection;
+                const auto            step = anchorIt <= clickedIt ? 1 : -1;
+                for (auto it = anchorIt;; it += step)
+                {
+                    rangeSelection.push_back(it->uuid);
+                    if (it == clickedIt)
+                        break;
+                }
+
+                // Ctrl+Shift adds the range to the current selection
+                if (toggle)
+                    Selector::select(SelectionCategory::eEntity, rangeSelection);
+                else
+                    Selector::setSelection(SelectionCategory::eEntity, rangeSelection);
+                return;
             }
 
-            ImGui::PopID();
+            m_SelectionAnchor = entityUUID;
+            if (toggle)
+            {
+                Selector::toggle(SelectionCategory::eEntity, entityUUID);
+            }
+            else
+            {
+                Entity entity = m_LogicScene->getEntityWithCoreUUID(entityUUID);
+                if (entity)
+                    selectEntity(entity);
+            }
         }
 
-        void SceneGraphWindow::selectEntity(Entity& entity)
+        void SceneGraphWindow::selectAllEntities()
         {
-            m_SelectedEntity = entity;
+            std::vector<CoreUUID> entities;
+
+            std::function<void(Entity&)> collect = [&](Entity& entity) {
+                // Skip editor camera and deleted entities kept for undo
+                if (entity.hasComponent<CameraComponent>() && entity.getComponent<CameraComponent>().isEditorCamera)
+                    return;
+                if (isTombstoned(entity))
+                    return;
+
+                entities.push_back(entity.getCoreUUID());
+                for (auto& child : entity.getChildrenEntities())
+                    collect(child);
+            };
+            for (auto& root : m_LogicScene->getRootEntities())
+                collect(root);
+
+            Selector::setSelection(SelectionCategory::eEntity, entities);
+        }
+
+        void SceneGraphWindow::syncSelection()
+        {
+            const auto generation = Selector::getGeneration(SelectionCategory::eEntity);
+            if (generation == m_SelectionGeneration)
+                return;
+
+            m_SelectionGeneration = generation;
 
-            // Single selection for now
-            Selector::unselectAll(SelectionCategory::eEntity);
-            Selector::select(SelectionCategory::eEntity, entity.getCoreUUID());
+            const auto lastSelectionUUID = Selector::getLastSelection(SelectionCategory::eEntity);
+            m_SelectedEntity =
+                lastSelectionUUID.isNil() ? Entity {} : m_LogicScene->getEntityWithCoreUUID(lastSelectionUUID);
         }
     } // namespace editor
 } // namespace vultra
\ No newline at end of file
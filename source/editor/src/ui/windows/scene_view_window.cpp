@@ -1,4 +1,8 @@
 #include "vultra_editor/ui/windows/scene_view_window.hpp"
+#include "vultra_editor/asset/asset_database.hpp"
+#include "vultra_editor/history/command_history.hpp"
+#include "vultra_editor/history/scene_commands.hpp"
+#include "vultra_editor/scene/scene_change_tracker.hpp"
 #include "vultra_editor/selector.hpp"
 
 #include <vultra/function/scenegraph/component_utils.hpp>
@@ -27,9 +31,11 @@ namespace vultra
             UIWindow::onInit(renderDevice);
 
             // Default size
-            recreateRenderTexture(800, 600);
+            m_RenderTarget.initialize(renderDevice, 800, 600);
         }
 
+        void SceneViewWindow::onDestroy() { m_RenderTarget.shutdown(); }
+
         void SceneViewWindow::onImGui()
         {
             handleInput();
@@ -52,6 +58,7 @@ namespace vultra
             if (!m_IsWindowOpen)
             {
                 ImGui::End();
+                m_RenderScheduler.update(false, {});
                 return;
             }
 
@@ -73,31 +80,52 @@ namespace vultra
             auto      viewportOffset    = ImGui::GetWindowPos();
             glm::vec2 bounds0 = {viewportMinRegion.x + viewportOffset.x, viewportMinRegion.y + viewportOffset.y};
             glm::vec2 bounds1 = {viewportMaxRegion.x + viewportOffset.x, viewportMaxRegion.y + viewportOffset.y};
+            m_ViewportMin     = bounds0;
+            m_ViewportMax     = bounds1;
 
-            if (m_SceneTexture)
-            {
-                // Resize render texture if needed
-                if (static_cast<uint32_t>(availSize.x) != m_SceneRenderTexture.getExtent().width ||
-                    static_cast<uint32_t>(availSize.y) != m_SceneRenderTexture.getExtent().height)
-                {
-                    recreateRenderTexture(static_cast<uint32_t>(availSize.x), static_cast<uint32_t>(availSize.y));
-                }
-            }
-            else
+            float displayScale = 1.0f;
+#if __APPLE__
+            // On macOS, need to consider the display scale
+            displayScale = os::Window::getActiveWindow().getDisplayScale();
+#endif
+            // Cheaper frames while the camera moves, refined back to full resolution once it stops
+            m_Refinement.update(m_EditorCameraScript.isNavigating());
+            const bool scaleChanged = m_Refinement.getScale() != m_RenderScale;
+            m_RenderScale           = m_Refinement.getScale();
+
+            if (m_RenderTarget.update(static_cast<uint32_t>(availSize.x * displayScale * m_RenderScale),
+                                      static_cast<uint32_t>(availSize.y * displayScale * m_RenderScale),
+                                      ImGui::GetTime(),
+                                      scaleChanged))
             {
-                recreateRenderTexture(static_cast<uint32_t>(availSize.x), static_cast<uint32_t>(availSize.y));
+                m_RenderScheduler.invalidate();
             }
-            ImGui::Image(m_SceneTexture, availSize);
 
-            // TODO: Scene View Selection as well
-            auto lastSelectedEntityUUID = Selector::getLastSelection(SelectionCategory::eEntity);
-            if (!lastSelectedEntityUUID.isNil())
-            {
-                m_SelectedEntity = m_LogicScene->getEntityWithCoreUUID(lastSelectedEntityUUID);
-            }
-            else
+            const auto uvMin = m_RenderTarget.getUVMin();
+            const auto uvMax = m_RenderTarget.getUVMax();
+            ImGui::Image(m_RenderTarget.getImGuiTexture(), availSize, {uvMin.x, uvMin.y}, {uvMax.x, uvMax.y});
+
+            // The camera projects to the whole render target, of which only the center is shown while resizing
+            const glm::vec2 projectionSize = (bounds1 - bounds0) / (uvMax - uvMin);
+            m_ProjectionMin                = bounds0 - (projectionSize - (bounds1 - bounds0)) * 0.5f;
+            m_ProjectionMax                = m_ProjectionMin + projectionSize;
+
+            // Resolve the selected entity only when the selection or the scene changed
+            const auto selectionGeneration = Selector::getGeneration(SelectionCategory::eEntity);
+            if (selectionGeneration != m_SelectionGeneration || m_LogicScene != m_SelectionScene)
             {
-                m_SelectedEntity = Entity {};
+                m_SelectionGeneration = selectionGeneration;
+                m_SelectionScene      = m_LogicScene;
+
+                auto lastSelectedEntityUUID = Selector::getLastSelection(SelectionCategory::eEntity);
+                if (!lastSelectedEntityUUID.isNil())
+                {
+                    m_SelectedEntity = m_LogicScene->getEntityWithCoreUUID(lastSelectedEntityUUID);
+                }
+                else
+                {
+                    m_SelectedEntity = Entity {};
+                }
             }
 
             auto cameraComponent  = camera.getComponent<CameraComponent>();
@@ -108,13 +136,18 @@ namespace vultra
             m_EditorCameraScript.setWindowHovered(m_IsWindowHovered);
             m_EditorCameraScript.setGrabMoveEnabled(m_GuizmoOperation == -1);
 
+            updatePicking(cameraView, cameraProjection);
+
             // Gizmos
             if (m_SelectedEntity && m_GuizmoOperation != -1)
             {
                 ImGuizmo::SetOrthographic(false);
                 ImGuizmo::SetDrawlist();
 
-                ImGuizmo::SetRect(bounds0.x, bounds0.y, bounds1.x - bounds0.x, bounds1.y - bounds0.y);
+                ImGuizmo::SetRect(m_ProjectionMin.x,
+                                  m_ProjectionMin.y,
+                                  m_ProjectionMax.x - m_ProjectionMin.x,
+                                  m_ProjectionMax.y - m_ProjectionMin.y);
 
                 // Selected entity transform
                 auto& transformComponent = m_SelectedEntity.getComponent<TransformComponent>();
@@ -143,12 +176,24 @@ namespace vultra
 
                 if (ImGuizmo::IsUsing())
                 {
+                    const TransformComponent before = transformComponent;
+
                     glm::vec3 rotation;
                     ImGuizmo::DecomposeMatrixToComponents(glm::value_ptr(transform),
                                                           glm::value_ptr(transformComponent.position),
                                                           glm::value_ptr(rotation),
                                                           glm::value_ptr(transformComponent.scale));
                     transformComponent.setRotationEuler(rotation);
+                    SceneChangeTracker::markTransformsChanged();
+
+                    // Every frame of the drag is merged into one history entry
+                    std::vector<TransformCommand::Delta> deltas = {
+                        {m_SelectedEntity.getCoreUUID(), before, transformComponent}};
+                    CommandHistory::push(std::make_unique<TransformCommand>(std::move(deltas)), this);
+                }
+                else
+                {
+                    CommandHistory::seal(this);
                 }
             }
 
@@ -205,9 +250,29 @@ namespace vultra
 
             ImGui::End();
 
+            // Everything the image depends on besides the scene: imported asset content, the selection (camera
+            // frustum) and the hover outline
+            const uint32_t hoveredEntityId = m_HoveredPick ? static_cast<uint32_t>(m_HoveredPick->entity) : UINT32_MAX;
+
+            ViewRenderScheduler::ViewState viewState;
+            viewState.scene      = m_LogicScene;
+            viewState.sceneHash  = FrameStateHasher {}
+                                      .add(SceneChangeTracker::getGeneration())
+                                      .add(AssetDatabase::get()->getContentGeneration())
+                                      .add(selectionGeneration)
+                                      .add(hoveredEntityId)
+                                      .get();
+            viewState.cameraHash = ViewRenderScheduler::hashCamera(camera);
+            viewState.width      = m_RenderTarget.getWidth();
+            viewState.height     = m_RenderTarget.getHeight();
+
+            // Debug draw is consumed by the next render, so it is only emitted for frames that render
+            if (!m_RenderScheduler.update(true, viewState))
+                return;
+
             // Camera Frustum Debug Draw if main camera is selected
             auto mainCamera = m_LogicScene->getMainCamera();
-            if (m_SelectedEntity && m_SelectedEntity.getCoreUUID() == mainCamera.getCoreUUID())
+            if (mainCamera && m_SelectedEntity && m_SelectedEntity.getCoreUUID() == mainCamera.getCoreUUID())
             {
                 auto      camComponent = mainCamera.getComponent<CameraComponent>();
                 auto      camTransform = mainCamera.getComponent<TransformComponent>();
@@ -219,6 +284,15 @@ namespace vultra
                 dd::frustum(glm::value_ptr(glm::inverse(vp)), glm::value_ptr(frustumColor));
             }
 
+            // Highlight the entity under the cursor
+            if (m_HoveredPick)
+            {
+                glm::vec3 hoverColor = glm::vec3(0.18f, 0.46f, 0.98f);
+                dd::aabb(glm::value_ptr(m_HoveredPick->bounds.min),
+                         glm::value_ptr(m_HoveredPick->bounds.max),
+                         glm::value_ptr(hoverColor));
+            }
+
             // Draw xz plane grid
             // TODO: Switch to shader-based infinite ground grid for better performance & visual quality
             // https://godotshaders.com/shader/infinite-ground-grid/
@@ -234,37 +308,16 @@ namespace vultra
             {
                 m_LogicScene->setSimulationMode(LogicSceneSimulationMode::eEditor);
             }
+            if (!m_RenderScheduler.shouldRender())
+                return;
+
             ctx.renderer->setScene(m_LogicScene);
-            ctx.renderer->render(ctx.cb, &m_SceneRenderTexture, ctx.dt);
+            ctx.renderer->render(ctx.cb, m_RenderTarget.getTexture(), ctx.dt);
         }
 
-        uint32_t SceneViewWindow::getViewportWidth() const { return m_SceneRenderTexture.getExtent().width; }
+        uint32_t SceneViewWindow::getViewportWidth() const { return m_RenderTarget.getWidth(); }
 
-        uint32_t SceneViewWindow::getViewportHeight() const { return m_SceneRenderTexture.getExtent().height; }
-
-        void SceneViewWindow::recreateRenderTexture(uint32_t width, uint32_t height)
-        {
-#if __APPLE__
-            // On macOS, need to consider the display scale
-            float displayScale = os::Window::getActiveWindow().getDisplayScale();
-            width              = static_cast<uint32_t>(width * displayScale);
-            height             = static_cast<uint32_t>(height * displayScale);
-#endif
-            m_SceneRenderTexture = rhi::Texture::Builder {}
-                                       .setExtent({.width = width, .height = height})
-                                       .setPixelFormat(rhi::PixelFormat::eRGBA8_UNorm)
-                                       .setNumMipLevels(1)
-                                       .setUsageFlags(rhi::ImageUsage::eRenderTarget | rhi::ImageUsage::eSampled |
-                                                      rhi::ImageUsage::eTransferDst)
-                                       .setupOptimalSampler(true)
-                                       .build(*m_RenderDevice);
-
-            if (m_SceneTexture)
-            {
-                imgui::removeTexture(*m_RenderDevice, m_SceneTexture);
-            }
-            m_SceneTexture = imgui::addTexture(m_SceneRenderTexture);
-        }
+        uint32_t SceneViewWindow::getViewportHeight() const { return m_RenderTarget.getHeight(); }
 
         void SceneViewWindow::handleInput()
         {
@@ -279,39 +332,9 @@ namespace vultra
             if (ImGui::IsMouseClicked(ImGuiMouseButton_Left) && m_IsWindowHovered && !ImGuizmo::IsOver())
             {
 #endif
-                if (m_SelectedEntity)
-                {
-                    // Single selection for now
-                    Selector::unselectAll(SelectionCategory::eEntity);
-                    Selector::select(SelectionCategory::eEntity, m_SelectedEntity.getCoreUUID());
-                }
-                else
-                {
-                    // https://github.com/CedricGuillemet/ImGuizmo/issues/133#issuecomment-708083755
-                    auto selectedEntityUUID = Selector::getLastSelection(SelectionCategory::eEntity);
-                    if (!selectedEntityUUID.isNil() && m_GuizmoOperation != -1)
-                    {
-                        auto entityCache = m_LogicScene->getEntityWithCoreUUID(selectedEntityUUID);
-                        if (entityCache)
-                        {
-                            auto camera           = m_LogicScene->getEditorCamera();
-                            auto cameraComponent  = camera.getComponent<CameraComponent>();
-                            auto cameraTransform  = camera.getComponent<TransformComponent>();
-                            auto cameraView       = getCameraViewMatrix(cameraTransform);
-                            auto cameraProjection = getCameraProjectionMatrix(cameraComponent, false);
-
-                            glm::mat4 transform = entityCache.getComponent<TransformComponent>().getTransform();
-                            transform           = glm::translate(transform, glm::vec3(0.0f, -10000.0f, 0.0f));
-                            ImGuizmo::Manipulate(glm::value_ptr(cameraView),
-                                                 glm::value_ptr(cameraProjection),
-                                                 static_cast<ImGuizmo::OPERATION>(m_GuizmoOperation),
-                                                 m_GuizmoMode,
-                                                 glm::value_ptr(transform));
-                        }
-                    }
-
-                    Selector::unselectAll(SelectionCategory::eEntity);
-                }
+                // Selection happens on release, so dragging to move the camera does not change it
+                m_PickOnRelease = true;
+                m_MarqueeStart  = {ImGui::GetMousePos().x, ImGui::GetMousePos().y};
             }
 
             if (ImGui::IsKeyPressed(ImGuiKey_Q) && m_IsWindowHovered && !ImGuizmo::IsUsing())
@@ -335,6 +358,158 @@ namespace vultra
             }
         }
 
+        void SceneViewWindow::updatePicking(const glm::mat4& view, const glm::mat4& projection)
+        {
+            m_ScenePicker.update(m_LogicScene);
+
+            const bool isCameraMoving =
+                m_EditorCameraScript.m_IsFreeMoveValid || m_EditorCameraScript.m_IsGrabMoveValid;
+            const auto viewportSize = m_ViewportMax - m_ViewportMin;
+
+            // Dragging with a transform tool draws a selection rectangle, the hand tool drags the camera instead
+            if (m_PickOnRelease && m_GuizmoOperation != -1 && ImGui::IsMouseDragging(ImGuiMouseButton_Left))
+            {
+                m_IsMarqueeActive = true;
+            }
+
+            m_HoveredPick.reset();
+            if (m_IsWindowHovered && !m_IsMarqueeActive && !ImGuizmo::IsUsing() && !isCameraMoving &&
+                viewportSize.x > 0.0f && viewportSize.y > 0.0f)
+            {
+                const auto mousePos = ImGui::GetMousePos();
+                const auto ndc      = toViewportNDC({mousePos.x, mousePos.y});
+
+                m_HoveredPick = m_ScenePicker.pick(ScenePicker::makeRay(view, projection, ndc));
+            }
+
+            if (m_IsMarqueeActive)
+            {
+                drawMarquee();
+            }
+
+            if (m_PickOnRelease && ImGui::IsMouseReleased(ImGuiMouseButton_Left))
+            {
+                m_PickOnRelease = false;
+
+                const auto& io            = ImGui::GetIO();
+                const float dragThreshold = io.MouseDragThreshold * io.MouseDragThreshold;
+                if (m_IsMarqueeActive)
+                {
+                    m_IsMarqueeActive = false;
+                    selectInMarquee(view, projection);
+                }
+                else if (m_IsWindowHovered && io.MouseDragMaxDistanceSqr[ImGuiMouseButton_Left] <= dragThreshold)
+                {
+                    selectPicked(view, projection);
+                }
+            }
+        }
+
+        void SceneViewWindow::selectPicked(const glm::mat4& view, const glm::mat4& projection)
+        {
+            if (m_HoveredPick)
+            {
+                const auto uuid = m_HoveredPick->entity.getCoreUUID();
+                if (ImGui::GetIO().KeyCtrl)
+                {
+                    Selector::toggle(SelectionCategory::eEntity, uuid);
+                }
+                else
+                {
+                    Selector::setSelection(SelectionCategory::eEntity, std::span<const CoreUUID>(&uuid, 1));
+                }
+                return;
+            }
+
+            // https://github.com/CedricGuillemet/ImGuizmo/issues/133#issuecomment-708083755
+            auto selectedEntityUUID = Selector::getLastSelection(SelectionCategory::eEntity);
+            if (!selectedEntityUUID.isNil() && m_GuizmoOperation != -1)
+            {
+                auto entityCache = m_LogicScene->getEntityWithCoreUUID(selectedEntityUUID);
+                if (entityCache)
+                {
+                    glm::mat4 transform = entityCache.getComponent<TransformComponent>().getTransform();
+                    transform           = glm::translate(transform, glm::vec3(0.0f, -10000.0f, 0.0f));
+                    ImGuizmo::Manipulate(glm::value_ptr(view),
+                                         glm::value_ptr(projection),
+                                         static_cast<ImGuizmo::OPERATION>(m_GuizmoOperation),
+                                         m_GuizmoMode,
+                                         glm::value_ptr(transform));
+                }
+            }
+
+            // Ctrl+click on empty space keeps the current selection
+            if (!ImGui::GetIO().KeyCtrl)
+            {
+                Selector::unselectAll(SelectionCategory::eEntity);
+            }
+        }
+
+        void SceneViewWindow::selectInMarquee(const glm::mat4& view, const glm::mat4& projection)
+        {
+            const auto viewportSize = m_ViewportMax - m_ViewportMin;
+            if (viewportSize.x <= 0.0f || viewportSize.y <= 0.0f)
+                return;
+
+            const auto mousePos = ImGui::GetMousePos();
+            const auto start    = toViewportNDC(m_MarqueeStart);
+            const auto end      = toViewportNDC({mousePos.x, mousePos.y});
+
+            // Keep the rectangle at least a pixel wide and tall. A zero-width or zero-height one (a straight drag, or
+            // one squashed against the viewport edge) has degenerate side planes, and the frustum left without them
+            // would take in everything in front of the camera.
+            const glm::vec2 pixelSize = 2.0f / (m_ProjectionMax - m_ProjectionMin);
+            const auto      grow      = glm::max(pixelSize - glm::abs(end - start), glm::vec2(0.0f)) * 0.5f;
+
+            const auto frustum =
+                ScenePicker::makeFrustum(view, projection, glm::min(start, end) - grow, glm::max(start, end) + grow);
+            const auto entities = m_ScenePicker.pickAll(frustum);
+
+            std::vector<CoreUUID> uuids;
+            uuids.reserve(entities.size());
+            for (const auto& entity : entities)
+            {
+                uuids.push_back(entity.getCoreUUID());
+            }
+
+            // Shift adds to the selection, Ctrl removes from it, otherwise the rectangle replaces it
+            const auto& io = ImGui::GetIO();
+            if (io.KeyShift)
+            {
+                Selector::select(SelectionCategory::eEntity, uuids);
+            }
+            else if (io.KeyCtrl)
+            {
+                Selector::unselect(SelectionCategory::eEntity, uuids);
+            }
+            else
+            {
+                Selector::setSelection(SelectionCategory::eEntity, uuids);
+            }
+        }
+
+        void SceneViewWindow::drawMarquee() const
+        {
+            const auto mousePos = ImGui::GetMousePos();
+            const auto start    = glm::clamp(m_MarqueeStart, m_ViewportMin, m_ViewportMax);
+            const auto end      = glm::clamp(glm::vec2(mousePos.x, mousePos.y), m_ViewportMin, m_ViewportMax);
+            const auto rectMin  = glm::min(start, end);
+            const auto rectMax  = glm::max(start, end);
+
+            auto* drawList = ImGui::GetWindowDrawList();
+            drawList->AddRectFilled({rectMin.x, rectMin.y}, {rectMax.x, rectMax.y}, IM_COL32(46, 117, 250, 40));
+            drawList->AddRect({rectMin.x, rectMin.y}, {rectMax.x, rectMax.y}, IM_COL32(46, 117, 250, 200));
+        }
+
+        glm::vec2 SceneViewWindow::toViewportNDC(const glm::vec2& screenPos) const
+        {
+            const auto size = m_ProjectionMax - m_ProjectionMin;
+            const auto pos  = glm::clamp(screenPos, m_ViewportMin, m_ViewportMax) - m_ProjectionMin;
+
+            // Screen y grows downwards, NDC y upwards
+            return {2.0f * pos.x / size.x - 1.0f, 1.0f - 2.0f * pos.y / size.y};
+        }
+
         void SceneViewWindow::drawToolbar()
         {
             float windowHeight = ImGui::GetWindowHeight();
@@ -420,6 +595,40 @@ namespace vultra
             }
             ImGui::SameLine();
 
+            {
+                selected = m_Refinement.isEnabled();
+                if (selected)
+                    ImGui::PushStyleColor(ImGuiCol_Text, selectedColor);
+                ImGui::SameLine(0, 16_dpx);
+                if (ImGui::Button(ICON_MDI_BLUR))
+                    m_Refinement.setEnabled(!selected);
+                if (selected)
+                    ImGui::PopStyleColor();
+
+                if (ImGui::IsItemHovered())
+                {
+                    ImGui::SetTooltip("Render at lower resolution while navigating, then refine to full resolution.");
+                }
+            }
+            ImGui::SameLine();
+
+            {
+                selected = m_RenderScheduler.isAlwaysRender();
+                if (selected)
+                    ImGui::PushStyleColor(ImGuiCol_Text, selectedColor);
+                ImGui::SameLine();
+                if (ImGui::Button(ICON_MDI_AUTORENEW))
+                    m_RenderScheduler.setAlwaysRender(!selected);
+                if (selected)
+                    ImGui::PopStyleColor();
+
+                if (ImGui::IsItemHovered())
+                {
+                    ImGui::SetTooltip("Always refresh. Otherwise the view only renders when something in it changed.");
+                }
+            }
+            ImGui::SameLine();
+
             ImGui::PopStyleColor();
         }
     } // namespace editor
@@ -1,5 +1,33 @@
 add_requires("argparse")
 
+-- editor code without UI, shared by the editor and VultraBench
+target("VultraEditorCore")
+    -- set kind: static library
+    set_kind("static")
+
+    -- add include dir
+    add_includedirs("include", {public = true}) -- public: let other targets to auto include
+
+    -- add header files
+    add_headerfiles("include/(vultra_editor/selector.hpp)")
+    add_headerfiles("include/(vultra_editor/asset/**.hpp)")
+    add_headerfiles("include/(vultra_editor/log/**.hpp)")
+    add_headerfiles("include/(vultra_editor/picking/**.hpp)")
+    add_headerfiles("include/(vultra_editor/scene/**.hpp)")
+
+    -- add source files
+    add_files("src/selector.cpp")
+    add_files("src/asset/**.cpp")
+    add_files("src/log/**.cpp")
+    add_files("src/picking/**.cpp")
+    add_files("src/scene/**.cpp")
+
+    -- add deps
+    add_deps("VultraEngine", {public = true})
+
+    -- set target directory
+    set_targetdir("$(builddir)/$(plat)/$(arch)/$(mode)/VultraEditorCore")
+
 target("VultraEditor")
     -- set kind: binary
     set_kind("binary")
@@ -10,14 +38,19 @@ target("VultraEditor")
     -- add header files
     add_headerfiles("include/(vultra_editor/**.hpp)")
 
-    -- add source files
-    add_files("src/**.cpp")
+    -- add source files, everything VultraEditorCore does not build
+    add_files("src/**.cpp|selector.cpp|asset/**.cpp|log/**.cpp|picking/**.cpp|scene/**.cpp")
 
     -- add packages
     add_packages("argparse", {public = true})
 
+    -- per-subsystem heap accounting, see src/memory/heap_allocation_hook.cpp
+    if has_config("memory_hook") then
+        add_defines("VULTRA_EDITOR_MEMORY_HOOK")
+    end
+
     -- add deps
-    add_deps("VultraEngine")
+    add_deps("VultraEditorCore")
 
     -- add rules
     add_rules("linux.sdl.driver")
@@ -26,4 +59,4 @@ target("VultraEditor")
     set_runargs("--project", "$(projectdir)/example_project/ExampleProject.vproj")
 
     -- set target directory
-    set_targetdir("$(builddir)/$(plat)/$(arch)/$(mode)/VultraEditor")
\ No newline at end of file
+    set_targetdir("$(builddir)/$(plat)/$(arch)/$(mode)/VultraEditor")
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <vasset/vasset.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace vultra
+{
+    namespace engine
+    {
+        using AssetRegistryMap =
+            std::remove_reference_t<decltype(std::declval<vasset::VAssetRegistry&>().getRegistry())>;
+        using AssetRegistryEntry = AssetRegistryMap::mapped_type;
+        // UUID string and entry, sorted by UUID
+        using AssetRegistryEntries = std::vector<std::pair<std::string, AssetRegistryEntry>>;
+
+        // Entries of registry that base lacks or holds with another type or path
+        AssetRegistryEntries diffRegistry(const AssetRegistryMap& registry, const AssetRegistryMap& base);
+
+        struct AssetImportOptions
+        {
+            uint32_t workerCount {0};    // 0 = one worker per hardware thread
+            bool     force {false};      // Ignore the import cache and reimport everything
+            size_t   reportSlowest {10}; // Number of slowest assets to list in the log
+        };
+
+        struct AssetImportRecord
+        {
+            std::filesystem::path path; // Relative to the asset folder
+            uint64_t              bytes {0};
+            double                hashMs {0.0};
+            double                importMs {0.0};
+            bool                  skipped {false};
+            bool                  succeeded {true};
+        };
+
+        struct AssetImportReport
+        {
+            std::vector<AssetImportRecord> records;
+
+            double   totalMs {0.0};
+            uint32_t workerCount {0};
+            uint32_t importedCount {0};
+            uint32_t skippedCount {0};
+            uint32_t failedCount {0};
+            uint32_t removedCount {0}; // Registry entries whose source is gone
+            uint64_t importedBytes {0};
+
+            [[nodiscard]] bool succeeded() const { return failedCount == 0; }
+
+            void log(size_t maxSlowest) const;
+        };
+
+        // Incremental, multi-threaded front end for vasset::VAssetImporter.
+        //
+        // Source files are hashed (content + .vmeta), compared with the hashes recorded by the previous run in
+        // .imported/asset_import_cache.json, and only changed or missing assets are imported. Dirty assets are spread
+        // over a JobSystem; every import runs its own importer against a scratch copy of the target registry. All
+        // entries an import registered (a model's meshes and materials included) are merged back on the calling thread
+        // in source path order, so the importer never runs concurrently on shared state and the result does not depend
+        // on scheduling.
+        //
+        // The cache remembers which entries each asset produced. An entry is only removed once no asset produces it
+        // anymore, i.e. its source was deleted or a reimport stopped registering it; entries the pipeline never
+        // produced are left alone.
+        class AssetImportPipeline
+        {
+        public:
+            AssetImportPipeline(vasset::VAssetRegistry&      registry,
+                                const std::filesystem::path& assetDir,
+                                const std::filesystem::path& importedDir);
+
+            AssetImportReport run(const AssetImportOptions& options = {});
+
+            // Content hash of an asset as of the last run, 0 if unknown. Thread safe.
+            [[nodiscard]] uint64_t getContentHash(const std::filesystem::path& assetPath) const;
+
+            // Reimports one asset outside of run(), e.g. from the editor's import queue, against base (a snapshot of
+            // the registry) and records it so the next run does not import it again. Returns the entries the asset
+            // produced, for the caller to apply; removedUUIDs receives those it produced before but no longer does.
+            // Thread safe.
+            std::optional<AssetRegistryEntries> reimport(const std::filesystem::path& assetPath,
+                                                         const AssetRegistryMap&      base,
+                                                         std::vector<std::string>&    removedUUIDs);
+
+            // Imports one asset into a private copy of base, so the importer never touches a registry others read.
+            // previousUUIDs (what the asset produced last time) are left out of the copy, so everything the import
+            // registers is reported, changed or not. std::nullopt if the import failed or threw.
+            static std::optional<AssetRegistryEntries> importIsolated(const std::filesystem::path& assetPath,
+                                                                      const AssetRegistryMap&      base,
+                                                                      const std::filesystem::path& importedDir,
+                                                                      std::span<const std::string> previousUUIDs);
+
+            static bool     isImportable(const std::filesystem::path& assetPath);
+            static bool     isTexture(const std::filesystem::path& assetPath);
+            static uint64_t hashFile(const std::filesystem::path& filePath);
+
+        private:
+            struct CacheEntry
+            {
+                uint64_t size {0};
+                int64_t  mtime {0};
+                uint64_t contentHash {0}; // 0 = import failed, retry
+                uint64_t metaHash {0};
+
+                std::vector<std::string> uuids; // Registry entries the last successful import produced
+            };
+
+            void loadCache();
+            void saveCache() const;
+
+            static CacheEntry computeCacheEntry(const std::filesystem::path& assetPath);
+
+            [[nodiscard]] std::string toCacheKey(const std::filesystem::path& assetPath) const;
+            [[nodiscard]] bool        hasImportedOutput(const std::filesystem::path& assetPath) const;
+
+        private:
+            vasset::VAssetRegistry& m_Registry;
+            std::filesystem::path   m_AssetDir;
+            std::filesystem::path   m_ImportedDir;
+            std::filesystem::path   m_CacheFile;
+
+            // Asset-relative generic path to cache entry
+            std::unordered_map<std::string, CacheEntry> m_Cache;
+            mutable std::mutex                          m_CacheMutex;
+        };
+    } // namespace engine
+} // namespace vultra
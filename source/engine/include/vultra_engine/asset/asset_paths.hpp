@@ -0,0 +1,17 @@
+#pragma once
+
+namespace vultra
+{
+    namespace engine
+    {
+        // Project layout shared by the editor and the command line tools, relative to the project directory
+        constexpr const char* ASSET_IMPORT_FOLDER = "Assets";
+        constexpr const char* ASSET_EXPORT_FOLDER = ".imported";
+
+        // Inside ASSET_EXPORT_FOLDER. The JSON registry predates the binary one; it is only read to migrate old
+        // projects and deleted once the binary registry has been written. Manual exports go to their own file.
+        constexpr const char* ASSET_REGISTRY_FILE        = "asset_registry.json";
+        constexpr const char* ASSET_BINARY_REGISTRY_FILE = "asset_registry.vreg";
+        constexpr const char* ASSET_REGISTRY_EXPORT_FILE = "asset_registry_export.json";
+    } // namespace engine
+} // namespace vultra
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "vultra_engine/asset/asset_import_pipeline.hpp"
+#include "vultra_engine/asset/binary_asset_registry.hpp"
+
+#include <vasset/vasset.hpp>
+
+#include <filesystem>
+
+namespace vultra
+{
+    namespace engine
+    {
+        // Startup path of a project's asset registry, shared by the editor and VultraCook so both end up with the
+        // same registry for the same Assets folder.
+        //
+        // Opens the binary registry in importedDir (ASSET_BINARY_REGISTRY_FILE) and copies it into registry, or loads
+        // the legacy JSON registry if there is no valid binary one. Then runs pipeline, which must target registry,
+        // and rewrites the binary registry only if the import changed anything, the journal holds updates or the file
+        // did not open. The JSON registry is deleted once the binary one is valid, and registry.cleanup() runs last.
+        //
+        // report receives the import report; failed imports do not stop the registry from being written. False only
+        // if the binary registry had to be written and could not be.
+        bool bootstrapAssetRegistry(vasset::VAssetRegistry&      registry,
+                                    BinaryAssetRegistry&         binaryRegistry,
+                                    AssetImportPipeline&         pipeline,
+                                    const std::filesystem::path& importedDir,
+                                    const AssetImportOptions&    options,
+                                    AssetImportReport&           report);
+    } // namespace engine
+} // namespace vultra
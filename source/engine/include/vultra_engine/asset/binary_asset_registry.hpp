@@ -0,0 +1,105 @@
+#pragma once
+
+#include <vasset/vasset.hpp>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace vultra
+{
+    namespace engine
+    {
+        struct AssetRegistryRecord
+        {
+            vasset::VUUID      uuid {};
+            vasset::VAssetType type {};
+            std::string        path; // Relative to the imported folder
+        };
+
+        // Compact on-disk form of vasset::VAssetRegistry (.imported/asset_registry.vreg).
+        //
+        // The file is a fixed-size header, a table of 32-byte entries sorted by UUID and a string pool with the
+        // imported paths. It is memory mapped and copied into a vasset::VAssetRegistry with copyTo(), which the
+        // importer and all lookups work on; that is one pass over a flat table instead of a JSON parse.
+        //
+        // Single-entry updates (renames, reimports) are appended to a journal next to the file and replayed into a
+        // small overlay on open; write() folds everything back into a fresh file and clears the journal. The JSON
+        // form written by vasset stays available for diffing, see AssetDatabase::exportRegistryJson.
+        class BinaryAssetRegistry
+        {
+        public:
+            BinaryAssetRegistry() = default;
+            ~BinaryAssetRegistry();
+
+            BinaryAssetRegistry(const BinaryAssetRegistry&)            = delete;
+            BinaryAssetRegistry& operator=(const BinaryAssetRegistry&) = delete;
+
+            // Maps the file and replays its journal. False if it is missing, from another version or truncated.
+            bool open(const std::filesystem::path& filePath);
+            void close();
+
+            [[nodiscard]] bool   isOpen() const { return m_MappedData != nullptr; }
+            [[nodiscard]] size_t size() const { return m_Size; }
+            [[nodiscard]] size_t getJournalLength() const { return m_JournalLength; }
+
+            void forEach(const std::function<void(const AssetRegistryRecord&)>& fn) const;
+
+            // Fill an in-memory registry, e.g. for the importer
+            void copyTo(vasset::VAssetRegistry& registry) const;
+
+            // O(1) I/O: one record appended to the journal
+            bool appendUpdate(const AssetRegistryRecord& record);
+            bool appendRemove(const vasset::VUUID& uuid);
+
+            // Rewrite the whole file from an in-memory registry, then map the new file and drop the journal
+            bool write(const std::filesystem::path& filePath, vasset::VAssetRegistry& registry);
+
+        private:
+            using UUIDBytes = std::array<uint8_t, 16>;
+
+            struct UUIDBytesHash
+            {
+                size_t operator()(const UUIDBytes& bytes) const;
+            };
+
+            struct MappedEntry;
+
+            [[nodiscard]] const MappedEntry* findMapped(const UUIDBytes& key) const;
+            [[nodiscard]] bool               contains(const UUIDBytes& key) const;
+
+            void replayJournal();
+            void applyJournalRecord(const UUIDBytes& key, std::optional<AssetRegistryRecord> record);
+            bool appendJournalRecord(const UUIDBytes& key, const AssetRegistryRecord* record);
+
+            [[nodiscard]] std::filesystem::path getJournalPath() const;
+
+            static UUIDBytes     toBytes(const vasset::VUUID& uuid);
+            static UUIDBytes     toBytes(std::string_view uuidStr);
+            static vasset::VUUID fromBytes(const UUIDBytes& bytes);
+
+        private:
+            std::filesystem::path m_FilePath;
+
+            const uint8_t* m_MappedData {nullptr};
+            size_t         m_MappedSize {0};
+            uint64_t       m_Tag {0}; // Ties the journal to this exact file
+
+            const MappedEntry* m_Entries {nullptr};
+            uint32_t           m_EntryCount {0};
+            const char*        m_StringPool {nullptr};
+            uint64_t           m_StringPoolSize {0};
+
+            // Journaled changes on top of the mapped table; nullopt marks a removal
+            std::unordered_map<UUIDBytes, std::optional<AssetRegistryRecord>, UUIDBytesHash> m_Overlay;
+
+            size_t m_Size {0};
+            size_t m_JournalLength {0};
+        };
+    } // namespace engine
+} // namespace vultra
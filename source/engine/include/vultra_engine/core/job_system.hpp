@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vultra
+{
+    namespace engine
+    {
+        // A small fixed-size worker pool. Jobs receive the index of the worker running them, so callers can keep
+        // per-worker state (scratch buffers, importers, ...) in a plain array without any locking.
+        class JobSystem
+        {
+        public:
+            using Job = std::function<void(uint32_t workerIndex)>;
+
+            // 0 = one worker per hardware thread. Workers show up as "<name> <index>" in traces.
+            explicit JobSystem(uint32_t workerCount = 0, const std::string& name = "Job Worker");
+            ~JobSystem();
+
+            JobSystem(const JobSystem&)            = delete;
+            JobSystem& operator=(const JobSystem&) = delete;
+
+            void submit(Job job);
+
+            // Block until every submitted job has finished.
+            void wait();
+
+            // Run fn(index, workerIndex) for index in [0, count) across all workers and wait for completion.
+            void parallelFor(size_t count, const std::function<void(size_t index, uint32_t workerIndex)>& fn);
+
+            [[nodiscard]] uint32_t getWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+            static uint32_t getDefaultWorkerCount();
+
+        private:
+            void workerLoop(uint32_t workerIndex, const std::string& threadName);
+
+        private:
+            std::vector<std::thread> m_Workers;
+            std::deque<Job>          m_Jobs;
+
+            std::mutex              m_Mutex;
+            std::condition_variable m_JobAvailable;
+            std::condition_variable m_AllDone;
+
+            size_t m_PendingJobs {0};
+            bool   m_Stopping {false};
+        };
+    } // namespace engine
+} // namespace vultra
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace vultra
+{
+    namespace engine
+    {
+        enum class MemoryTag : uint8_t
+        {
+            eGeneral = 0, // Anything not attributed to a subsystem
+            eAssets,      // Asset database: registry, meta index, imports, texture read-ahead
+            eScene,       // Entities and components, scene files, undo history
+            eConsole,     // Console log history
+            eUI,          // Editor windows
+            eGPUTextures, // Asset textures resident on the GPU
+            eGPUImGui,    // Textures drawn through ImGui: viewport render targets and thumbnails
+
+            eCount
+        };
+
+        std::string to_string(MemoryTag tag);
+
+        [[nodiscard]] constexpr bool isGPUMemoryTag(MemoryTag tag)
+        {
+            return tag == MemoryTag::eGPUTextures || tag == MemoryTag::eGPUImGui;
+        }
+
+        struct MemoryTagStats
+        {
+            int64_t  liveBytes {0};
+            int64_t  peakBytes {0};
+            uint64_t allocationCount {0}; // Since startup
+            uint64_t allocatedBytes {0};  // Since startup
+            double   allocationsPerSecond {0.0};
+            double   bytesPerSecond {0.0};
+            uint64_t budgetBytes {0}; // 0 = no budget
+        };
+
+        // Live bytes, peak and allocation rate per subsystem.
+        //
+        // CPU memory is attributed to the tag of the allocating thread, set with MemoryTagScope; the editor routes
+        // the global operator new/delete through onAllocate()/onFree() when built with the memory_hook option. GPU
+        // resources are accounted explicitly where they are created and released. Counters are relaxed atomics, so
+        // both sides are safe from any thread and never allocate.
+        //
+        // update() runs once per frame on the main thread: it refreshes the rates, records the history shown in the
+        // Memory window and warns once whenever a tag goes over its budget.
+        class MemoryTracker
+        {
+        public:
+            static constexpr size_t TAG_COUNT               = static_cast<size_t>(MemoryTag::eCount);
+            static constexpr size_t HISTORY_SIZE            = 240; // Two minutes of samples
+            static constexpr double SAMPLE_INTERVAL_SECONDS = 0.5;
+
+            static void onAllocate(MemoryTag tag, uint64_t bytes);
+            static void onFree(MemoryTag tag, uint64_t bytes);
+
+            static MemoryTag getThreadTag();
+            static void      setThreadTag(MemoryTag tag);
+
+            // Set by the heap hook; without it only explicitly tracked (GPU) memory is counted
+            static void setHeapTracked(bool isTracked);
+            static bool isHeapTracked();
+
+            // Main thread only, like getStats() and the history
+            static void update();
+
+            [[nodiscard]] static MemoryTagStats getStats(MemoryTag tag);
+
+            static void     setBudget(MemoryTag tag, uint64_t bytes);
+            static uint64_t getBudget(MemoryTag tag);
+
+            static void resetPeaks();
+
+            // Live bytes per tag, oldest sample at getHistoryOffset()
+            static const std::array<std::array<float, HISTORY_SIZE>, TAG_COUNT>& getHistory();
+            static size_t                                                     getHistoryCount();
+            static size_t                                                     getHistoryOffset();
+
+            static bool writeSnapshot(const std::filesystem::path& filePath);
+        };
+
+        // Attributes the heap allocations of the current thread to a tag until the end of the scope
+        class MemoryTagScope
+        {
+        public:
+            explicit MemoryTagScope(MemoryTag tag) : m_PreviousTag(MemoryTracker::getThreadTag())
+            {
+                MemoryTracker::setThreadTag(tag);
+            }
+
+            ~MemoryTagScope() { MemoryTracker::setThreadTag(m_PreviousTag); }
+
+            MemoryTagScope(const MemoryTagScope&)            = delete;
+            MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+        private:
+            MemoryTag m_PreviousTag;
+        };
+    } // namespace engine
+} // namespace vultra
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "vultra_engine/core/trace_recorder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace vultra
+{
+    namespace engine
+    {
+        struct ProfileScopeRecord
+        {
+            const char* name {nullptr};
+            uint64_t    beginNs {0}; // Relative to the frame start
+            uint64_t    endNs {0};
+            uint32_t    depth {0};
+        };
+
+        struct ProfileFrame
+        {
+            uint64_t index {0};
+            uint64_t durationNs {0};
+
+            // In the order the scopes were opened, so a scope's children follow it with a greater depth
+            std::vector<ProfileScopeRecord> scopes;
+        };
+
+        // Hierarchical CPU profiler for the main loop.
+        //
+        // Scopes are recorded on the thread that calls beginFrame(), once per frame, into a buffer that is reused from
+        // frame to frame; scopes opened on other threads are ignored. While disabled a scope costs one branch on a
+        // flag, so instrumentation can stay in release builds. Enabling and disabling takes effect at the next
+        // beginFrame(), so a frame never holds half of its scopes.
+        //
+        // Scope names are not copied: pass string literals or strings that outlive the frame (window names, ...).
+        class Profiler
+        {
+        public:
+            static constexpr size_t FRAME_HISTORY_SIZE = 300;
+
+            static void setEnabled(bool enabled) { s_PendingEnabled = enabled; }
+            static bool isEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+
+            // Closes the current frame, making it available through getLastFrame(), and starts the next one. Frame
+            // times are recorded whether the profiler is enabled or not.
+            static void beginFrame();
+
+            static void beginScope(const char* name);
+            static void endScope();
+
+            // Last complete frame; no scopes if the profiler was disabled during it
+            static const ProfileFrame& getLastFrame() { return s_LastFrame; }
+
+            // Ring of the last FRAME_HISTORY_SIZE frame times in milliseconds, the oldest at getFrameTimeOffset()
+            static const std::array<float, FRAME_HISTORY_SIZE>& getFrameTimes() { return s_FrameTimes; }
+
+            static size_t getFrameTimeOffset()
+            {
+                return s_FrameTimeCount < FRAME_HISTORY_SIZE ? 0 : s_FrameTimeCount % FRAME_HISTORY_SIZE;
+            }
+            static size_t getFrameTimeCount() { return std::min(s_FrameTimeCount, FRAME_HISTORY_SIZE); }
+
+            static bool isProfilingThread() { return std::this_thread::get_id() == s_ThreadId; }
+
+        private:
+            inline static std::atomic<bool> s_Enabled {false}; // Read from any thread by ProfileScope
+            inline static bool              s_PendingEnabled = false;
+
+            inline static std::thread::id s_ThreadId;
+            inline static uint64_t        s_FrameBeginNs = 0;
+            inline static uint64_t        s_FrameIndex   = 0;
+
+            inline static ProfileFrame          s_CurrentFrame;
+            inline static ProfileFrame          s_LastFrame;
+            inline static std::vector<uint32_t> s_OpenScopes; // Indices into s_CurrentFrame.scopes
+
+            inline static std::array<float, FRAME_HISTORY_SIZE> s_FrameTimes {};
+            inline static size_t                                s_FrameTimeCount = 0;
+        };
+
+        // Feeds both the frame profiler (main thread) and the trace recorder (any thread)
+        class ProfileScope
+        {
+        public:
+            explicit ProfileScope(const char* name) :
+                m_Name(name), m_IsProfiling(Profiler::isEnabled() && Profiler::isProfilingThread()),
+                m_IsTracing(TraceRecorder::isRecording())
+            {
+                if (m_IsProfiling)
+                    Profiler::beginScope(name);
+                if (m_IsTracing)
+                    m_BeginNs = getProfileClockNs();
+            }
+
+            ~ProfileScope()
+            {
+                if (m_IsTracing)
+                    TraceRecorder::record(m_Name, m_BeginNs, getProfileClockNs());
+                if (m_IsProfiling)
+                    Profiler::endScope();
+            }
+
+            ProfileScope(const ProfileScope&)            = delete;
+            ProfileScope& operator=(const ProfileScope&) = delete;
+
+        private:
+            const char* m_Name;
+            uint64_t    m_BeginNs {0};
+            bool        m_IsProfiling;
+            bool        m_IsTracing;
+        };
+    } // namespace engine
+} // namespace vultra
+
+#define VULTRA_PROFILE_CONCAT_IMPL(a, b) a##b
+#define VULTRA_PROFILE_CONCAT(a, b) VULTRA_PROFILE_CONCAT_IMPL(a, b)
+
+// Times the rest of the enclosing block
+#define VULTRA_PROFILE_SCOPE(name) \
+    ::vultra::engine::ProfileScope VULTRA_PROFILE_CONCAT(vultraProfileScope, __LINE__)(name)
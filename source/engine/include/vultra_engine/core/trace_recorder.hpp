@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace vultra
+{
+    namespace engine
+    {
+        // Steady clock in nanoseconds, shared by Profiler and TraceRecorder so both see the same timeline
+        inline uint64_t getProfileClockNs()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                             std::chrono::steady_clock::now().time_since_epoch())
+                                             .count());
+        }
+
+        struct TraceCaptureStats
+        {
+            uint32_t threadCount {0};
+            uint64_t eventCount {0};
+            uint64_t droppedCount {0};
+        };
+
+        // Records the same scopes as Profiler, from every thread, for offline analysis in chrome://tracing or
+        // https://ui.perfetto.dev.
+        //
+        // Each thread appends to its own buffer of fixed-size chunks: one relaxed store and one release store per
+        // event, no lock. A thread takes the registry lock only for its first event of a capture. Buffers are
+        // capped at MAX_EVENTS_PER_THREAD, events past that are counted as dropped.
+        //
+        // start() begins a new capture and discards the previous one. writeChromeTrace() can be called during or
+        // after a capture and only reads events that were fully written.
+        class TraceRecorder
+        {
+        public:
+            static constexpr uint64_t MAX_EVENTS_PER_THREAD = 1 << 20;
+
+            static void start();
+            static void stop();
+
+            static bool isRecording() { return s_IsRecording.load(std::memory_order_relaxed); }
+
+            // Name of the calling thread in the trace, e.g. "Main" or "Import Worker 2"
+            static void setThreadName(const std::string& name);
+
+            // name must outlive the capture, like Profiler scope names
+            static void record(const char* name, uint64_t beginNs, uint64_t endNs);
+
+            // Chrome Trace Event JSON, which Perfetto opens as well
+            static bool writeChromeTrace(const std::filesystem::path& filePath);
+
+            static TraceCaptureStats getStats();
+
+        private:
+            inline static std::atomic<bool> s_IsRecording {false};
+        };
+    } // namespace engine
+} // namespace vultra
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vultra/function/scenegraph/entity.hpp>
+
+#include <glm/glm.hpp>
+
+#include <optional>
+
+namespace vultra
+{
+    namespace engine
+    {
+        struct EntityBounds
+        {
+            glm::vec3 min {0.0f};
+            glm::vec3 max {0.0f};
+        };
+
+        // Local-space bounds of the mesh an entity renders, from the vertices of its RawMeshComponent. std::nullopt
+        // for entities without geometry (lights, cameras, empty groups) or whose mesh is not loaded, so callers pick
+        // their own stand-in. Walks every vertex, so cache the result rather than calling it per frame.
+        std::optional<EntityBounds> getEntityLocalBounds(Entity& entity);
+    } // namespace engine
+} // namespace vultra
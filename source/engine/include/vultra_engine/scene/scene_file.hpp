@@ -0,0 +1,123 @@
+#pragma once
+
+#include <vultra/function/scenegraph/entity.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vultra
+{
+    class LogicScene;
+
+    namespace engine
+    {
+        // Scene file (.vscene) layout:
+        //
+        //   header | chunk | chunk | ... | directory
+        //
+        // Entities are numbered depth-first (a parent always before its children) and split into blocks of
+        // SCENE_BLOCK_SIZE. Every block is a string table chunk, an entity chunk and one chunk per component type, each
+        // holding its rows column by column, so loading a chunk is a few bulk reads and a tight loop per column. The
+        // directory at the end lists the live chunks in load order.
+        //
+        // Entities reference each other by their index in the file, not by UUID. Loaded entities get fresh UUIDs;
+        // SceneLoader::getUUIDRemap() maps the UUIDs they had when saved to the new ones.
+        constexpr uint32_t SCENE_BLOCK_SIZE = 4096;
+
+        // Directory entry, as stored in the file
+        struct SceneChunkInfo
+        {
+            uint32_t type {0};
+            uint32_t blockIndex {0};
+            uint64_t offset {0};
+            uint64_t size {0}; // Chunk header included
+            uint64_t hash {0};
+        };
+
+        struct SceneSaveOptions
+        {
+            // Returns false to leave an entity and its children out of the file. Editor cameras are never saved.
+            std::function<bool(Entity&)> filter;
+            // Rewrite the whole file even if the existing one could be updated in place
+            bool forceFullWrite {false};
+        };
+
+        struct SceneSaveStats
+        {
+            uint32_t entityCount {0};
+            uint32_t chunkCount {0};
+            uint32_t writtenChunkCount {0};
+            uint64_t writtenBytes {0};
+            bool     isFullWrite {false};
+        };
+
+        // Saves incrementally when the file already exists: only chunks whose content changed since the last save are
+        // appended, followed by a new directory, and the header is switched over last. The file is compacted by a
+        // full rewrite once more than half of it is dead chunks. Meshes are stored by the path they were loaded from.
+        // Fails without writing anything if the scene holds a component the format cannot store yet (XR cameras).
+        bool saveScene(const std::filesystem::path& filePath,
+                       LogicScene&                  scene,
+                       const SceneSaveOptions&      options = {},
+                       SceneSaveStats*              stats   = nullptr);
+
+        // Streams a scene file into a LogicScene chunk by chunk; entities of a block appear as soon as its entity
+        // chunk has been read, so a large scene can be loaded over several frames.
+        class SceneLoader
+        {
+        public:
+            SceneLoader() = default;
+            ~SceneLoader();
+
+            SceneLoader(const SceneLoader&)            = delete;
+            SceneLoader& operator=(const SceneLoader&) = delete;
+
+            // Reads the header and directory. False if the file is missing, from another version or truncated.
+            bool open(const std::filesystem::path& filePath, LogicScene& scene);
+            void close();
+
+            // False once everything is loaded or loading failed
+            bool loadNextChunk();
+            // Loads chunks until the time budget is spent; true once the whole scene is loaded
+            bool loadFor(std::chrono::microseconds budget);
+
+            [[nodiscard]] bool     isOpen() const { return m_Scene != nullptr; }
+            [[nodiscard]] bool     isDone() const { return m_NextChunk >= m_Chunks.size(); }
+            [[nodiscard]] bool     hasFailed() const { return m_HasFailed; }
+            [[nodiscard]] float    getProgress() const;
+            [[nodiscard]] uint32_t getEntityCount() const { return m_EntityCount; }
+
+            [[nodiscard]] const std::unordered_map<std::string, CoreUUID>& getUUIDRemap() const { return m_UUIDRemap; }
+
+        private:
+            bool fail(const char* reason);
+
+        private:
+            std::filesystem::path m_FilePath;
+            std::ifstream         m_File;
+            LogicScene*           m_Scene {nullptr};
+
+            std::vector<SceneChunkInfo> m_Chunks;
+            size_t                      m_NextChunk {0};
+            uint32_t                    m_EntityCount {0};
+            bool                        m_HasFailed {false};
+
+            std::vector<uint8_t> m_Buffer;  // Chunk being read
+            std::string          m_Strings; // String table of the current block
+            std::vector<Entity>  m_Entities;
+
+            std::unordered_map<std::string, CoreUUID> m_UUIDRemap; // Saved UUID (text) -> UUID after loading
+        };
+
+        // Loads a whole scene file at once
+        bool loadScene(const std::filesystem::path& filePath, LogicScene& scene);
+
+        // Readable form of a scene file, for diffs and review
+        bool exportSceneJson(const std::filesystem::path& filePath, const std::filesystem::path& jsonPath);
+    } // namespace engine
+} // namespace vultra
@@ -0,0 +1,549 @@
+#include "vultra_engine/asset/asset_import_pipeline.hpp"
+#include "vultra_engine/core/job_system.hpp"
+#include "vultra_engine/core/memory_tracker.hpp"
+#include "vultra_engine/core/profiler.hpp"
+
+#include <vultra/core/base/common_context.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <fstream>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+
+namespace vultra
+{
+    namespace engine
+    {
+        constexpr const char* ASSET_IMPORT_CACHE_FILE    = "asset_import_cache.json";
+        constexpr const char* META_FILE_EXTENSION        = ".vmeta";
+        constexpr uint32_t    ASSET_IMPORT_CACHE_VERSION = 2;
+
+        namespace
+        {
+            using Clock = std::chrono::steady_clock;
+
+            double elapsedMs(Clock::time_point start)
+            {
+                return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            }
+
+            std::filesystem::path getMetaPath(const std::filesystem::path& assetPath)
+            {
+                auto metaPath = assetPath;
+                return metaPath.replace_extension(META_FILE_EXTENSION);
+            }
+
+            std::string readMetaUUID(const std::filesystem::path& metaPath)
+            {
+                std::ifstream inFile(metaPath);
+                if (!inFile.is_open())
+                {
+                    return {};
+                }
+
+                auto j = nlohmann::json::parse(inFile, nullptr, false);
+                if (j.is_discarded() || !j.contains("uuid") || !j["uuid"].is_string())
+                {
+                    return {};
+                }
+
+                return j["uuid"].get<std::string>();
+            }
+
+            bool isSameEntry(const AssetRegistryEntry& a, const AssetRegistryEntry& b)
+            {
+                return a.type == b.type && a.path == b.path;
+            }
+
+            void sortByUUID(AssetRegistryEntries& entries)
+            {
+                std::sort(
+                    entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+            }
+
+            // 64-bit FNV-1a mixed with the total length, chosen for being dependency free; it only has to detect
+            // edits, not resist collisions.
+            constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+            constexpr uint64_t FNV_PRIME        = 1099511628211ull;
+        } // namespace
+
+        AssetRegistryEntries diffRegistry(const AssetRegistryMap& registry, const AssetRegistryMap& base)
+        {
+            AssetRegistryEntries changed;
+            for (const auto& [uuidStr, entry] : registry)
+            {
+                const auto it = base.find(uuidStr);
+                if (it == base.end() || !isSameEntry(it->second, entry))
+                    changed.emplace_back(uuidStr, entry);
+            }
+            sortByUUID(changed);
+            return changed;
+        }
+
+        void AssetImportReport::log(size_t maxSlowest) const
+        {
+            VULTRA_CORE_INFO("Asset import: {} imported, {} up to date, {} failed, {} removed, {:.2f} MB in {:.1f} ms "
+                             "({} workers)",
+                             importedCount,
+                             skippedCount,
+                             failedCount,
+                             removedCount,
+                             static_cast<double>(importedBytes) / (1024.0 * 1024.0),
+                             totalMs,
+                             workerCount);
+
+            std::vector<const AssetImportRecord*> imported;
+            for (const auto& record : records)
+            {
+                if (!record.skipped)
+                    imported.push_back(&record);
+            }
+
+            std::sort(imported.begin(), imported.end(), [](const auto* a, const auto* b) {
+                return a->hashMs + a->importMs > b->hashMs + b->importMs;
+            });
+
+            const size_t count = std::min(maxSlowest, imported.size());
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto* record = imported[i];
+                VULTRA_CORE_INFO("  {:>8.1f} ms (hash {:.1f} ms) {:>10} bytes {}{}",
+                                 record->importMs,
+                                 record->hashMs,
+                                 record->bytes,
+                                 record->path.generic_string(),
+                                 record->succeeded ? "" : " [FAILED]");
+            }
+        }
+
+        AssetImportPipeline::AssetImportPipeline(vasset::VAssetRegistry&      registry,
+                                                 const std::filesystem::path& assetDir,
+                                                 const std::filesystem::path& importedDir) :
+            m_Registry(registry), m_AssetDir(assetDir), m_ImportedDir(importedDir),
+            m_CacheFile(importedDir / ASSET_IMPORT_CACHE_FILE)
+        {}
+
+        AssetImportReport AssetImportPipeline::run(const AssetImportOptions& options)
+        {
+            VULTRA_PROFILE_SCOPE("Asset Import");
+            MemoryTagScope memoryTag(MemoryTag::eAssets);
+
+            const auto startTime = Clock::now();
+
+            AssetImportReport report {};
+
+            std::lock_guard cacheLock(m_CacheMutex);
+
+            if (!std::filesystem::exists(m_AssetDir))
+            {
+                VULTRA_CORE_ERROR("Asset folder does not exist: {}", m_AssetDir.generic_string());
+                report.failedCount = 1;
+                return report;
+            }
+
+            loadCache();
+
+            // Collect importable source files, sorted so that every run (and every machine) processes and registers
+            // them in the same order.
+            std::vector<std::filesystem::path> assetPaths;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(m_AssetDir))
+            {
+                if (entry.is_regular_file() && isImportable(entry.path()))
+                    assetPaths.push_back(entry.path());
+            }
+            std::sort(assetPaths.begin(), assetPaths.end());
+
+            JobSystem jobSystem(options.workerCount, "Import Worker");
+            report.workerCount = jobSystem.getWorkerCount();
+            report.records.resize(assetPaths.size());
+
+            std::vector<CacheEntry>                          newEntries(assetPaths.size());
+            std::vector<std::optional<AssetRegistryEntries>> outputs(assetPaths.size());
+            std::vector<uint8_t>                             dirty(assetPaths.size(), 0);
+
+            // Pass 1: hash sources and decide what needs importing. Size + mtime matching the cache lets us reuse the
+            // previous content hash without reading the file.
+            jobSystem.parallelFor(assetPaths.size(), [&](size_t index, uint32_t) {
+                VULTRA_PROFILE_SCOPE("Hash Asset");
+                MemoryTagScope memoryTag(MemoryTag::eAssets);
+
+                const auto& assetPath = assetPaths[index];
+                auto&       record    = report.records[index];
+                auto&       entry     = newEntries[index];
+
+                const auto hashStart = Clock::now();
+
+                std::error_code ec;
+                entry.size  = std::filesystem::file_size(assetPath, ec);
+                entry.mtime = std::filesystem::last_write_time(assetPath, ec).time_since_epoch().count();
+
+                record.path  = std::filesystem::relative(assetPath, m_AssetDir);
+                record.bytes = entry.size;
+
+                const auto  cacheIt  = m_Cache.find(toCacheKey(assetPath));
+                const bool  hasCache = cacheIt != m_Cache.end();
+                const auto& cached   = hasCache ? cacheIt->second : CacheEntry {};
+
+                if (hasCache && cached.contentHash != 0 && cached.size == entry.size && cached.mtime == entry.mtime)
+                    entry.contentHash = cached.contentHash;
+                else
+                    entry.contentHash = hashFile(assetPath);
+
+                entry.metaHash = hashFile(getMetaPath(assetPath));
+                entry.uuids    = cached.uuids; // Replaced once a new import succeeds
+
+                record.hashMs = elapsedMs(hashStart);
+
+                const bool upToDate = hasCache && cached.contentHash == entry.contentHash &&
+                                      cached.metaHash == entry.metaHash && hasImportedOutput(assetPath);
+
+                dirty[index]   = (options.force || !upToDate) ? 1 : 0;
+                record.skipped = dirty[index] == 0;
+            });
+
+            // Pass 2: import. Textures go first because model importers may reference them. The target registry is
+            // only read while a phase runs and only written between phases.
+            auto importPhase = [&](bool texturePhase) {
+                std::vector<size_t> phaseIndices;
+                for (size_t i = 0; i < assetPaths.size(); ++i)
+                {
+                    if (dirty[i] && isTexture(assetPaths[i]) == texturePhase)
+                        phaseIndices.push_back(i);
+                }
+                if (phaseIndices.empty())
+                    return;
+
+                jobSystem.parallelFor(phaseIndices.size(), [&](size_t phaseIndex, uint32_t) {
+                    VULTRA_PROFILE_SCOPE(texturePhase ? "Import Texture" : "Import Model");
+                    MemoryTagScope memoryTag(MemoryTag::eAssets);
+
+                    const size_t index  = phaseIndices[phaseIndex];
+                    auto&        record = report.records[index];
+                    auto&        entry  = newEntries[index];
+
+                    const auto importStart = Clock::now();
+                    outputs[index] =
+                        importIsolated(assetPaths[index], m_Registry.getRegistry(), m_ImportedDir, entry.uuids);
+                    record.succeeded = outputs[index].has_value();
+                    record.importMs  = elapsedMs(importStart);
+
+                    // The importer may have created or rewritten the .vmeta file
+                    entry.metaHash = hashFile(getMetaPath(assetPaths[index]));
+                });
+
+                // Merged per asset in path order, so which worker ran an import never changes the result
+                auto& entries = m_Registry.getRegistry();
+                for (const size_t index : phaseIndices)
+                {
+                    if (!outputs[index])
+                        continue;
+
+                    newEntries[index].uuids.clear();
+                    for (const auto& [uuidStr, entry] : *outputs[index])
+                    {
+                        entries[uuidStr] = entry;
+                        newEntries[index].uuids.push_back(uuidStr);
+                    }
+                }
+            };
+
+            importPhase(true);
+            importPhase(false);
+
+            // Drop entries the pipeline produced before and no asset produces anymore: their source is gone, or its
+            // reimport stopped registering them (e.g. the .vmeta now names another UUID)
+            std::unordered_set<std::string> producedUUIDs;
+            for (const auto& entry : newEntries)
+                producedUUIDs.insert(entry.uuids.begin(), entry.uuids.end());
+
+            for (const auto& [key, cached] : m_Cache)
+            {
+                for (const auto& uuidStr : cached.uuids)
+                {
+                    if (!producedUUIDs.contains(uuidStr))
+                        report.removedCount += static_cast<uint32_t>(m_Registry.getRegistry().erase(uuidStr));
+                }
+            }
+
+            // Same for the import cache
+            std::unordered_set<std::string> liveKeys;
+            for (const auto& assetPath : assetPaths)
+                liveKeys.insert(toCacheKey(assetPath));
+            std::erase_if(m_Cache, [&](const auto& kv) { return !liveKeys.contains(kv.first); });
+
+            // Update the cache and the report
+            for (size_t i = 0; i < assetPaths.size(); ++i)
+            {
+                const auto& record = report.records[i];
+                const auto  key    = toCacheKey(assetPaths[i]);
+
+                if (record.skipped)
+                {
+                    ++report.skippedCount;
+                }
+                else if (record.succeeded)
+                {
+                    ++report.importedCount;
+                    report.importedBytes += record.bytes;
+                }
+                else
+                {
+                    ++report.failedCount;
+                    // Retried next time; what the asset produced before stays registered meanwhile
+                    m_Cache[key]             = newEntries[i];
+                    m_Cache[key].contentHash = 0;
+                    continue;
+                }
+
+                m_Cache[key] = newEntries[i];
+            }
+
+            saveCache();
+
+            report.totalMs = elapsedMs(startTime);
+            report.log(options.reportSlowest);
+
+            return report;
+        }
+
+        uint64_t AssetImportPipeline::getContentHash(const std::filesystem::path& assetPath) const
+        {
+            std::lock_guard lock(m_CacheMutex);
+
+            auto it = m_Cache.find(toCacheKey(assetPath));
+            return it != m_Cache.end() ? it->second.contentHash : 0;
+        }
+
+        std::optional<AssetRegistryEntries> AssetImportPipeline::reimport(const std::filesystem::path& assetPath,
+                                                                          const AssetRegistryMap&      base,
+                                                                          std::vector<std::string>&    removedUUIDs)
+        {
+            VULTRA_PROFILE_SCOPE("Reimport Asset");
+            MemoryTagScope memoryTag(MemoryTag::eAssets);
+
+            const auto key = toCacheKey(assetPath);
+
+            std::vector<std::string> previousUUIDs;
+            {
+                std::lock_guard lock(m_CacheMutex);
+                if (const auto it = m_Cache.find(key); it != m_Cache.end())
+                    previousUUIDs = it->second.uuids;
+            }
+
+            auto produced = importIsolated(assetPath, base, m_ImportedDir, previousUUIDs);
+            if (!produced)
+                return std::nullopt;
+
+            // Sorted, like produced
+            auto entry = computeCacheEntry(assetPath);
+            for (const auto& [uuidStr, producedEntry] : *produced)
+                entry.uuids.push_back(uuidStr);
+
+            removedUUIDs.clear();
+            for (const auto& uuidStr : previousUUIDs)
+            {
+                if (!std::binary_search(entry.uuids.begin(), entry.uuids.end(), uuidStr))
+                    removedUUIDs.push_back(uuidStr);
+            }
+
+            std::lock_guard lock(m_CacheMutex);
+            m_Cache[key] = std::move(entry);
+            saveCache();
+
+            return produced;
+        }
+
+        std::optional<AssetRegistryEntries>
+        AssetImportPipeline::importIsolated(const std::filesystem::path& assetPath,
+                                            const AssetRegistryMap&      base,
+                                            const std::filesystem::path& importedDir,
+                                            std::span<const std::string> previousUUIDs)
+        {
+            vasset::VAssetRegistry registry;
+            registry.setImportedFolder(importedDir.string());
+
+            auto& entries = registry.getRegistry();
+            entries       = base;
+            for (const auto& uuidStr : previousUUIDs)
+                entries.erase(uuidStr);
+
+            // Importers throw on malformed input; on a job thread that would take the whole process down
+            try
+            {
+                vasset::VAssetImporter importer(registry);
+                if (!importer.importOrReimportAsset(assetPath.string(), true))
+                    return std::nullopt;
+            }
+            catch (const std::exception& e)
+            {
+                VULTRA_CORE_ERROR("Failed to import {}: {}", assetPath.generic_string(), e.what());
+                return std::nullopt;
+            }
+
+            // Previous entries registered again unchanged are not in the diff, but still produced by this import
+            auto produced = diffRegistry(entries, base);
+            for (const auto& uuidStr : previousUUIDs)
+            {
+                const auto it     = entries.find(uuidStr);
+                const auto baseIt = base.find(uuidStr);
+                if (it != entries.end() && baseIt != base.end() && isSameEntry(it->second, baseIt->second))
+                    produced.emplace_back(uuidStr, it->second);
+            }
+            sortByUUID(produced);
+
+            return produced;
+        }
+
+        AssetImportPipeline::CacheEntry AssetImportPipeline::computeCacheEntry(const std::filesystem::path& assetPath)
+        {
+            CacheEntry entry {};
+
+            std::error_code ec;
+            entry.size        = std::filesystem::file_size(assetPath, ec);
+            entry.mtime       = std::filesystem::last_write_time(assetPath, ec).time_since_epoch().count();
+            entry.contentHash = hashFile(assetPath);
+            entry.metaHash    = hashFile(getMetaPath(assetPath));
+
+            return entry;
+        }
+
+        bool AssetImportPipeline::isImportable(const std::filesystem::path& assetPath)
+        {
+            static const std::array<const char*, 4> MODEL_EXTENSIONS = {".gltf", ".glb", ".obj", ".fbx"};
+
+            if (isTexture(assetPath))
+                return true;
+
+            auto ext = assetPath.extension().string();
+            std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return std::tolower(c); });
+            return std::find(MODEL_EXTENSIONS.begin(), MODEL_EXTENSIONS.end(), ext) != MODEL_EXTENSIONS.end();
+        }
+
+        bool AssetImportPipeline::isTexture(const std::filesystem::path& assetPath)
+        {
+            static const std::array<const char*, 9> TEXTURE_EXTENSIONS = {
+                ".png", ".jpg", ".jpeg", ".tga", ".bmp", ".hdr", ".ktx", ".ktx2", ".dds"};
+
+            auto ext = assetPath.extension().string();
+            std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return std::tolower(c); });
+            return std::find(TEXTURE_EXTENSIONS.begin(), TEXTURE_EXTENSIONS.end(), ext) != TEXTURE_EXTENSIONS.end();
+        }
+
+        uint64_t AssetImportPipeline::hashFile(const std::filesystem::path& filePath)
+        {
+            std::ifstream file(filePath, std::ios::binary);
+            if (!file.is_open())
+            {
+                return 0;
+            }
+
+            uint64_t hash  = FNV_OFFSET_BASIS;
+            uint64_t total = 0;
+
+            std::array<char, 64 * 1024> buffer {};
+            while (file)
+            {
+                file.read(buffer.data(), buffer.size());
+                const auto count = file.gcount();
+                for (std::streamsize i = 0; i < count; ++i)
+                {
+                    hash ^= static_cast<uint8_t>(buffer[i]);
+                    hash *= FNV_PRIME;
+                }
+                total += static_cast<uint64_t>(count);
+            }
+
+            hash ^= total;
+            hash *= FNV_PRIME;
+
+            // Reserve 0 for "no file"
+            return hash == 0 ? 1 : hash;
+        }
+
+        void AssetImportPipeline::loadCache()
+        {
+            m_Cache.clear();
+
+            std::ifstream inFile(m_CacheFile);
+            if (!inFile.is_open())
+            {
+                return;
+            }
+
+            auto j = nlohmann::json::parse(inFile, nullptr, false);
+            if (j.is_discarded() || j.value("version", 0u) != ASSET_IMPORT_CACHE_VERSION || !j.contains("assets"))
+            {
+                VULTRA_CORE_WARN("Ignoring outdated or corrupt asset import cache: {}", m_CacheFile.generic_string());
+                return;
+            }
+
+            for (const auto& [key, value] : j["assets"].items())
+            {
+                CacheEntry entry {};
+                entry.size        = value.value("size", uint64_t {0});
+                entry.mtime       = value.value("mtime", int64_t {0});
+                entry.contentHash = value.value("hash", uint64_t {0});
+                entry.metaHash    = value.value("metaHash", uint64_t {0});
+                entry.uuids       = value.value("uuids", std::vector<std::string> {});
+                m_Cache.emplace(key, std::move(entry));
+            }
+        }
+
+        void AssetImportPipeline::saveCache() const
+        {
+            std::filesystem::create_directories(m_ImportedDir);
+
+            // Sorted keys keep the file stable between runs
+            std::vector<const std::pair<const std::string, CacheEntry>*> sorted;
+            sorted.reserve(m_Cache.size());
+            for (const auto& kv : m_Cache)
+                sorted.push_back(&kv);
+            std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+
+            nlohmann::ordered_json assets = nlohmann::ordered_json::object();
+            for (const auto* kv : sorted)
+            {
+                assets[kv->first] = {{"size", kv->second.size},
+                                     {"mtime", kv->second.mtime},
+                                     {"hash", kv->second.contentHash},
+                                     {"metaHash", kv->second.metaHash},
+                                     {"uuids", kv->second.uuids}};
+            }
+
+            nlohmann::ordered_json j;
+            j["version"] = ASSET_IMPORT_CACHE_VERSION;
+            j["assets"]  = std::move(assets);
+
+            std::ofstream outFile(m_CacheFile);
+            if (!outFile.is_open())
+            {
+                VULTRA_CORE_ERROR("Failed to write asset import cache: {}", m_CacheFile.generic_string());
+                return;
+            }
+            outFile << j.dump(4);
+        }
+
+        std::string AssetImportPipeline::toCacheKey(const std::filesystem::path& assetPath) const
+        {
+            return std::filesystem::relative(assetPath, m_AssetDir).generic_string();
+        }
+
+        bool AssetImportPipeline::hasImportedOutput(const std::filesystem::path& assetPath) const
+        {
+            auto uuidStr = readMetaUUID(getMetaPath(assetPath));
+            if (uuidStr.empty())
+            {
+                return false;
+            }
+
+            auto entry = m_Registry.lookup(vasset::VUUID::fromString(uuidStr));
+            return !entry.path.empty() && std::filesystem::exists(m_ImportedDir / entry.path);
+        }
+    } // namespace engine
+} // namespace vultra
@@ -0,0 +1,61 @@
+#include "vultra_engine/asset/asset_registry_bootstrap.hpp"
+#include "vultra_engine/asset/asset_paths.hpp"
+
+#include <vultra/core/base/common_context.hpp>
+
+namespace vultra
+{
+    namespace engine
+    {
+        bool bootstrapAssetRegistry(vasset::VAssetRegistry&      registry,
+                                    BinaryAssetRegistry&         binaryRegistry,
+                                    AssetImportPipeline&         pipeline,
+                                    const std::filesystem::path& importedDir,
+                                    const AssetImportOptions&    options,
+                                    AssetImportReport&           report)
+        {
+            const auto registryFile       = importedDir / ASSET_REGISTRY_FILE;
+            const auto binaryRegistryFile = importedDir / ASSET_BINARY_REGISTRY_FILE;
+
+            std::error_code ec;
+
+            registry.setImportedFolder(importedDir.string());
+            if (binaryRegistry.open(binaryRegistryFile))
+            {
+                // Lookups and imports work on the in-memory copy; the mapped file only backs the journal
+                binaryRegistry.copyTo(registry);
+
+                // The JSON registry is only for migration; a stale copy must never stand in for a damaged .vreg
+                std::filesystem::remove(registryFile, ec);
+            }
+            else if (std::filesystem::exists(registryFile))
+            {
+                // Projects from before the binary registry; the JSON file is converted by the write below
+                registry.load(registryFile.string());
+            }
+
+            // Incremental, parallel import: only assets whose content or import settings changed are reimported
+            report = pipeline.run(options);
+
+            // A warm start with nothing reimported leaves the file as it is
+            bool written = true;
+            if (!binaryRegistry.isOpen() || report.importedCount > 0 || report.removedCount > 0 ||
+                binaryRegistry.getJournalLength() > 0 || binaryRegistry.size() != registry.getRegistry().size())
+            {
+                written = binaryRegistry.write(binaryRegistryFile, registry);
+                if (written)
+                {
+                    // Migrated; left behind it would be read again whenever the binary registry fails to open
+                    std::filesystem::remove(registryFile, ec);
+                }
+                else
+                {
+                    VULTRA_CORE_ERROR("Failed to write asset registry {}", binaryRegistryFile.generic_string());
+                }
+            }
+            registry.cleanup();
+
+            return written;
+        }
+    } // namespace engine
+} // namespace vultra
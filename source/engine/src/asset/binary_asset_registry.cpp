@@ -0,0 +1,536 @@
+#include "vultra_engine/asset/binary_asset_registry.hpp"
+
+#include <vultra/core/base/common_context.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vultra
+{
+    namespace engine
+    {
+        constexpr uint32_t REGISTRY_MAGIC         = 0x47455256; // "VREG"
+        constexpr uint32_t REGISTRY_VERSION       = 1;
+        constexpr uint32_t REGISTRY_JOURNAL_MAGIC = 0x4A524556; // "VERJ"
+        constexpr uint32_t REGISTRY_RECORD_MAGIC  = 0x52524556; // "VERR"
+        constexpr uint32_t MAX_JOURNAL_PATH       = 64 * 1024;
+
+        // All offsets are from the start of the file; the layout is native endian
+        struct RegistryFileHeader
+        {
+            uint32_t magic {REGISTRY_MAGIC};
+            uint32_t version {REGISTRY_VERSION};
+            uint32_t entryCount {0};
+            uint32_t entrySize {0};
+            uint64_t entriesOffset {0};
+            uint64_t stringPoolOffset {0};
+            uint64_t stringPoolSize {0};
+            uint64_t tag {0};
+        };
+
+        struct BinaryAssetRegistry::MappedEntry
+        {
+            UUIDBytes uuid {};
+            uint32_t  type {0};
+            uint32_t  pathOffset {0};
+            uint32_t  pathLength {0};
+            uint32_t  reserved {0};
+        };
+
+        struct RegistryJournalHeader
+        {
+            uint32_t magic {REGISTRY_JOURNAL_MAGIC};
+            uint32_t version {REGISTRY_VERSION};
+            uint64_t tag {0};
+        };
+
+        enum class RegistryJournalOp : uint32_t
+        {
+            eUpdate = 1,
+            eRemove = 2,
+        };
+
+        struct RegistryJournalRecord
+        {
+            uint32_t                magic {REGISTRY_RECORD_MAGIC};
+            RegistryJournalOp       op {RegistryJournalOp::eUpdate};
+            std::array<uint8_t, 16> uuid {};
+            uint32_t                type {0};
+            uint32_t                pathLength {0};
+        };
+
+        namespace
+        {
+            bool mapFile(const std::filesystem::path& filePath, const uint8_t*& outData, size_t& outSize)
+            {
+#ifdef _WIN32
+                HANDLE file = CreateFileW(filePath.c_str(),
+                                          GENERIC_READ,
+                                          FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                          nullptr,
+                                          OPEN_EXISTING,
+                                          FILE_ATTRIBUTE_NORMAL,
+                                          nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                    return false;
+
+                LARGE_INTEGER size {};
+                if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+                {
+                    CloseHandle(file);
+                    return false;
+                }
+
+                HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                CloseHandle(file);
+                if (!mapping)
+                    return false;
+
+                // The view keeps the mapping alive on its own
+                void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);
+                if (!view)
+                    return false;
+
+                outData = static_cast<const uint8_t*>(view);
+                outSize = static_cast<size_t>(size.QuadPart);
+                return true;
+#else
+                const int fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+                if (fd < 0)
+                    return false;
+
+                struct stat st {};
+                if (::fstat(fd, &st) != 0 || st.st_size == 0)
+                {
+                    ::close(fd);
+                    return false;
+                }
+
+                void* data = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if (data == MAP_FAILED)
+                    return false;
+
+                outData = static_cast<const uint8_t*>(data);
+                outSize = static_cast<size_t>(st.st_size);
+                return true;
+#endif
+            }
+
+            void unmapFile(const uint8_t* data, size_t size)
+            {
+#ifdef _WIN32
+                (void)size;
+                UnmapViewOfFile(data);
+#else
+                ::munmap(const_cast<uint8_t*>(data), size);
+#endif
+            }
+
+            // The journal tag is derived from the content rather than the time, so the same registry always produces
+            // the same file, byte for byte (cooked output is compared across machines)
+            uint64_t hashContent(const void* entries, size_t entriesSize, const std::string& pool)
+            {
+                uint64_t hash  = 0xCBF29CE484222325ull;
+                auto     mixIn = [&hash](const void* data, size_t size) {
+                    const auto* bytes = static_cast<const uint8_t*>(data);
+                    for (size_t i = 0; i < size; ++i)
+                    {
+                        hash ^= bytes[i];
+                        hash *= 0x100000001B3ull;
+                    }
+                };
+
+                mixIn(entries, entriesSize);
+                mixIn(pool.data(), pool.size());
+                return hash;
+            }
+
+            int hexValue(char c)
+            {
+                if (c >= '0' && c <= '9')
+                    return c - '0';
+                if (c >= 'a' && c <= 'f')
+                    return c - 'a' + 10;
+                if (c >= 'A' && c <= 'F')
+                    return c - 'A' + 10;
+                return -1;
+            }
+        } // namespace
+
+        BinaryAssetRegistry::~BinaryAssetRegistry() { close(); }
+
+        bool BinaryAssetRegistry::open(const std::filesystem::path& filePath)
+        {
+            close();
+            m_FilePath = filePath;
+
+            if (!mapFile(filePath, m_MappedData, m_MappedSize))
+                return false;
+
+            // Only the header is validated: checksumming the tables would touch every page and defeat the mapping
+            RegistryFileHeader header {};
+            bool               valid = m_MappedSize >= sizeof(header);
+            if (valid)
+            {
+                std::memcpy(&header, m_MappedData, sizeof(header));
+
+                const uint64_t entriesEnd = header.entriesOffset + uint64_t(header.entryCount) * sizeof(MappedEntry);
+                valid = header.magic == REGISTRY_MAGIC && header.version == REGISTRY_VERSION &&
+                        header.entrySize == sizeof(MappedEntry) && header.entriesOffset % alignof(MappedEntry) == 0 &&
+                        entriesEnd <= m_MappedSize &&
+                        header.stringPoolOffset + header.stringPoolSize <= m_MappedSize;
+            }
+
+            if (!valid)
+            {
+                VULTRA_CORE_WARN("Ignoring invalid asset registry file: {}", filePath.generic_string());
+                close();
+                return false;
+            }
+
+            m_Tag            = header.tag;
+            m_Entries        = reinterpret_cast<const MappedEntry*>(m_MappedData + header.entriesOffset);
+            m_EntryCount     = header.entryCount;
+            m_StringPool     = reinterpret_cast<const char*>(m_MappedData + header.stringPoolOffset);
+            m_StringPoolSize = header.stringPoolSize;
+            m_Size           = m_EntryCount;
+
+            replayJournal();
+            return true;
+        }
+
+        void BinaryAssetRegistry::close()
+        {
+            if (m_MappedData)
+                unmapFile(m_MappedData, m_MappedSize);
+
+            m_MappedData     = nullptr;
+            m_MappedSize     = 0;
+            m_Tag            = 0;
+            m_Entries        = nullptr;
+            m_EntryCount     = 0;
+            m_StringPool     = nullptr;
+            m_StringPoolSize = 0;
+            m_Size           = 0;
+            m_JournalLength  = 0;
+            m_Overlay.clear();
+        }
+
+        void BinaryAssetRegistry::forEach(const std::function<void(const AssetRegistryRecord&)>& fn) const
+        {
+            AssetRegistryRecord record;
+            for (uint32_t i = 0; i < m_EntryCount; ++i)
+            {
+                const auto& entry = m_Entries[i];
+                if (m_Overlay.contains(entry.uuid) ||
+                    uint64_t(entry.pathOffset) + entry.pathLength > m_StringPoolSize)
+                    continue;
+
+                record.uuid = fromBytes(entry.uuid);
+                record.type = static_cast<vasset::VAssetType>(entry.type);
+                record.path.assign(m_StringPool + entry.pathOffset, entry.pathLength);
+                fn(record);
+            }
+
+            for (const auto& [key, overlayRecord] : m_Overlay)
+            {
+                if (overlayRecord)
+                    fn(*overlayRecord);
+            }
+        }
+
+        void BinaryAssetRegistry::copyTo(vasset::VAssetRegistry& registry) const
+        {
+            auto& entries = registry.getRegistry();
+            forEach([&entries](const AssetRegistryRecord& record) {
+                auto& entry = entries[record.uuid.toString()];
+                entry.type  = record.type;
+                entry.path  = record.path;
+            });
+        }
+
+        bool BinaryAssetRegistry::appendUpdate(const AssetRegistryRecord& record)
+        {
+            const auto key = toBytes(record.uuid);
+            if (!appendJournalRecord(key, &record))
+                return false;
+
+            applyJournalRecord(key, record);
+            return true;
+        }
+
+        bool BinaryAssetRegistry::appendRemove(const vasset::VUUID& uuid)
+        {
+            const auto key = toBytes(uuid);
+            if (!appendJournalRecord(key, nullptr))
+                return false;
+
+            applyJournalRecord(key, std::nullopt);
+            return true;
+        }
+
+        bool BinaryAssetRegistry::write(const std::filesystem::path& filePath, vasset::VAssetRegistry& registry)
+        {
+            static_assert(sizeof(MappedEntry) == 32, "Entry size is part of the file format");
+
+            struct PendingEntry
+            {
+                UUIDBytes   uuid;
+                uint32_t    type;
+                std::string path;
+            };
+
+            std::vector<PendingEntry> pending;
+            pending.reserve(registry.getRegistry().size());
+            for (const auto& [uuidStr, entry] : registry.getRegistry())
+            {
+                pending.push_back({toBytes(uuidStr),
+                                   static_cast<uint32_t>(entry.type),
+                                   std::filesystem::path(entry.path).generic_string()});
+            }
+
+            std::sort(pending.begin(), pending.end(), [](const PendingEntry& a, const PendingEntry& b) {
+                return a.uuid < b.uuid;
+            });
+
+            std::vector<MappedEntry> entries;
+            std::string              stringPool;
+            entries.reserve(pending.size());
+            for (const auto& item : pending)
+            {
+                auto& entry      = entries.emplace_back();
+                entry.uuid       = item.uuid;
+                entry.type       = item.type;
+                entry.pathOffset = static_cast<uint32_t>(stringPool.size());
+                entry.pathLength = static_cast<uint32_t>(item.path.size());
+                stringPool += item.path;
+            }
+
+            RegistryFileHeader header {};
+            header.entryCount       = static_cast<uint32_t>(entries.size());
+            header.entrySize        = sizeof(MappedEntry);
+            header.entriesOffset    = sizeof(RegistryFileHeader);
+            header.stringPoolOffset = header.entriesOffset + entries.size() * sizeof(MappedEntry);
+            header.stringPoolSize   = stringPool.size();
+            header.tag              = hashContent(entries.data(), entries.size() * sizeof(MappedEntry), stringPool);
+
+            // Write next to the target and swap it in, so a crash never leaves a half-written registry behind
+            auto tmpPath = filePath;
+            tmpPath += ".tmp";
+            {
+                std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+                out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                out.write(reinterpret_cast<const char*>(entries.data()),
+                          static_cast<std::streamsize>(entries.size() * sizeof(MappedEntry)));
+                out.write(stringPool.data(), static_cast<std::streamsize>(stringPool.size()));
+                if (!out.good())
+                {
+                    VULTRA_CORE_ERROR("Failed to write asset registry: {}", tmpPath.generic_string());
+                    return false;
+                }
+            }
+
+            // Windows cannot replace a file that is still mapped
+            close();
+
+            std::error_code ec;
+            std::filesystem::rename(tmpPath, filePath, ec);
+            if (ec)
+            {
+                VULTRA_CORE_ERROR("Failed to replace asset registry {}: {}", filePath.generic_string(), ec.message());
+                std::filesystem::remove(tmpPath, ec);
+                return false;
+            }
+
+            m_FilePath = filePath;
+            std::filesystem::remove(getJournalPath(), ec);
+
+            return open(filePath);
+        }
+
+        size_t BinaryAssetRegistry::UUIDBytesHash::operator()(const UUIDBytes& bytes) const
+        {
+            // UUIDs are random already, folding them is enough
+            uint64_t lo = 0;
+            uint64_t hi = 0;
+            std::memcpy(&lo, bytes.data(), sizeof(lo));
+            std::memcpy(&hi, bytes.data() + sizeof(lo), sizeof(hi));
+            return static_cast<size_t>(lo ^ (hi * 0x9E3779B97F4A7C15ull));
+        }
+
+        const BinaryAssetRegistry::MappedEntry* BinaryAssetRegistry::findMapped(const UUIDBytes& key) const
+        {
+            auto byUUID = [](const MappedEntry& entry, const UUIDBytes& value) { return entry.uuid < value; };
+
+            const auto* end = m_Entries + m_EntryCount;
+            const auto* it  = std::lower_bound(m_Entries, end, key, byUUID);
+
+            return (it != end && it->uuid == key) ? it : nullptr;
+        }
+
+        bool BinaryAssetRegistry::contains(const UUIDBytes& key) const
+        {
+            auto it = m_Overlay.find(key);
+            if (it != m_Overlay.end())
+                return it->second.has_value();
+
+            return findMapped(key) != nullptr;
+        }
+
+        void BinaryAssetRegistry::replayJournal()
+        {
+            std::ifstream in(getJournalPath(), std::ios::binary);
+            if (!in.is_open())
+                return;
+
+            // A journal left over from an older file belongs to data that has been folded in already
+            RegistryJournalHeader header {};
+            if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != REGISTRY_JOURNAL_MAGIC ||
+                header.version != REGISTRY_VERSION || header.tag != m_Tag)
+                return;
+
+            RegistryJournalRecord record {};
+            while (in.read(reinterpret_cast<char*>(&record), sizeof(record)))
+            {
+                // A torn last record (crash mid-append) ends the replay
+                if (record.magic != REGISTRY_RECORD_MAGIC || record.pathLength > MAX_JOURNAL_PATH)
+                    break;
+
+                std::string path(record.pathLength, '\0');
+                if (!in.read(path.data(), record.pathLength))
+                    break;
+
+                if (record.op == RegistryJournalOp::eUpdate)
+                {
+                    AssetRegistryRecord update {
+                        fromBytes(record.uuid), static_cast<vasset::VAssetType>(record.type), std::move(path)};
+                    applyJournalRecord(record.uuid, std::move(update));
+                }
+                else
+                {
+                    applyJournalRecord(record.uuid, std::nullopt);
+                }
+
+                ++m_JournalLength;
+            }
+        }
+
+        void BinaryAssetRegistry::applyJournalRecord(const UUIDBytes& key, std::optional<AssetRegistryRecord> record)
+        {
+            const bool existed = contains(key);
+            const bool exists  = record.has_value();
+
+            m_Overlay[key] = std::move(record);
+
+            if (existed && !exists)
+                --m_Size;
+            else if (!existed && exists)
+                ++m_Size;
+        }
+
+        bool BinaryAssetRegistry::appendJournalRecord(const UUIDBytes& key, const AssetRegistryRecord* record)
+        {
+            if (!isOpen())
+                return false;
+
+            // The first record starts a new journal, replacing any stale one
+            const auto    mode = std::ios::binary | (m_JournalLength == 0 ? std::ios::trunc : std::ios::app);
+            std::ofstream out(getJournalPath(), mode);
+            if (m_JournalLength == 0)
+            {
+                RegistryJournalHeader header {};
+                header.tag = m_Tag;
+                out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            }
+
+            RegistryJournalRecord journalRecord {};
+            journalRecord.op   = record ? RegistryJournalOp::eUpdate : RegistryJournalOp::eRemove;
+            journalRecord.uuid = key;
+            if (record)
+            {
+                journalRecord.type       = static_cast<uint32_t>(record->type);
+                journalRecord.pathLength = static_cast<uint32_t>(record->path.size());
+            }
+
+            out.write(reinterpret_cast<const char*>(&journalRecord), sizeof(journalRecord));
+            if (record)
+                out.write(record->path.data(), static_cast<std::streamsize>(record->path.size()));
+            out.flush();
+
+            if (!out.good())
+            {
+                VULTRA_CORE_ERROR("Failed to append to asset registry journal: {}", getJournalPath().generic_string());
+                return false;
+            }
+
+            ++m_JournalLength;
+            return true;
+        }
+
+        std::filesystem::path BinaryAssetRegistry::getJournalPath() const
+        {
+            auto journalPath = m_FilePath;
+            journalPath += ".journal";
+            return journalPath;
+        }
+
+        BinaryAssetRegistry::UUIDBytes BinaryAssetRegistry::toBytes(const vasset::VUUID& uuid)
+        {
+            return toBytes(uuid.toString());
+        }
+
+        BinaryAssetRegistry::UUIDBytes BinaryAssetRegistry::toBytes(std::string_view uuidStr)
+        {
+            // Canonical text form, dashes skipped; byte order then matches the string order
+            UUIDBytes bytes {};
+            size_t    nibble = 0;
+            for (char c : uuidStr)
+            {
+                const int value = hexValue(c);
+                if (value < 0)
+                    continue;
+                if (nibble >= bytes.size() * 2)
+                    break;
+
+                bytes[nibble / 2] |= static_cast<uint8_t>(nibble % 2 == 0 ? value << 4 : value);
+                ++nibble;
+            }
+            return bytes;
+        }
+
+        vasset::VUUID BinaryAssetRegistry::fromBytes(const UUIDBytes& bytes)
+        {
+            constexpr const char* HEX_DIGITS = "0123456789abcdef";
+
+            std::string text;
+            text.reserve(36);
+            for (size_t i = 0; i < bytes.size(); ++i)
+            {
+                if (i == 4 || i == 6 || i == 8 || i == 10)
+                    text += '-';
+                text += HEX_DIGITS[bytes[i] >> 4];
+                text += HEX_DIGITS[bytes[i] & 0xF];
+            }
+            return vasset::VUUID::fromString(text);
+        }
+    } // namespace engine
+} // namespace vultra
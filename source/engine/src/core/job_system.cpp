@@ -0,0 +1,114 @@
+#include "vultra_engine/core/job_system.hpp"
+#include "vultra_engine/core/trace_recorder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <format>
+#include <memory>
+
+namespace vultra
+{
+    namespace engine
+    {
+        JobSystem::JobSystem(uint32_t workerCount, const std::string& name)
+        {
+            if (workerCount == 0)
+            {
+                workerCount = getDefaultWorkerCount();
+            }
+
+            m_Workers.reserve(workerCount);
+            for (uint32_t i = 0; i < workerCount; ++i)
+            {
+                m_Workers.emplace_back([this, i, threadName = std::format("{} {}", name, i)]() {
+                    workerLoop(i, threadName);
+                });
+            }
+        }
+
+        JobSystem::~JobSystem()
+        {
+            {
+                std::lock_guard lock(m_Mutex);
+                m_Stopping = true;
+            }
+            m_JobAvailable.notify_all();
+
+            for (auto& worker : m_Workers)
+            {
+                if (worker.joinable())
+                    worker.join();
+            }
+        }
+
+        void JobSystem::submit(Job job)
+        {
+            {
+                std::lock_guard lock(m_Mutex);
+                m_Jobs.push_back(std::move(job));
+                ++m_PendingJobs;
+            }
+            m_JobAvailable.notify_one();
+        }
+
+        void JobSystem::wait()
+        {
+            std::unique_lock lock(m_Mutex);
+            m_AllDone.wait(lock, [this]() { return m_PendingJobs == 0; });
+        }
+
+        void JobSystem::parallelFor(size_t count, const std::function<void(size_t index, uint32_t workerIndex)>& fn)
+        {
+            if (count == 0)
+                return;
+
+            // One job per worker pulling indices from a shared counter keeps the queue short and balances uneven
+            // item costs (e.g. a 4K texture next to a 64x64 one).
+            auto nextIndex = std::make_shared<std::atomic<size_t>>(0);
+
+            const auto jobCount = static_cast<uint32_t>(std::min<size_t>(count, m_Workers.size()));
+            for (uint32_t i = 0; i < jobCount; ++i)
+            {
+                submit([nextIndex, count, &fn](uint32_t workerIndex) {
+                    for (size_t index = nextIndex->fetch_add(1); index < count; index = nextIndex->fetch_add(1))
+                    {
+                        fn(index, workerIndex);
+                    }
+                });
+            }
+
+            wait();
+        }
+
+        uint32_t JobSystem::getDefaultWorkerCount() { return std::max(1u, std::thread::hardware_concurrency()); }
+
+        void JobSystem::workerLoop(uint32_t workerIndex, const std::string& threadName)
+        {
+            TraceRecorder::setThreadName(threadName);
+
+            while (true)
+            {
+                Job job;
+                {
+                    std::unique_lock lock(m_Mutex);
+                    m_JobAvailable.wait(lock, [this]() { return m_Stopping || !m_Jobs.empty(); });
+
+                    if (m_Stopping && m_Jobs.empty())
+                        return;
+
+                    job = std::move(m_Jobs.front());
+                    m_Jobs.pop_front();
+                }
+
+                job(workerIndex);
+
+                {
+                    std::lock_guard lock(m_Mutex);
+                    --m_PendingJobs;
+                    if (m_PendingJobs == 0)
+                        m_AllDone.notify_all();
+                }
+            }
+        }
+    } // namespace engine
+} // namespace vultra
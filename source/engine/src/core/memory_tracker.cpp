@@ -0,0 +1,254 @@
+#include "vultra_engine/core/memory_tracker.hpp"
+#include "vultra_engine/core/trace_recorder.hpp"
+
+#include <vultra/core/base/common_context.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+
+namespace vultra
+{
+    namespace engine
+    {
+        namespace
+        {
+            constexpr double BUDGET_REARM_RATIO = 0.9;
+
+            // One cache line per tag, so threads allocating under different tags don't contend
+            struct alignas(64) TagCounters
+            {
+                std::atomic<int64_t>  liveBytes {0};
+                std::atomic<int64_t>  peakBytes {0};
+                std::atomic<uint64_t> allocationCount {0};
+                std::atomic<uint64_t> allocatedBytes {0};
+                std::atomic<uint64_t> budgetBytes {0};
+            };
+
+            // Constant-initialized: the heap hook can run before any dynamic initializer
+            constinit std::array<TagCounters, MemoryTracker::TAG_COUNT> s_Counters {};
+            constinit std::atomic<bool>                                 s_IsHeapTracked {false};
+            constinit thread_local MemoryTag                            t_Tag = MemoryTag::eGeneral;
+
+            // Main thread only
+            struct TagRates
+            {
+                uint64_t lastAllocationCount {0};
+                uint64_t lastAllocatedBytes {0};
+                double   allocationsPerSecond {0.0};
+                double   bytesPerSecond {0.0};
+                bool     isOverBudget {false};
+            };
+
+            std::array<TagRates, MemoryTracker::TAG_COUNT>                                            s_Rates {};
+            std::array<std::array<float, MemoryTracker::HISTORY_SIZE>, MemoryTracker::TAG_COUNT> s_History {};
+            size_t                                                                                s_HistoryCount = 0;
+            uint64_t                                                                              s_LastSampleNs = 0;
+
+            double toMegabytes(int64_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); }
+        } // namespace
+
+        std::string to_string(MemoryTag tag)
+        {
+            switch (tag)
+            {
+                case MemoryTag::eGeneral:
+                    return "General";
+                case MemoryTag::eAssets:
+                    return "Assets";
+                case MemoryTag::eScene:
+                    return "Scene";
+                case MemoryTag::eConsole:
+                    return "Console";
+                case MemoryTag::eUI:
+                    return "UI";
+                case MemoryTag::eGPUTextures:
+                    return "Textures (GPU)";
+                case MemoryTag::eGPUImGui:
+                    return "ImGui Textures (GPU)";
+                default:
+                    return "Unknown";
+            }
+        }
+
+        void MemoryTracker::onAllocate(MemoryTag tag, uint64_t bytes)
+        {
+            auto& counters = s_Counters[static_cast<size_t>(tag)];
+
+            const auto    signedBytes = static_cast<int64_t>(bytes);
+            const int64_t liveBytes =
+                counters.liveBytes.fetch_add(signedBytes, std::memory_order_relaxed) + signedBytes;
+            counters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+            counters.allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+            // Only contended while the peak is actually moving
+            int64_t peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+            while (liveBytes > peakBytes &&
+                   !counters.peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void MemoryTracker::onFree(MemoryTag tag, uint64_t bytes)
+        {
+            s_Counters[static_cast<size_t>(tag)].liveBytes.fetch_sub(static_cast<int64_t>(bytes),
+                                                                     std::memory_order_relaxed);
+        }
+
+        MemoryTag MemoryTracker::getThreadTag() { return t_Tag; }
+
+        void MemoryTracker::setThreadTag(MemoryTag tag) { t_Tag = tag; }
+
+        void MemoryTracker::setHeapTracked(bool isTracked)
+        {
+            s_IsHeapTracked.store(isTracked, std::memory_order_relaxed);
+        }
+
+        bool MemoryTracker::isHeapTracked() { return s_IsHeapTracked.load(std::memory_order_relaxed); }
+
+        void MemoryTracker::update()
+        {
+            const uint64_t nowNs = getProfileClockNs();
+            if (s_LastSampleNs == 0)
+            {
+                s_LastSampleNs = nowNs;
+                for (size_t i = 0; i < TAG_COUNT; i++)
+                {
+                    s_Rates[i].lastAllocationCount = s_Counters[i].allocationCount.load(std::memory_order_relaxed);
+                    s_Rates[i].lastAllocatedBytes  = s_Counters[i].allocatedBytes.load(std::memory_order_relaxed);
+                }
+                return;
+            }
+
+            const double elapsedSeconds = static_cast<double>(nowNs - s_LastSampleNs) / 1e9;
+            if (elapsedSeconds < SAMPLE_INTERVAL_SECONDS)
+                return;
+            s_LastSampleNs = nowNs;
+
+            const size_t sample = s_HistoryCount % HISTORY_SIZE;
+            s_HistoryCount++;
+
+            for (size_t i = 0; i < TAG_COUNT; i++)
+            {
+                auto& counters = s_Counters[i];
+                auto& rates    = s_Rates[i];
+
+                const uint64_t allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+                const uint64_t allocatedBytes  = counters.allocatedBytes.load(std::memory_order_relaxed);
+                const int64_t  liveBytes       = counters.liveBytes.load(std::memory_order_relaxed);
+
+                rates.allocationsPerSecond =
+                    static_cast<double>(allocationCount - rates.lastAllocationCount) / elapsedSeconds;
+                rates.bytesPerSecond = static_cast<double>(allocatedBytes - rates.lastAllocatedBytes) / elapsedSeconds;
+                rates.lastAllocationCount = allocationCount;
+                rates.lastAllocatedBytes  = allocatedBytes;
+
+                s_History[i][sample] = static_cast<float>(toMegabytes(liveBytes));
+
+                // Warn once per excursion; re-armed after dropping back well below the budget
+                const auto budgetBytes = static_cast<int64_t>(counters.budgetBytes.load(std::memory_order_relaxed));
+                if (budgetBytes == 0)
+                {
+                    rates.isOverBudget = false;
+                }
+                else if (!rates.isOverBudget && liveBytes > budgetBytes)
+                {
+                    rates.isOverBudget = true;
+                    VULTRA_CORE_WARN("{} memory is over budget: {:.1f} MB of {:.1f} MB",
+                                     to_string(static_cast<MemoryTag>(i)),
+                                     toMegabytes(liveBytes),
+                                     toMegabytes(budgetBytes));
+                }
+                else if (rates.isOverBudget &&
+                         static_cast<double>(liveBytes) < static_cast<double>(budgetBytes) * BUDGET_REARM_RATIO)
+                {
+                    rates.isOverBudget = false;
+                }
+            }
+        }
+
+        MemoryTagStats MemoryTracker::getStats(MemoryTag tag)
+        {
+            const auto& counters = s_Counters[static_cast<size_t>(tag)];
+            const auto& rates    = s_Rates[static_cast<size_t>(tag)];
+
+            MemoryTagStats stats {};
+            stats.liveBytes            = counters.liveBytes.load(std::memory_order_relaxed);
+            stats.peakBytes            = counters.peakBytes.load(std::memory_order_relaxed);
+            stats.allocationCount      = counters.allocationCount.load(std::memory_order_relaxed);
+            stats.allocatedBytes       = counters.allocatedBytes.load(std::memory_order_relaxed);
+            stats.allocationsPerSecond = rates.allocationsPerSecond;
+            stats.bytesPerSecond       = rates.bytesPerSecond;
+            stats.budgetBytes          = counters.budgetBytes.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+        void MemoryTracker::setBudget(MemoryTag tag, uint64_t bytes)
+        {
+            s_Counters[static_cast<size_t>(tag)].budgetBytes.store(bytes, std::memory_order_relaxed);
+        }
+
+        uint64_t MemoryTracker::getBudget(MemoryTag tag)
+        {
+            return s_Counters[static_cast<size_t>(tag)].budgetBytes.load(std::memory_order_relaxed);
+        }
+
+        void MemoryTracker::resetPeaks()
+        {
+            for (auto& counters : s_Counters)
+                counters.peakBytes.store(counters.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        const std::array<std::array<float, MemoryTracker::HISTORY_SIZE>, MemoryTracker::TAG_COUNT>&
+        MemoryTracker::getHistory()
+        {
+            return s_History;
+        }
+
+        size_t MemoryTracker::getHistoryCount() { return std::min(s_HistoryCount, HISTORY_SIZE); }
+
+        size_t MemoryTracker::getHistoryOffset()
+        {
+            return s_HistoryCount < HISTORY_SIZE ? 0 : s_HistoryCount % HISTORY_SIZE;
+        }
+
+        bool MemoryTracker::writeSnapshot(const std::filesystem::path& filePath)
+        {
+            nlohmann::ordered_json tags = nlohmann::ordered_json::array();
+            for (size_t i = 0; i < TAG_COUNT; i++)
+            {
+                const auto tag   = static_cast<MemoryTag>(i);
+                const auto stats = getStats(tag);
+
+                nlohmann::ordered_json entry;
+                entry["tag"]                  = to_string(tag);
+                entry["gpu"]                  = isGPUMemoryTag(tag);
+                entry["liveBytes"]            = stats.liveBytes;
+                entry["peakBytes"]            = stats.peakBytes;
+                entry["budgetBytes"]          = stats.budgetBytes;
+                entry["allocationCount"]      = stats.allocationCount;
+                entry["allocatedBytes"]       = stats.allocatedBytes;
+                entry["allocationsPerSecond"] = stats.allocationsPerSecond;
+                entry["bytesPerSecond"]       = stats.bytesPerSecond;
+                tags.push_back(std::move(entry));
+            }
+
+            nlohmann::ordered_json j;
+            j["timestamp"] =
+                std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+            j["heapTracked"] = isHeapTracked();
+            j["tags"]        = std::move(tags);
+
+            std::ofstream out(filePath, std::ios::trunc);
+            if (!out.is_open())
+                return false;
+
+            out << j.dump(4) << '\n';
+            return out.good();
+        }
+    } // namespace engine
+} // namespace vultra
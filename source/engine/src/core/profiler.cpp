@@ -0,0 +1,58 @@
+#include "vultra_engine/core/profiler.hpp"
+
+namespace vultra
+{
+    namespace engine
+    {
+        void Profiler::beginFrame()
+        {
+            const uint64_t frameBeginNs = getProfileClockNs();
+
+            // The first call makes this the profiling thread
+            if (s_FrameIndex > 0)
+            {
+                s_CurrentFrame.durationNs = frameBeginNs - s_FrameBeginNs;
+
+                s_FrameTimes[s_FrameTimeCount % FRAME_HISTORY_SIZE] =
+                    static_cast<float>(static_cast<double>(s_CurrentFrame.durationNs) / 1e6);
+                s_FrameTimeCount++;
+
+                // Scopes still open at the frame boundary are cut at the end of the frame
+                for (const auto index : s_OpenScopes)
+                    s_CurrentFrame.scopes[index].endNs = s_CurrentFrame.durationNs;
+
+                // Swap rather than copy, both buffers keep their capacity
+                std::swap(s_LastFrame, s_CurrentFrame);
+            }
+
+            s_ThreadId     = std::this_thread::get_id();
+            s_FrameBeginNs = frameBeginNs;
+
+            s_CurrentFrame.index      = s_FrameIndex++;
+            s_CurrentFrame.durationNs = 0;
+            s_CurrentFrame.scopes.clear();
+            s_OpenScopes.clear();
+
+            s_Enabled.store(s_PendingEnabled, std::memory_order_relaxed);
+        }
+
+        void Profiler::beginScope(const char* name)
+        {
+            auto& scope   = s_CurrentFrame.scopes.emplace_back();
+            scope.name    = name;
+            scope.depth   = static_cast<uint32_t>(s_OpenScopes.size());
+            scope.beginNs = getProfileClockNs() - s_FrameBeginNs;
+            s_OpenScopes.push_back(static_cast<uint32_t>(s_CurrentFrame.scopes.size() - 1));
+        }
+
+        void Profiler::endScope()
+        {
+            // Opened before the current frame began
+            if (s_OpenScopes.empty())
+                return;
+
+            s_CurrentFrame.scopes[s_OpenScopes.back()].endNs = getProfileClockNs() - s_FrameBeginNs;
+            s_OpenScopes.pop_back();
+        }
+    } // namespace engine
+} // namespace vultra
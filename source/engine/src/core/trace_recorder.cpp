@@ -0,0 +1,283 @@
+#include "vultra_engine/core/trace_recorder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vultra
+{
+    namespace engine
+    {
+        namespace
+        {
+            constexpr uint32_t TRACE_CHUNK_SIZE = 4096;
+            constexpr size_t   TRACE_FLUSH_SIZE = 64 * 1024;
+
+            struct TraceEvent
+            {
+                const char* name;
+                uint64_t    beginNs;
+                uint64_t    endNs;
+            };
+
+            struct TraceChunk
+            {
+                std::array<TraceEvent, TRACE_CHUNK_SIZE> events;
+                std::atomic<uint32_t>                    count {0};      // Published with release
+                std::atomic<TraceChunk*>                 next {nullptr}; // Published with release
+            };
+
+            // Written by its thread only; readers follow the published chunk links and counts
+            class TraceThreadBuffer
+            {
+            public:
+                TraceThreadBuffer(uint32_t tid, std::string name) :
+                    m_Tid(tid), m_Name(std::move(name)), m_Head(new TraceChunk), m_Tail(m_Head)
+                {}
+
+                ~TraceThreadBuffer()
+                {
+                    for (auto* chunk = m_Head; chunk;)
+                    {
+                        auto* next = chunk->next.load(std::memory_order_relaxed);
+                        delete chunk;
+                        chunk = next;
+                    }
+                }
+
+                TraceThreadBuffer(const TraceThreadBuffer&)            = delete;
+                TraceThreadBuffer& operator=(const TraceThreadBuffer&) = delete;
+
+                void push(const char* name, uint64_t beginNs, uint64_t endNs)
+                {
+                    uint32_t count = m_Tail->count.load(std::memory_order_relaxed);
+                    if (count == TRACE_CHUNK_SIZE)
+                    {
+                        if (m_EventCount >= TraceRecorder::MAX_EVENTS_PER_THREAD)
+                        {
+                            m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                            return;
+                        }
+
+                        auto* chunk = new TraceChunk;
+                        m_Tail->next.store(chunk, std::memory_order_release);
+                        m_Tail = chunk;
+                        count  = 0;
+                    }
+
+                    m_Tail->events[count] = {name, beginNs, endNs};
+                    m_Tail->count.store(count + 1, std::memory_order_release);
+                    m_EventCount++;
+                }
+
+                template<typename Fn>
+                void forEach(Fn&& fn) const
+                {
+                    for (const auto* chunk = m_Head; chunk; chunk = chunk->next.load(std::memory_order_acquire))
+                    {
+                        const uint32_t count = chunk->count.load(std::memory_order_acquire);
+                        for (uint32_t i = 0; i < count; i++)
+                            fn(chunk->events[i]);
+                    }
+                }
+
+                [[nodiscard]] uint64_t getEventCount() const
+                {
+                    uint64_t eventCount = 0;
+                    for (const auto* chunk = m_Head; chunk; chunk = chunk->next.load(std::memory_order_acquire))
+                        eventCount += chunk->count.load(std::memory_order_acquire);
+                    return eventCount;
+                }
+
+                [[nodiscard]] uint32_t getTid() const { return m_Tid; }
+                [[nodiscard]] uint64_t getDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+                // Guarded by s_Mutex
+                std::string& getName() { return m_Name; }
+
+            private:
+                uint32_t    m_Tid;
+                std::string m_Name;
+
+                TraceChunk* m_Head;
+                TraceChunk* m_Tail;           // Writer only
+                uint64_t    m_EventCount {0}; // Writer only
+
+                std::atomic<uint64_t> m_Dropped {0};
+            };
+
+            // A new capture swaps in a fresh buffer list. Threads hold a reference to their buffer, so one still
+            // writing into the previous capture never touches freed memory.
+            std::mutex                                      s_Mutex;
+            std::vector<std::shared_ptr<TraceThreadBuffer>> s_Buffers;
+            std::atomic<uint64_t>                           s_Capture {0};
+            uint64_t                                        s_CaptureStartNs = 0;
+
+            struct ThreadState
+            {
+                std::shared_ptr<TraceThreadBuffer> buffer;
+                uint64_t                           capture {0};
+                std::string                        name;
+            };
+            thread_local ThreadState t_State;
+
+            TraceThreadBuffer* acquireThreadBuffer()
+            {
+                const uint64_t capture = s_Capture.load(std::memory_order_acquire);
+                if (t_State.capture == capture)
+                    return t_State.buffer.get();
+
+                std::lock_guard lock(s_Mutex);
+                t_State.capture = capture;
+                t_State.buffer.reset();
+                if (capture == s_Capture.load(std::memory_order_relaxed))
+                {
+                    const auto tid  = static_cast<uint32_t>(s_Buffers.size() + 1);
+                    auto       name = t_State.name.empty() ? std::format("Thread {}", tid) : t_State.name;
+
+                    t_State.buffer = std::make_shared<TraceThreadBuffer>(tid, std::move(name));
+                    s_Buffers.push_back(t_State.buffer);
+                }
+                return t_State.buffer.get();
+            }
+
+            void appendEscaped(std::string& out, const char* text)
+            {
+                for (const char* c = text; *c; c++)
+                {
+                    switch (*c)
+                    {
+                        case '"':
+                            out += "\\\"";
+                            break;
+                        case '\\':
+                            out += "\\\\";
+                            break;
+                        default:
+                            if (static_cast<unsigned char>(*c) < 0x20)
+                                out += std::format("\\u{:04x}", static_cast<unsigned char>(*c));
+                            else
+                                out += *c;
+                            break;
+                    }
+                }
+            }
+        } // namespace
+
+        void TraceRecorder::start()
+        {
+            {
+                std::lock_guard lock(s_Mutex);
+                s_Buffers.clear();
+                s_CaptureStartNs = getProfileClockNs();
+                s_Capture.fetch_add(1, std::memory_order_release);
+            }
+            s_IsRecording.store(true, std::memory_order_relaxed);
+        }
+
+        void TraceRecorder::stop() { s_IsRecording.store(false, std::memory_order_relaxed); }
+
+        void TraceRecorder::setThreadName(const std::string& name)
+        {
+            t_State.name = name;
+
+            std::lock_guard lock(s_Mutex);
+            if (t_State.buffer && t_State.capture == s_Capture.load(std::memory_order_relaxed))
+                t_State.buffer->getName() = name;
+        }
+
+        void TraceRecorder::record(const char* name, uint64_t beginNs, uint64_t endNs)
+        {
+            if (auto* buffer = acquireThreadBuffer())
+                buffer->push(name, beginNs, endNs);
+        }
+
+        bool TraceRecorder::writeChromeTrace(const std::filesystem::path& filePath)
+        {
+            std::vector<std::shared_ptr<TraceThreadBuffer>> buffers;
+            std::vector<std::string>                        threadNames;
+            uint64_t                                        startNs = 0;
+            {
+                std::lock_guard lock(s_Mutex);
+                buffers = s_Buffers;
+                for (const auto& buffer : buffers)
+                    threadNames.push_back(buffer->getName());
+                startNs = s_CaptureStartNs;
+            }
+
+            std::ofstream out(filePath, std::ios::trunc);
+            if (!out.is_open())
+                return false;
+
+            // Written in pieces so a long capture never needs the whole document in memory
+            std::string text       = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+            bool        isFirst    = true;
+            auto        beginEvent = [&]() {
+                if (!isFirst)
+                    text += ",\n";
+                isFirst = false;
+            };
+            auto flush = [&]() {
+                out.write(text.data(), static_cast<std::streamsize>(text.size()));
+                text.clear();
+            };
+
+            for (size_t i = 0; i < buffers.size(); i++)
+            {
+                beginEvent();
+                text += std::format(
+                    "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"",
+                    buffers[i]->getTid());
+                appendEscaped(text, threadNames[i].c_str());
+                text += "\"}}";
+            }
+
+            for (const auto& buffer : buffers)
+            {
+                buffer->forEach([&](const TraceEvent& event) {
+                    // Scopes opened just before the capture started are clipped to its start
+                    const uint64_t beginNs = std::max(event.beginNs, startNs);
+                    const uint64_t endNs   = std::max(event.endNs, beginNs);
+
+                    beginEvent();
+                    text += "{\"name\":\"";
+                    appendEscaped(text, event.name);
+                    text += std::format("\",\"cat\":\"vultra\",\"ph\":\"X\",\"pid\":1,\"tid\":{},"
+                                        "\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                                        buffer->getTid(),
+                                        static_cast<double>(beginNs - startNs) / 1e3,
+                                        static_cast<double>(endNs - beginNs) / 1e3);
+
+                    if (text.size() > TRACE_FLUSH_SIZE)
+                        flush();
+                });
+            }
+
+            text += "\n]}\n";
+            flush();
+            return out.good();
+        }
+
+        TraceCaptureStats TraceRecorder::getStats()
+        {
+            std::vector<std::shared_ptr<TraceThreadBuffer>> buffers;
+            {
+                std::lock_guard lock(s_Mutex);
+                buffers = s_Buffers;
+            }
+
+            TraceCaptureStats stats {};
+            stats.threadCount = static_cast<uint32_t>(buffers.size());
+            for (const auto& buffer : buffers)
+            {
+                stats.eventCount += buffer->getEventCount();
+                stats.droppedCount += buffer->getDroppedCount();
+            }
+            return stats;
+        }
+    } // namespace engine
+} // namespace vultra
@@ -0,0 +1,29 @@
+#include "vultra_engine/scene/entity_bounds.hpp"
+
+#include <vultra/function/scenegraph/components.hpp>
+
+#include <cfloat>
+
+namespace vultra
+{
+    namespace engine
+    {
+        std::optional<EntityBounds> getEntityLocalBounds(Entity& entity)
+        {
+            if (!entity.hasComponent<RawMeshComponent>())
+                return std::nullopt;
+
+            const auto& mesh = entity.getComponent<RawMeshComponent>().mesh;
+            if (!mesh || mesh->vertices.empty())
+                return std::nullopt;
+
+            EntityBounds bounds {glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX)};
+            for (const auto& vertex : mesh->vertices)
+            {
+                bounds.min = glm::min(bounds.min, vertex.position);
+                bounds.max = glm::max(bounds.max, vertex.position);
+            }
+            return bounds;
+        }
+    } // namespace engine
+} // namespace vultra
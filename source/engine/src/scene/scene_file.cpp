@@ -0,0 +1,1199 @@
+#include "vultra_engine/scene/scene_file.hpp"
+
+#include <vultra/core/base/common_context.hpp>
+#include <vultra/function/scenegraph/components.hpp>
+#include <vultra/function/scenegraph/logic_scene.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+namespace vultra
+{
+    namespace engine
+    {
+        constexpr uint32_t SCENE_MAGIC            = 0x4E435356; // "VSCN"
+        constexpr uint32_t SCENE_DIRECTORY_MAGIC  = 0x52494456; // "VDIR"
+        constexpr uint32_t SCENE_VERSION          = 1;
+        constexpr uint32_t SCENE_NO_PARENT        = UINT32_MAX;
+        constexpr uint32_t SCENE_MAX_COLUMNS      = 64;
+        constexpr size_t   SCENE_COLUMN_ALIGNMENT = 16;
+
+        // Columns are only ever appended to a chunk type, so a reader ignores the ones it does not know and uses
+        // defaults for the ones an older file lacks
+        enum class SceneChunkType : uint32_t
+        {
+            eStrings           = 0x53525453, // "STRS": the block's strings, one column of bytes
+            eEntities          = 0x53544E45, // "ENTS": parent, name, saved UUID, flags
+            eTransforms        = 0x4D465254, // "TRFM": entity, position, rotation (euler), scale
+            eCameras           = 0x524D4143, // "CAMR": entity, clear flags, far plane, environment map, is main camera
+            eMeshes            = 0x4853454D, // "MESH": entity, mesh path
+            eDirectionalLights = 0x54494C44, // "DLIT": entity, direction, color, intensity
+            ePointLights       = 0x54494C50, // "PLIT": entity, color, intensity, radius
+            eAreaLights        = 0x54494C41, // "ALIT": entity, color, intensity, width, height
+        };
+
+        // All offsets are from the start of the file; the layout is native endian
+        struct SceneFileHeader
+        {
+            uint32_t magic {SCENE_MAGIC};
+            uint32_t version {SCENE_VERSION};
+            uint32_t entityCount {0};
+            uint32_t blockSize {SCENE_BLOCK_SIZE};
+            uint64_t directoryOffset {0};
+            uint64_t directorySize {0};
+        };
+
+        // Followed by the byte size of every column (uint32 each) and the columns, both 16-byte aligned
+        struct SceneChunkHeader
+        {
+            uint32_t type {0};
+            uint32_t version {SCENE_VERSION};
+            uint32_t blockIndex {0};
+            uint32_t rowCount {0};
+            uint32_t columnCount {0};
+            uint32_t reserved {0};
+            uint64_t payloadSize {0};
+        };
+
+        // Followed by the SceneChunkInfo entries
+        struct SceneDirectoryHeader
+        {
+            uint32_t magic {SCENE_DIRECTORY_MAGIC};
+            uint32_t version {SCENE_VERSION};
+            uint32_t chunkCount {0};
+            uint32_t reserved {0};
+        };
+
+        struct SceneStringRef
+        {
+            uint32_t offset {0};
+            uint32_t length {0};
+        };
+
+        struct SceneVec3
+        {
+            float x {0.0f};
+            float y {0.0f};
+            float z {0.0f};
+        };
+
+        static_assert(sizeof(SceneChunkInfo) == 32, "Directory entry size is part of the file format");
+        static_assert(sizeof(SceneChunkHeader) == 32, "Chunk header size is part of the file format");
+
+        namespace
+        {
+            size_t alignUp(size_t value)
+            {
+                return (value + SCENE_COLUMN_ALIGNMENT - 1) & ~(SCENE_COLUMN_ALIGNMENT - 1);
+            }
+
+            uint64_t hashBytes(std::span<const uint8_t> bytes)
+            {
+                // FNV-1a; only compares a chunk with its previous save
+                uint64_t hash = 0xCBF29CE484222325ull;
+                for (const auto byte : bytes)
+                {
+                    hash ^= byte;
+                    hash *= 0x100000001B3ull;
+                }
+                return hash;
+            }
+
+            SceneVec3 toSceneVec3(const glm::vec3& v) { return {v.x, v.y, v.z}; }
+            glm::vec3 toVec3(const SceneVec3& v) { return {v.x, v.y, v.z}; }
+
+            class StringTable
+            {
+            public:
+                SceneStringRef add(const std::string& str)
+                {
+                    auto [it, inserted] = m_Refs.try_emplace(str);
+                    if (inserted)
+                    {
+                        it->second = {static_cast<uint32_t>(m_Data.size()), static_cast<uint32_t>(str.size())};
+                        m_Data += str;
+                    }
+                    return it->second;
+                }
+
+                [[nodiscard]] const std::string& getData() const { return m_Data; }
+
+            private:
+                std::string                                     m_Data;
+                std::unordered_map<std::string, SceneStringRef> m_Refs;
+            };
+
+            class ChunkBuilder
+            {
+            public:
+                ChunkBuilder(SceneChunkType type, uint32_t blockIndex, uint32_t rowCount)
+                {
+                    m_Header.type       = static_cast<uint32_t>(type);
+                    m_Header.blockIndex = blockIndex;
+                    m_Header.rowCount   = rowCount;
+                }
+
+                template<typename T>
+                void addColumn(const std::vector<T>& values)
+                {
+                    static_assert(std::is_trivially_copyable_v<T>);
+                    addColumn(
+                        std::string_view(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T)));
+                }
+
+                void addColumn(std::string_view bytes) { m_Columns.emplace_back(bytes); }
+
+                [[nodiscard]] std::vector<uint8_t> finish()
+                {
+                    size_t payloadSize = alignUp(m_Columns.size() * sizeof(uint32_t));
+                    for (const auto& column : m_Columns)
+                        payloadSize += alignUp(column.size());
+
+                    m_Header.columnCount = static_cast<uint32_t>(m_Columns.size());
+                    m_Header.payloadSize = payloadSize;
+
+                    std::vector<uint8_t> bytes(sizeof(SceneChunkHeader) + payloadSize, 0);
+                    std::memcpy(bytes.data(), &m_Header, sizeof(m_Header));
+
+                    size_t sizeOffset   = sizeof(SceneChunkHeader);
+                    size_t columnOffset = sizeof(SceneChunkHeader) + alignUp(m_Columns.size() * sizeof(uint32_t));
+                    for (const auto& column : m_Columns)
+                    {
+                        const auto columnSize = static_cast<uint32_t>(column.size());
+                        std::memcpy(bytes.data() + sizeOffset, &columnSize, sizeof(columnSize));
+                        std::memcpy(bytes.data() + columnOffset, column.data(), column.size());
+
+                        sizeOffset += sizeof(uint32_t);
+                        columnOffset += alignUp(column.size());
+                    }
+                    return bytes;
+                }
+
+            private:
+                SceneChunkHeader         m_Header;
+                std::vector<std::string> m_Columns;
+            };
+
+            struct ChunkView
+            {
+                SceneChunkHeader                      header;
+                std::vector<std::span<const uint8_t>> columns;
+
+                // Null if the column is missing or too short for the rows
+                template<typename T>
+                [[nodiscard]] const T* column(size_t index) const
+                {
+                    if (index >= columns.size() || columns[index].size() < size_t(header.rowCount) * sizeof(T))
+                        return nullptr;
+                    return reinterpret_cast<const T*>(columns[index].data());
+                }
+            };
+
+            bool parseChunk(const std::vector<uint8_t>& bytes, ChunkView& view)
+            {
+                if (bytes.size() < sizeof(SceneChunkHeader))
+                    return false;
+
+                std::memcpy(&view.header, bytes.data(), sizeof(SceneChunkHeader));
+                const auto& header = view.header;
+                if (header.columnCount > SCENE_MAX_COLUMNS ||
+                    sizeof(SceneChunkHeader) + header.payloadSize != bytes.size())
+                    return false;
+
+                size_t columnOffset = sizeof(SceneChunkHeader) + alignUp(header.columnCount * sizeof(uint32_t));
+                if (columnOffset > bytes.size())
+                    return false;
+
+                view.columns.clear();
+                for (uint32_t i = 0; i < header.columnCount; ++i)
+                {
+                    uint32_t columnSize = 0;
+                    std::memcpy(&columnSize, bytes.data() + sizeof(SceneChunkHeader) + i * sizeof(uint32_t), 4);
+                    if (columnOffset + columnSize > bytes.size())
+                        return false;
+
+                    view.columns.emplace_back(bytes.data() + columnOffset, columnSize);
+                    columnOffset += alignUp(columnSize);
+                }
+                return true;
+            }
+
+            std::string_view getString(const std::string& strings, SceneStringRef ref)
+            {
+                if (uint64_t(ref.offset) + ref.length > strings.size())
+                    return {};
+                return std::string_view(strings).substr(ref.offset, ref.length);
+            }
+
+            bool readDirectory(std::istream&                in,
+                               uint64_t                     fileSize,
+                               SceneFileHeader&             header,
+                               std::vector<SceneChunkInfo>& chunks)
+            {
+                if (!in.seekg(0) || !in.read(reinterpret_cast<char*>(&header), sizeof(header)))
+                    return false;
+
+                if (header.magic != SCENE_MAGIC || header.version != SCENE_VERSION ||
+                    header.blockSize != SCENE_BLOCK_SIZE || header.directoryOffset + header.directorySize > fileSize)
+                    return false;
+
+                SceneDirectoryHeader directoryHeader {};
+                if (!in.seekg(static_cast<std::streamoff>(header.directoryOffset)) ||
+                    !in.read(reinterpret_cast<char*>(&directoryHeader), sizeof(directoryHeader)))
+                    return false;
+
+                const uint64_t directorySize =
+                    sizeof(SceneDirectoryHeader) + uint64_t(directoryHeader.chunkCount) * sizeof(SceneChunkInfo);
+                if (directoryHeader.magic != SCENE_DIRECTORY_MAGIC || directoryHeader.version != SCENE_VERSION ||
+                    directorySize != header.directorySize)
+                    return false;
+
+                chunks.resize(directoryHeader.chunkCount);
+                if (!in.read(reinterpret_cast<char*>(chunks.data()),
+                             static_cast<std::streamsize>(chunks.size() * sizeof(SceneChunkInfo))))
+                    return false;
+
+                return std::all_of(chunks.begin(), chunks.end(), [fileSize](const SceneChunkInfo& chunk) {
+                    return chunk.size >= sizeof(SceneChunkHeader) && chunk.offset + chunk.size <= fileSize;
+                });
+            }
+
+            bool readChunk(std::istream& in, const SceneChunkInfo& chunk, std::vector<uint8_t>& bytes)
+            {
+                bytes.resize(chunk.size);
+                return in.seekg(static_cast<std::streamoff>(chunk.offset)) &&
+                       in.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(chunk.size));
+            }
+
+            void writeDirectory(std::ostream& out, const std::vector<SceneChunkInfo>& chunks)
+            {
+                SceneDirectoryHeader directoryHeader {};
+                directoryHeader.chunkCount = static_cast<uint32_t>(chunks.size());
+                out.write(reinterpret_cast<const char*>(&directoryHeader), sizeof(directoryHeader));
+                out.write(reinterpret_cast<const char*>(chunks.data()),
+                          static_cast<std::streamsize>(chunks.size() * sizeof(SceneChunkInfo)));
+            }
+
+            uint64_t getDirectorySize(const std::vector<SceneChunkInfo>& chunks)
+            {
+                return sizeof(SceneDirectoryHeader) + chunks.size() * sizeof(SceneChunkInfo);
+            }
+
+            struct SavedEntity
+            {
+                Entity   entity;
+                uint32_t parent {SCENE_NO_PARENT};
+                bool     isMainCamera {false};
+            };
+
+            // Name of the first component of an entity that scene files cannot store yet, null if there is none.
+            // Saving such a scene would silently drop it.
+            const char* findUnsupportedComponent(Entity& entity)
+            {
+                if (entity.hasComponent<XrCameraComponent>())
+                    return "XrCameraComponent";
+                return nullptr;
+            }
+
+            std::vector<SavedEntity> collectEntities(LogicScene& scene, const SceneSaveOptions& options)
+            {
+                std::vector<SavedEntity> entities;
+
+                Entity mainCamera = scene.getMainCamera();
+
+                // Depth-first, so a parent is always saved (and loaded) before its children
+                std::function<void(Entity&, uint32_t)> collect = [&](Entity& entity, uint32_t parent) {
+                    if (entity.hasComponent<CameraComponent>() && entity.getComponent<CameraComponent>().isEditorCamera)
+                        return;
+                    if (options.filter && !options.filter(entity))
+                        return;
+
+                    const auto index        = static_cast<uint32_t>(entities.size());
+                    const bool isMainCamera = mainCamera && entity.getCoreUUID() == mainCamera.getCoreUUID();
+                    entities.push_back({entity, parent, isMainCamera});
+
+                    for (auto& child : entity.getChildrenEntities())
+                        collect(child, index);
+                };
+
+                for (auto& root : scene.getRootEntities())
+                    collect(root, SCENE_NO_PARENT);
+
+                return entities;
+            }
+
+            // The block's chunks in load order: strings first, then entities, then components
+            void encodeBlock(std::span<SavedEntity>             entities,
+                             uint32_t                           blockIndex,
+                             std::vector<std::vector<uint8_t>>& outChunks)
+            {
+                const uint32_t base     = blockIndex * SCENE_BLOCK_SIZE;
+                const auto     rowCount = static_cast<uint32_t>(entities.size());
+
+                StringTable strings;
+
+                std::vector<uint32_t>       parents;
+                std::vector<SceneStringRef> names;
+                std::vector<SceneStringRef> uuids;
+                std::vector<uint32_t>       flags;
+
+                std::vector<uint32_t>  transformEntities;
+                std::vector<SceneVec3> positions;
+                std::vector<SceneVec3> rotations;
+                std::vector<SceneVec3> scales;
+
+                std::vector<uint32_t>       cameraEntities;
+                std::vector<uint32_t>       clearFlags;
+                std::vector<float>          zFars;
+                std::vector<SceneStringRef> environmentMaps;
+                std::vector<uint32_t>       mainCameras;
+
+                std::vector<uint32_t>       meshEntities;
+                std::vector<SceneStringRef> meshPaths;
+
+                std::vector<uint32_t>  directionalLightEntities;
+                std::vector<SceneVec3> directionalLightDirections;
+                std::vector<SceneVec3> directionalLightColors;
+                std::vector<float>     directionalLightIntensities;
+
+                std::vector<uint32_t>  pointLightEntities;
+                std::vector<SceneVec3> pointLightColors;
+                std::vector<float>     pointLightIntensities;
+                std::vector<float>     pointLightRadii;
+
+                std::vector<uint32_t>  areaLightEntities;
+                std::vector<SceneVec3> areaLightColors;
+                std::vector<float>     areaLightIntensities;
+                std::vector<float>     areaLightWidths;
+                std::vector<float>     areaLightHeights;
+
+                for (uint32_t row = 0; row < rowCount; ++row)
+                {
+                    auto&          saved = entities[row];
+                    auto&          entity = saved.entity;
+                    const uint32_t index  = base + row;
+
+                    parents.push_back(saved.parent);
+                    names.push_back(strings.add(entity.getName()));
+                    uuids.push_back(strings.add(entity.getCoreUUID().toString()));
+                    flags.push_back(entity.getComponent<EntityFlagsComponent>().flags);
+
+                    if (entity.hasComponent<TransformComponent>())
+                    {
+                        auto& transform = entity.getComponent<TransformComponent>();
+                        transformEntities.push_back(index);
+                        positions.push_back(toSceneVec3(transform.position));
+                        rotations.push_back(toSceneVec3(transform.getRotationEuler()));
+                        scales.push_back(toSceneVec3(transform.scale));
+                    }
+
+                    if (entity.hasComponent<CameraComponent>())
+                    {
+                        auto& camera = entity.getComponent<CameraComponent>();
+                        cameraEntities.push_back(index);
+                        clearFlags.push_back(static_cast<uint32_t>(camera.clearFlags));
+                        zFars.push_back(camera.zFar);
+                        environmentMaps.push_back(strings.add(camera.environmentMapPath));
+                        mainCameras.push_back(saved.isMainCamera ? 1 : 0);
+                    }
+
+                    // The mesh is stored by the path it was loaded from and loaded again from there
+                    if (entity.hasComponent<RawMeshComponent>())
+                    {
+                        meshEntities.push_back(index);
+                        meshPaths.push_back(strings.add(entity.getComponent<RawMeshComponent>().meshPath));
+                    }
+
+                    if (entity.hasComponent<DirectionalLightComponent>())
+                    {
+                        auto& light = entity.getComponent<DirectionalLightComponent>();
+                        directionalLightEntities.push_back(index);
+                        directionalLightDirections.push_back(toSceneVec3(light.direction));
+                        directionalLightColors.push_back(toSceneVec3(light.color));
+                        directionalLightIntensities.push_back(light.intensity);
+                    }
+
+                    if (entity.hasComponent<PointLightComponent>())
+                    {
+                        auto& light = entity.getComponent<PointLightComponent>();
+                        pointLightEntities.push_back(index);
+                        pointLightColors.push_back(toSceneVec3(light.color));
+                        pointLightIntensities.push_back(light.intensity);
+                        pointLightRadii.push_back(light.radius);
+                    }
+
+                    if (entity.hasComponent<AreaLightComponent>())
+                    {
+                        auto& light = entity.getComponent<AreaLightComponent>();
+                        areaLightEntities.push_back(index);
+                        areaLightColors.push_back(toSceneVec3(light.color));
+                        areaLightIntensities.push_back(light.intensity);
+                        areaLightWidths.push_back(light.width);
+                        areaLightHeights.push_back(light.height);
+                    }
+                }
+
+                ChunkBuilder stringChunk(SceneChunkType::eStrings, blockIndex, 0);
+                stringChunk.addColumn(strings.getData());
+                outChunks.push_back(stringChunk.finish());
+
+                ChunkBuilder entityChunk(SceneChunkType::eEntities, blockIndex, rowCount);
+                entityChunk.addColumn(parents);
+                entityChunk.addColumn(names);
+                entityChunk.addColumn(uuids);
+                entityChunk.addColumn(flags);
+                outChunks.push_back(entityChunk.finish());
+
+                if (!transformEntities.empty())
+                {
+                    ChunkBuilder transformChunk(
+                        SceneChunkType::eTransforms, blockIndex, static_cast<uint32_t>(transformEntities.size()));
+                    transformChunk.addColumn(transformEntities);
+                    transformChunk.addColumn(positions);
+                    transformChunk.addColumn(rotations);
+                    transformChunk.addColumn(scales);
+                    outChunks.push_back(transformChunk.finish());
+                }
+
+                if (!cameraEntities.empty())
+                {
+                    ChunkBuilder cameraChunk(
+                        SceneChunkType::eCameras, blockIndex, static_cast<uint32_t>(cameraEntities.size()));
+                    cameraChunk.addColumn(cameraEntities);
+                    cameraChunk.addColumn(clearFlags);
+                    cameraChunk.addColumn(zFars);
+                    cameraChunk.addColumn(environmentMaps);
+                    cameraChunk.addColumn(mainCameras);
+                    outChunks.push_back(cameraChunk.finish());
+                }
+
+                if (!meshEntities.empty())
+                {
+                    ChunkBuilder meshChunk(
+                        SceneChunkType::eMeshes, blockIndex, static_cast<uint32_t>(meshEntities.size()));
+                    meshChunk.addColumn(meshEntities);
+                    meshChunk.addColumn(meshPaths);
+                    outChunks.push_back(meshChunk.finish());
+                }
+
+                if (!directionalLightEntities.empty())
+                {
+                    ChunkBuilder lightChunk(SceneChunkType::eDirectionalLights,
+                                            blockIndex,
+                                            static_cast<uint32_t>(directionalLightEntities.size()));
+                    lightChunk.addColumn(directionalLightEntities);
+                    lightChunk.addColumn(directionalLightDirections);
+                    lightChunk.addColumn(directionalLightColors);
+                    lightChunk.addColumn(directionalLightIntensities);
+                    outChunks.push_back(lightChunk.finish());
+                }
+
+                if (!pointLightEntities.empty())
+                {
+                    ChunkBuilder lightChunk(
+                        SceneChunkType::ePointLights, blockIndex, static_cast<uint32_t>(pointLightEntities.size()));
+                    lightChunk.addColumn(pointLightEntities);
+                    lightChunk.addColumn(pointLightColors);
+                    lightChunk.addColumn(pointLightIntensities);
+                    lightChunk.addColumn(pointLightRadii);
+                    outChunks.push_back(lightChunk.finish());
+                }
+
+                if (!areaLightEntities.empty())
+                {
+                    ChunkBuilder lightChunk(
+                        SceneChunkType::eAreaLights, blockIndex, static_cast<uint32_t>(areaLightEntities.size()));
+                    lightChunk.addColumn(areaLightEntities);
+                    lightChunk.addColumn(areaLightColors);
+                    lightChunk.addColumn(areaLightIntensities);
+                    lightChunk.addColumn(areaLightWidths);
+                    lightChunk.addColumn(areaLightHeights);
+                    outChunks.push_back(lightChunk.finish());
+                }
+            }
+
+            bool saveFull(const std::filesystem::path&             filePath,
+                          const std::vector<std::vector<uint8_t>>& chunks,
+                          std::vector<SceneChunkInfo>&             infos,
+                          uint32_t                                 entityCount,
+                          SceneSaveStats&                          stats)
+            {
+                uint64_t offset = sizeof(SceneFileHeader);
+                for (size_t i = 0; i < chunks.size(); ++i)
+                {
+                    infos[i].offset = offset;
+                    offset += chunks[i].size();
+                }
+
+                SceneFileHeader header {};
+                header.entityCount     = entityCount;
+                header.directoryOffset = offset;
+                header.directorySize   = getDirectorySize(infos);
+
+                // Write next to the target and swap it in, so a crash never leaves a half-written scene behind
+                auto tmpPath = filePath;
+                tmpPath += ".tmp";
+                {
+                    std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+                    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                    for (const auto& chunk : chunks)
+                    {
+                        out.write(reinterpret_cast<const char*>(chunk.data()),
+                                  static_cast<std::streamsize>(chunk.size()));
+                    }
+                    writeDirectory(out, infos);
+                    if (!out.good())
+                    {
+                        VULTRA_CORE_ERROR("Failed to write scene: {}", tmpPath.generic_string());
+                        return false;
+                    }
+                }
+
+                std::error_code ec;
+                std::filesystem::rename(tmpPath, filePath, ec);
+                if (ec)
+                {
+                    VULTRA_CORE_ERROR("Failed to replace scene {}: {}", filePath.generic_string(), ec.message());
+                    std::filesystem::remove(tmpPath, ec);
+                    return false;
+                }
+
+                stats.isFullWrite       = true;
+                stats.writtenChunkCount = static_cast<uint32_t>(chunks.size());
+                stats.writtenBytes      = offset + header.directorySize;
+                return true;
+            }
+
+            // False if the file cannot be updated in place or is due for compaction; nothing is written then
+            bool saveIncremental(const std::filesystem::path&             filePath,
+                                 const std::vector<std::vector<uint8_t>>& chunks,
+                                 std::vector<SceneChunkInfo>&             infos,
+                                 uint32_t                                 entityCount,
+                                 SceneSaveStats&                          stats)
+            {
+                std::error_code ec;
+                const auto      fileSize = std::filesystem::file_size(filePath, ec);
+                if (ec)
+                    return false;
+
+                std::fstream file(filePath, std::ios::binary | std::ios::in | std::ios::out);
+                if (!file.is_open())
+                    return false;
+
+                SceneFileHeader             header {};
+                std::vector<SceneChunkInfo> previousChunks;
+                if (!readDirectory(file, fileSize, header, previousChunks))
+                    return false;
+
+                std::unordered_map<uint64_t, const SceneChunkInfo*> previousByKey;
+                for (const auto& chunk : previousChunks)
+                    previousByKey[(uint64_t(chunk.type) << 32) | chunk.blockIndex] = &chunk;
+
+                // Unchanged chunks keep their place in the file
+                std::vector<size_t> changed;
+                uint64_t            liveBytes = 0;
+                for (size_t i = 0; i < infos.size(); ++i)
+                {
+                    auto it = previousByKey.find((uint64_t(infos[i].type) << 32) | infos[i].blockIndex);
+                    if (it != previousByKey.end() && it->second->hash == infos[i].hash &&
+                        it->second->size == infos[i].size)
+                        infos[i].offset = it->second->offset;
+                    else
+                        changed.push_back(i);
+
+                    liveBytes += infos[i].size;
+                }
+
+                uint64_t appendedBytes = getDirectorySize(infos);
+                for (const auto i : changed)
+                    appendedBytes += infos[i].size;
+
+                const uint64_t deadBytes =
+                    fileSize + appendedBytes - sizeof(SceneFileHeader) - liveBytes - getDirectorySize(infos);
+                if (deadBytes > liveBytes)
+                    return false;
+
+                file.clear();
+                file.seekp(static_cast<std::streamoff>(fileSize));
+
+                uint64_t offset = fileSize;
+                for (const auto i : changed)
+                {
+                    infos[i].offset = offset;
+                    file.write(reinterpret_cast<const char*>(chunks[i].data()),
+                               static_cast<std::streamsize>(chunks[i].size()));
+                    offset += chunks[i].size();
+                }
+                writeDirectory(file, infos);
+                file.flush();
+                if (!file.good())
+                {
+                    VULTRA_CORE_ERROR("Failed to append to scene: {}", filePath.generic_string());
+                    return false;
+                }
+
+                // The old directory stays valid until the header points at the new one
+                header.entityCount     = entityCount;
+                header.directoryOffset = offset;
+                header.directorySize   = getDirectorySize(infos);
+                file.seekp(0);
+                file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                file.flush();
+                if (!file.good())
+                {
+                    VULTRA_CORE_ERROR("Failed to update scene header: {}", filePath.generic_string());
+                    return false;
+                }
+
+                stats.isFullWrite       = false;
+                stats.writtenChunkCount = static_cast<uint32_t>(changed.size());
+                stats.writtenBytes      = appendedBytes + sizeof(SceneFileHeader);
+                return true;
+            }
+        } // namespace
+
+        bool saveScene(const std::filesystem::path& filePath,
+                       LogicScene&                  scene,
+                       const SceneSaveOptions&      options,
+                       SceneSaveStats*              stats)
+        {
+            auto entities = collectEntities(scene, options);
+
+            // Refuse rather than write a file that loads back as a different scene
+            for (auto& saved : entities)
+            {
+                if (const char* component = findUnsupportedComponent(saved.entity))
+                {
+                    VULTRA_CORE_ERROR("Cannot save scene {}: entity '{}' has a {}, which scene files do not store yet",
+                                      filePath.generic_string(),
+                                      saved.entity.getName(),
+                                      component);
+                    return false;
+                }
+            }
+
+            std::vector<std::vector<uint8_t>> chunks;
+            for (size_t base = 0; base < entities.size(); base += SCENE_BLOCK_SIZE)
+            {
+                const size_t count = std::min<size_t>(SCENE_BLOCK_SIZE, entities.size() - base);
+                encodeBlock(
+                    std::span(entities).subspan(base, count), static_cast<uint32_t>(base / SCENE_BLOCK_SIZE), chunks);
+            }
+
+            std::vector<SceneChunkInfo> infos(chunks.size());
+            for (size_t i = 0; i < chunks.size(); ++i)
+            {
+                SceneChunkHeader chunkHeader {};
+                std::memcpy(&chunkHeader, chunks[i].data(), sizeof(chunkHeader));
+
+                infos[i].type       = chunkHeader.type;
+                infos[i].blockIndex = chunkHeader.blockIndex;
+                infos[i].size       = chunks[i].size();
+                infos[i].hash       = hashBytes(chunks[i]);
+            }
+
+            SceneSaveStats localStats;
+            localStats.entityCount = static_cast<uint32_t>(entities.size());
+            localStats.chunkCount  = static_cast<uint32_t>(chunks.size());
+
+            const auto entityCount = static_cast<uint32_t>(entities.size());
+            const bool saved =
+                (!options.forceFullWrite && saveIncremental(filePath, chunks, infos, entityCount, localStats)) ||
+                saveFull(filePath, chunks, infos, entityCount, localStats);
+
+            if (saved && stats)
+                *stats = localStats;
+            return saved;
+        }
+
+        SceneLoader::~SceneLoader() { close(); }
+
+        bool SceneLoader::open(const std::filesystem::path& filePath, LogicScene& scene)
+        {
+            close();
+            m_FilePath = filePath;
+
+            std::error_code ec;
+            const auto      fileSize = std::filesystem::file_size(filePath, ec);
+            if (ec)
+                return false;
+
+            m_File.open(filePath, std::ios::binary);
+            if (!m_File.is_open())
+                return false;
+
+            SceneFileHeader header {};
+            if (!readDirectory(m_File, fileSize, header, m_Chunks))
+            {
+                VULTRA_CORE_WARN("Ignoring invalid scene file: {}", filePath.generic_string());
+                close();
+                return false;
+            }
+
+            m_Scene       = &scene;
+            m_EntityCount = header.entityCount;
+            m_Entities.reserve(m_EntityCount);
+            m_UUIDRemap.reserve(m_EntityCount);
+            return true;
+        }
+
+        void SceneLoader::close()
+        {
+            m_File.close();
+            m_File.clear();
+            m_Scene = nullptr;
+            m_Chunks.clear();
+            m_NextChunk   = 0;
+            m_EntityCount = 0;
+            m_HasFailed   = false;
+            m_Buffer.clear();
+            m_Strings.clear();
+            m_Entities.clear();
+            m_UUIDRemap.clear();
+        }
+
+        bool SceneLoader::loadNextChunk()
+        {
+            if (!isOpen() || m_HasFailed || isDone())
+                return false;
+
+            const auto& chunk = m_Chunks[m_NextChunk++];
+
+            ChunkView view;
+            if (!readChunk(m_File, chunk, m_Buffer) || !parseChunk(m_Buffer, view))
+                return fail("truncated chunk");
+
+            const uint32_t base     = chunk.blockIndex * SCENE_BLOCK_SIZE;
+            const uint32_t rowCount = view.header.rowCount;
+
+            switch (static_cast<SceneChunkType>(chunk.type))
+            {
+                case SceneChunkType::eStrings:
+                    m_Strings.clear();
+                    if (!view.columns.empty())
+                        m_Strings.assign(reinterpret_cast<const char*>(view.columns[0].data()), view.columns[0].size());
+                    break;
+
+                case SceneChunkType::eEntities: {
+                    const auto* parents = view.column<uint32_t>(0);
+                    const auto* names   = view.column<SceneStringRef>(1);
+                    const auto* uuids   = view.column<SceneStringRef>(2);
+                    const auto* flags   = view.column<uint32_t>(3);
+                    if (!parents || !names || base != m_Entities.size())
+                        return fail("malformed entity chunk");
+
+                    for (uint32_t row = 0; row < rowCount; ++row)
+                    {
+                        Entity entity = m_Scene->createEntity(std::string(getString(m_Strings, names[row])));
+                        if (flags)
+                            entity.getComponent<EntityFlagsComponent>().flags = flags[row];
+
+                        // Parents come first, anything else is treated as a root
+                        if (parents[row] < m_Entities.size())
+                            entity.setParent(m_Entities[parents[row]].getCoreUUID());
+
+                        if (uuids)
+                            m_UUIDRemap.emplace(getString(m_Strings, uuids[row]), entity.getCoreUUID());
+
+                        m_Entities.push_back(entity);
+                    }
+                    break;
+                }
+
+                case SceneChunkType::eTransforms: {
+                    const auto* entities  = view.column<uint32_t>(0);
+                    const auto* positions = view.column<SceneVec3>(1);
+                    const auto* rotations = view.column<SceneVec3>(2);
+                    const auto* scales    = view.column<SceneVec3>(3);
+                    if (!entities)
+                        return fail("malformed transform chunk");
+
+                    for (uint32_t row = 0; row < rowCount; ++row)
+                    {
+                        if (entities[row] >= m_Entities.size())
+                            continue;
+
+                        auto& entity    = m_Entities[entities[row]];
+                        auto& transform = entity.hasComponent<TransformComponent>() ?
+                                              entity.getComponent<TransformComponent>() :
+                                              entity.addComponent<TransformComponent>();
+                        if (positions)
+                            transform.position = toVec3(positions[row]);
+                        if (rotations)
+                            transform.setRotationEuler(toVec3(rotations[row]));
+                        if (scales)
+                            transform.scale = toVec3(scales[row]);
+                    }
+                    break;
+                }
+
+                case SceneChunkType::eCameras: {
+                    const auto* entities        = view.column<uint32_t>(0);
+                    const auto* clearFlags      = view.column<uint32_t>(1);
+                    const auto* zFars           = view.column<float>(2);
+                    const auto* environmentMaps = view.column<SceneStringRef>(3);
+                    const auto* mainCameras     = view.column<uint32_t>(4);
+                    if (!entities)
+                        return fail("malformed camera chunk");
+
+                    for (uint32_t row = 0; row < rowCount; ++row)
+                    {
+                        if (entities[row] >= m_Entities.size())
+                            continue;
+
+                        auto& entity = m_Entities[entities[row]];
+                        auto& camera = entity.hasComponent<CameraComponent>() ? entity.getComponent<CameraComponent>() :
+                                                                                 entity.addComponent<CameraComponent>();
+                        if (clearFlags)
+                            camera.clearFlags = static_cast<CameraClearFlags>(clearFlags[row]);
+                        if (zFars)
+                            camera.zFar = zFars[row];
+                        if (environmentMaps)
+                            camera.environmentMapPath = std::string(getString(m_Strings, environmentMaps[row]));
+                        if (mainCameras && mainCameras[row] != 0)
+                            m_Scene->setMainCamera(entity);
+                    }
+                    break;
+                }
+
+                case SceneChunkType::eMeshes: {
+                    const auto* entities = view.column<uint32_t>(0);
+                    const auto* paths    = view.column<SceneStringRef>(1);
+                    if (!entities || !paths)
+                        return fail("malformed mesh chunk");
+
+                    for (uint32_t row = 0; row < rowCount; ++row)
+                    {
+                        const auto path = getString(m_Strings, paths[row]);
+                        if (entities[row] >= m_Entities.size() || path.empty())
+                            continue;
+
+                        // The scene loads meshes only through createRawMeshEntity; take the component over from a
+                        // scratch entity instead of loading the mesh by hand
+                        Entity meshSource = m_Scene->createRawMeshEntity("", std::string(path));
+                        auto&  entity     = m_Entities[entities[row]];
+                        if (entity.hasComponent<RawMeshComponent>())
+                            entity.removeComponent<RawMeshComponent>();
+                        entity.addComponent<RawMeshComponent>(std::move(meshSource.getComponent<RawMeshComponent>()));
+                        m_Scene->destroyEntity(meshSource);
+                    }
+                    break;
+                }
+
+                case SceneChunkType::eDirectionalLights: {
+                    const auto* entities    = view.column<uint32_t>(0);
+                    const auto* directions  = view.column<SceneVec3>(1);
+                    const auto* colors      = view.column<SceneVec3>(2);
+                    const auto* intensities = view.column<float>(3);
+                    if (!entities)
+                        return fail("malformed directional light chunk");
+
+                    for (uint32_t row = 0; row < rowCount; ++row)
+                    {
+                        if (entities[row] >= m_Entities.size())
+                            continue;
+
+                        auto& entity = m_Entities[entities[row]];
+                        auto& light  = entity.hasComponent<DirectionalLightComponent>() ?
+                                           entity.getComponent<DirectionalLightComponent>() :
+                                           entity.addComponent<DirectionalLightComponent>();
+                        if (directions)
+                            light.direction = toVec3(directions[row]);
+                        if (colors)
+                            light.color = toVec3(colors[row]);
+                        if (intensities)
+                            light.intensity = intensities[row];
+                    }
+                    break;
+                }
+
+                case SceneChunkType::ePointLights: {
+                    const auto* entities    = view.column<uint32_t>(0);
+                    const auto* colors      = view.column<SceneVec3>(1);
+                    const auto* intensities = view.column<float>(2);
+                    const auto* radii       = view.column<float>(3);
+                    if (!entities)
+                        return fail("malformed point light chunk");
+
+                    for (uint32_t row = 0; row < rowCount; ++row)
+                    {
+                        if (entities[row] >= m_Entities.size())
+                            continue;
+
+                        auto& entity = m_Entities[entities[row]];
+                        auto& light  = entity.hasComponent<PointLightComponent>() ?
+                                           entity.getComponent<PointLightComponent>() :
+                                           entity.addComponent<PointLightComponent>();
+                        if (colors)
+                            light.color = toVec3(colors[row]);
+                        if (intensities)
+                            light.intensity = intensities[row];
+                        if (radii)
+                            light.radius = radii[row];
+                    }
+                    break;
+                }
+
+                case SceneChunkType::eAreaLights: {
+                    const auto* entities    = view.column<uint32_t>(0);
+                    const auto* colors      = view.column<SceneVec3>(1);
+                    const auto* intensities = view.column<float>(2);
+                    const auto* widths      = view.column<float>(3);
+                    const auto* heights     = view.column<float>(4);
+                    if (!entities)
+                        return fail("malformed area light chunk");
+
+                    for (uint32_t row = 0; row < rowCount; ++row)
+                    {
+                        if (entities[row] >= m_Entities.size())
+                            continue;
+
+                        auto& entity = m_Entities[entities[row]];
+                        auto& light  = entity.hasComponent<AreaLightComponent>() ?
+                                           entity.getComponent<AreaLightComponent>() :
+                                           entity.addComponent<AreaLightComponent>();
+                        if (colors)
+                            light.color = toVec3(colors[row]);
+                        if (intensities)
+                            light.intensity = intensities[row];
+                        if (widths)
+                            light.width = widths[row];
+                        if (heights)
+                            light.height = heights[row];
+                    }
+                    break;
+                }
+
+                default:
+                    // Chunk type from a newer version
+                    break;
+            }
+
+            return !isDone();
+        }
+
+        bool SceneLoader::loadFor(std::chrono::microseconds budget)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            while (loadNextChunk())
+            {
+                if (std::chrono::steady_clock::now() - start >= budget)
+                    break;
+            }
+            return isDone() && !m_HasFailed;
+        }
+
+        float SceneLoader::getProgress() const
+        {
+            if (m_Chunks.empty())
+                return 1.0f;
+            return static_cast<float>(m_NextChunk) / static_cast<float>(m_Chunks.size());
+        }
+
+        bool SceneLoader::fail(const char* reason)
+        {
+            VULTRA_CORE_ERROR("Failed to load scene {}: {}", m_FilePath.generic_string(), reason);
+            m_HasFailed = true;
+            return false;
+        }
+
+        bool loadScene(const std::filesystem::path& filePath, LogicScene& scene)
+        {
+            SceneLoader loader;
+            if (!loader.open(filePath, scene))
+                return false;
+
+            while (loader.loadNextChunk()) {}
+            return !loader.hasFailed();
+        }
+
+        bool exportSceneJson(const std::filesystem::path& filePath, const std::filesystem::path& jsonPath)
+        {
+            std::error_code ec;
+            const auto      fileSize = std::filesystem::file_size(filePath, ec);
+            if (ec)
+                return false;
+
+            std::ifstream               in(filePath, std::ios::binary);
+            SceneFileHeader             header {};
+            std::vector<SceneChunkInfo> chunks;
+            if (!in.is_open() || !readDirectory(in, fileSize, header, chunks))
+            {
+                VULTRA_CORE_ERROR("Failed to read scene: {}", filePath.generic_string());
+                return false;
+            }
+
+            auto toJson = [](const SceneVec3& v) { return nlohmann::ordered_json::array({v.x, v.y, v.z}); };
+
+            nlohmann::ordered_json entities = nlohmann::ordered_json::array();
+            std::vector<uint8_t>   bytes;
+            std::string            strings;
+            ChunkView              view;
+            for (const auto& chunk : chunks)
+            {
+                if (!readChunk(in, chunk, bytes) || !parseChunk(bytes, view))
+                {
+                    VULTRA_CORE_ERROR("Failed to read scene: {}", filePath.generic_string());
+                    return false;
+                }
+
+                const uint32_t rowCount = view.header.rowCount;
+                switch (static_cast<SceneChunkType>(chunk.type))
+                {
+                    case SceneChunkType::eStrings:
+                        strings.clear();
+                        if (!view.columns.empty())
+                            strings.assign(reinterpret_cast<const char*>(view.columns[0].data()),
+                                           view.columns[0].size());
+                        break;
+
+                    case SceneChunkType::eEntities: {
+                        const auto* parents = view.column<uint32_t>(0);
+                        const auto* names   = view.column<SceneStringRef>(1);
+                        const auto* uuids   = view.column<SceneStringRef>(2);
+                        const auto* flags   = view.column<uint32_t>(3);
+                        for (uint32_t row = 0; parents && names && uuids && flags && row < rowCount; ++row)
+                        {
+                            nlohmann::ordered_json entity;
+                            entity["uuid"]   = std::string(getString(strings, uuids[row]));
+                            entity["name"]   = std::string(getString(strings, names[row]));
+                            entity["parent"] = parents[row] == SCENE_NO_PARENT ? nlohmann::ordered_json(nullptr) :
+                                                                                 nlohmann::ordered_json(parents[row]);
+                            entity["flags"]  = flags[row];
+                            entities.push_back(std::move(entity));
+                        }
+                        break;
+                    }
+
+                    case SceneChunkType::eTransforms: {
+                        const auto* indices   = view.column<uint32_t>(0);
+                        const auto* positions = view.column<SceneVec3>(1);
+                        const auto* rotations = view.column<SceneVec3>(2);
+                        const auto* scales    = view.column<SceneVec3>(3);
+                        for (uint32_t row = 0; indices && positions && rotations && scales && row < rowCount; ++row)
+                        {
+                            if (indices[row] < entities.size())
+                            {
+                                entities[indices[row]]["transform"] = {{"position", toJson(positions[row])},
+                                                                       {"rotation", toJson(rotations[row])},
+                                                                       {"scale", toJson(scales[row])}};
+                            }
+                        }
+                        break;
+                    }
+
+                    case SceneChunkType::eCameras: {
+                        const auto* indices         = view.column<uint32_t>(0);
+                        const auto* clearFlags      = view.column<uint32_t>(1);
+                        const auto* zFars           = view.column<float>(2);
+                        const auto* environmentMaps = view.column<SceneStringRef>(3);
+                        const auto* mainCameras     = view.column<uint32_t>(4);
+                        const bool isComplete = indices && clearFlags && zFars && environmentMaps;
+                        for (uint32_t row = 0; isComplete && row < rowCount; ++row)
+                        {
+                            if (indices[row] < entities.size())
+                            {
+                                entities[indices[row]]["camera"] = {
+                                    {"clearFlags", clearFlags[row]},
+                                    {"zFar", zFars[row]},
+                                    {"environmentMap", std::string(getString(strings, environmentMaps[row]))}};
+                                if (mainCameras)
+                                    entities[indices[row]]["camera"]["isMainCamera"] = mainCameras[row] != 0;
+                            }
+                        }
+                        break;
+                    }
+
+                    case SceneChunkType::eMeshes: {
+                        const auto* indices = view.column<uint32_t>(0);
+                        const auto* paths   = view.column<SceneStringRef>(1);
+                        for (uint32_t row = 0; indices && paths && row < rowCount; ++row)
+                        {
+                            if (indices[row] < entities.size())
+                            {
+                                entities[indices[row]]["mesh"] = {
+                                    {"path", std::string(getString(strings, paths[row]))}};
+                            }
+                        }
+                        break;
+                    }
+
+                    case SceneChunkType::eDirectionalLights: {
+                        const auto* indices     = view.column<uint32_t>(0);
+                        const auto* directions  = view.column<SceneVec3>(1);
+                        const auto* colors      = view.column<SceneVec3>(2);
+                        const auto* intensities = view.column<float>(3);
+                        const bool  isComplete  = indices && directions && colors && intensities;
+                        for (uint32_t row = 0; isComplete && row < rowCount; ++row)
+                        {
+                            if (indices[row] < entities.size())
+                            {
+                                entities[indices[row]]["directionalLight"] = {{"direction", toJson(directions[row])},
+                                                                              {"color", toJson(colors[row])},
+                                                                              {"intensity", intensities[row]}};
+                            }
+                        }
+                        break;
+                    }
+
+                    case SceneChunkType::ePointLights: {
+                        const auto* indices     = view.column<uint32_t>(0);
+                        const auto* colors      = view.column<SceneVec3>(1);
+                        const auto* intensities = view.column<float>(2);
+                        const auto* radii       = view.column<float>(3);
+                        for (uint32_t row = 0; indices && colors && intensities && radii && row < rowCount; ++row)
+                        {
+                            if (indices[row] < entities.size())
+                            {
+                                entities[indices[row]]["pointLight"] = {{"color", toJson(colors[row])},
+                                                                        {"intensity", intensities[row]},
+                                                                        {"radius", radii[row]}};
+                            }
+                        }
+                        break;
+                    }
+
+                    case SceneChunkType::eAreaLights: {
+                        const auto* indices     = view.column<uint32_t>(0);
+                        const auto* colors      = view.column<SceneVec3>(1);
+                        const auto* intensities = view.column<float>(2);
+                        const auto* widths      = view.column<float>(3);
+                        const auto* heights     = view.column<float>(4);
+                        const bool  isComplete  = indices && colors && intensities && widths && heights;
+                        for (uint32_t row = 0; isComplete && row < rowCount; ++row)
+                        {
+                            if (indices[row] < entities.size())
+                            {
+                                entities[indices[row]]["areaLight"] = {{"color", toJson(colors[row])},
+                                                                       {"intensity", intensities[row]},
+                                                                       {"width", widths[row]},
+                                                                       {"height", heights[row]}};
+                            }
+                        }
+                        break;
+                    }
+
+                    default:
+                        break;
+                }
+            }
+
+            nlohmann::ordered_json j;
+            j["version"]  = header.version;
+            j["entities"] = std::move(entities);
+
+            std::ofstream out(jsonPath, std::ios::trunc);
+            out << j.dump(4);
+            if (!out.good())
+            {
+                VULTRA_CORE_ERROR("Failed to write scene JSON: {}", jsonPath.generic_string());
+                return false;
+            }
+            return true;
+        }
+    } // namespace engine
+} // namespace vultra
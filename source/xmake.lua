@@ -1,3 +1,4 @@
 includes("engine")
 includes("editor")
+includes("cook")
 includes("hub")
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <vultra/core/base/common_context.hpp>
+
+#include <nanobench.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <string>
+#include <string_view>
+
+namespace vultra
+{
+    namespace bench
+    {
+        struct BenchContext
+        {
+            std::filesystem::path projectFile; // Empty if no project was given
+            std::filesystem::path workDir;     // Scratch folder for generated files, removed after the run
+        };
+
+        // Every group adds its results to the same Bench under its own title, so a run renders into a single JSON
+        // document that can be diffed between commits
+        void runAssetRegistryBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext& context);
+        void runAssetMetaBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext& context);
+        void runSelectorBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext& context);
+        void runConsoleLogBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext& context);
+        void runProjectBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext& context);
+        void runPickingBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext& context);
+
+        // Groups that also check their results against a brute-force reference report mismatches here; the run then
+        // exits with an error, so a fast but wrong version cannot pass as an improvement
+        inline uint32_t& getFailedCheckCount()
+        {
+            static uint32_t count = 0;
+            return count;
+        }
+
+        inline bool check(bool condition, std::string_view what)
+        {
+            if (!condition)
+            {
+                VULTRA_CLIENT_ERROR("Check failed: {}", what);
+                getFailedCheckCount()++;
+            }
+            return condition;
+        }
+
+        // Deterministic, well spread UUID string for generated fixtures, so runs are comparable
+        inline std::string makeUUIDString(uint64_t index)
+        {
+            auto mix = [](uint64_t x) {
+                x += 0x9e3779b97f4a7c15ull;
+                x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+                x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+                return x ^ (x >> 31);
+            };
+
+            const uint64_t hi = mix(index * 2);
+            const uint64_t lo = mix(index * 2 + 1);
+            return std::format("{:08x}-{:04x}-4{:03x}-{:04x}-{:012x}",
+                               hi >> 32,
+                               (hi >> 16) & 0xffff,
+                               hi & 0xfff,
+                               0x8000 | ((lo >> 48) & 0x3fff),
+                               lo & 0xffffffffffffull);
+        }
+    } // namespace bench
+} // namespace vultra
@@ -0,0 +1,43 @@
+#include "vultra_bench/bench_context.hpp"
+
+#include <vultra_editor/asset/asset_database.hpp>
+
+#include <fstream>
+#include <vector>
+
+namespace vultra
+{
+    namespace bench
+    {
+        namespace
+        {
+            constexpr uint64_t META_FILE_COUNT = 1000;
+        } // namespace
+
+        void runAssetMetaBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext& context)
+        {
+            // Same shape as the .vmeta files vasset writes next to source assets
+            const auto metaDir = context.workDir / "Meta";
+            std::filesystem::create_directories(metaDir);
+
+            std::vector<std::filesystem::path> assetPaths;
+            for (uint64_t i = 0; i < META_FILE_COUNT; i++)
+            {
+                auto assetPath = metaDir / std::format("texture_{:04}.png", i);
+
+                auto          metaPath = std::filesystem::path(assetPath).replace_extension(".vmeta");
+                std::ofstream out(metaPath, std::ios::trunc);
+                out << nlohmann::json {{"uuid", makeUUIDString(i)}, {"extension", ".png"}}.dump(4);
+
+                assetPaths.push_back(std::move(assetPath));
+            }
+
+            bench.title("Asset meta").unit("file").batch(assetPaths.size());
+
+            bench.run("AssetDatabase::getMetaJson", [&] {
+                for (const auto& assetPath : assetPaths)
+                    ankerl::nanobench::doNotOptimizeAway(editor::AssetDatabase::getMetaJson(assetPath));
+            });
+        }
+    } // namespace bench
+} // namespace vultra
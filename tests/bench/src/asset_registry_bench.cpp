@@ -0,0 +1,79 @@
+#include "vultra_bench/bench_context.hpp"
+
+#include <vultra_engine/asset/binary_asset_registry.hpp>
+
+#include <vasset/vasset.hpp>
+
+#include <vector>
+
+namespace vultra
+{
+    namespace bench
+    {
+        namespace
+        {
+            // About what a mid-sized project accumulates
+            constexpr uint64_t REGISTRY_ENTRY_COUNT = 20000;
+
+            void fillRegistry(vasset::VAssetRegistry& registry, std::vector<vasset::VUUID>& uuids)
+            {
+                auto& entries = registry.getRegistry();
+                for (uint64_t i = 0; i < REGISTRY_ENTRY_COUNT; i++)
+                {
+                    const auto uuidStr = makeUUIDString(i);
+                    auto&      entry   = entries[uuidStr];
+                    entry.type         = i % 4 == 0 ? vasset::VAssetType::eMesh : vasset::VAssetType::eTexture;
+                    entry.path         = std::format("Assets/Folder{:03}/asset_{:06}.vasset", i % 128, i);
+                    uuids.push_back(vasset::VUUID::fromString(uuidStr));
+                }
+            }
+        } // namespace
+
+        void runAssetRegistryBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext& context)
+        {
+            vasset::VAssetRegistry     registry;
+            std::vector<vasset::VUUID> uuids;
+            fillRegistry(registry, uuids);
+
+            const auto binaryFile = context.workDir / "asset_registry.vreg";
+            const auto jsonFile   = context.workDir / "asset_registry.json";
+
+            bench.title("Asset registry").unit("registry").batch(1);
+
+            bench.run("BinaryAssetRegistry::write", [&] {
+                engine::BinaryAssetRegistry binaryRegistry;
+                ankerl::nanobench::doNotOptimizeAway(binaryRegistry.write(binaryFile, registry));
+            });
+
+            bench.run("BinaryAssetRegistry::open", [&] {
+                engine::BinaryAssetRegistry binaryRegistry;
+                ankerl::nanobench::doNotOptimizeAway(binaryRegistry.open(binaryFile));
+            });
+
+            bench.run("BinaryAssetRegistry::copyTo", [&] {
+                engine::BinaryAssetRegistry binaryRegistry;
+                binaryRegistry.open(binaryFile);
+
+                vasset::VAssetRegistry copy;
+                binaryRegistry.copyTo(copy);
+                ankerl::nanobench::doNotOptimizeAway(copy.getRegistry().size());
+            });
+
+            // What AssetDatabase::lookupAsset does once the registry is loaded
+            bench.unit("lookup").batch(uuids.size()).run("VAssetRegistry::lookup", [&] {
+                for (const auto& uuid : uuids)
+                    ankerl::nanobench::doNotOptimizeAway(registry.lookup(uuid));
+            });
+
+            bench.unit("registry").batch(1);
+
+            bench.run("VAssetRegistry::save (JSON)", [&] { registry.save(jsonFile.string()); });
+
+            bench.run("VAssetRegistry::load (JSON)", [&] {
+                vasset::VAssetRegistry loaded;
+                loaded.load(jsonFile.string());
+                ankerl::nanobench::doNotOptimizeAway(loaded.getRegistry().size());
+            });
+        }
+    } // namespace bench
+} // namespace vultra
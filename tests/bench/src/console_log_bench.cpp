@@ -0,0 +1,66 @@
+#include "vultra_bench/bench_context.hpp"
+
+#include <vultra_editor/log/console_log_buffer.hpp>
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vultra
+{
+    namespace bench
+    {
+        namespace
+        {
+            constexpr size_t RING_CAPACITY     = 4096;
+            constexpr size_t PRODUCER_COUNT    = 4;
+            constexpr size_t LONG_MESSAGE_SIZE = 512; // Spills out of the inline cell storage
+        } // namespace
+
+        void runConsoleLogBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext&)
+        {
+            std::array<std::string, 8> messages;
+            for (size_t i = 0; i < messages.size(); i++)
+            {
+                messages[i] =
+                    std::format("[Asset] Imported Assets/Textures/texture_{:04}.png in {:.2f} ms", i, i * 1.5);
+            }
+
+            const std::string longMessage(LONG_MESSAGE_SIZE, 'x');
+
+            // One frame's worth: fill the ring, then drain it into the history. Once the history is full every drain
+            // also releases the oldest entries, as in a long editor session.
+            editor::ConsoleLogBuffer buffer(RING_CAPACITY);
+            bench.title("Console log").unit("message").batch(RING_CAPACITY);
+
+            bench.run("ConsoleLogBuffer::push + drain", [&] {
+                for (size_t i = 0; i < RING_CAPACITY; i++)
+                    buffer.push(Logger::Level::eInfo, messages[i % messages.size()]);
+                ankerl::nanobench::doNotOptimizeAway(buffer.drain());
+            });
+
+            bench.run("ConsoleLogBuffer::push + drain (long messages)", [&] {
+                for (size_t i = 0; i < RING_CAPACITY; i++)
+                    buffer.push(Logger::Level::eWarn, longMessage);
+                ankerl::nanobench::doNotOptimizeAway(buffer.drain());
+            });
+
+            // Contended producers: several threads share the ring while the owner drains
+            bench.run("ConsoleLogBuffer::push (4 threads) + drain", [&] {
+                std::vector<std::thread> producers;
+                for (size_t t = 0; t < PRODUCER_COUNT; t++)
+                {
+                    producers.emplace_back([&, t] {
+                        for (size_t i = t; i < RING_CAPACITY; i += PRODUCER_COUNT)
+                            buffer.push(Logger::Level::eInfo, messages[i % messages.size()]);
+                    });
+                }
+                for (auto& producer : producers)
+                    producer.join();
+                ankerl::nanobench::doNotOptimizeAway(buffer.drain());
+            });
+        }
+    } // namespace bench
+} // namespace vultra
@@ -0,0 +1,90 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "vultra_bench/bench_context.hpp"
+
+#include <vultra/core/base/common_context.hpp>
+
+#include <argparse/argparse.hpp>
+
+#include <fstream>
+
+namespace
+{
+    struct BenchGroup
+    {
+        const char* name;
+        void (*run)(ankerl::nanobench::Bench&, const vultra::bench::BenchContext&);
+    };
+
+    constexpr BenchGroup BENCH_GROUPS[] = {
+        {"registry", vultra::bench::runAssetRegistryBenchmarks},
+        {"meta", vultra::bench::runAssetMetaBenchmarks},
+        {"selector", vultra::bench::runSelectorBenchmarks},
+        {"console", vultra::bench::runConsoleLogBenchmarks},
+        {"project", vultra::bench::runProjectBenchmarks},
+        {"picking", vultra::bench::runPickingBenchmarks},
+    };
+} // namespace
+
+int main(int argc, char** argv)
+{
+    argparse::ArgumentParser parser("VultraBench");
+    parser.add_description("Microbenchmarks for editor and engine hot paths");
+
+    parser.add_argument("--project")
+        .help("Project file (.vproj) for the project load and directory scan benchmarks")
+        .default_value(std::string(""));
+    parser.add_argument("--json").help("Write the results as JSON to this path").default_value(std::string(""));
+    parser.add_argument("--filter")
+        .help("Only run groups whose name contains this (registry, meta, selector, console, project, picking)")
+        .default_value(std::string(""));
+
+    try
+    {
+        parser.parse_args(argc, argv);
+    }
+    catch (const std::exception& e)
+    {
+        VULTRA_CLIENT_ERROR("{}", e.what());
+        return 2;
+    }
+
+    vultra::bench::BenchContext context;
+    context.projectFile = parser.get<std::string>("--project");
+    context.workDir     = std::filesystem::temp_directory_path() / "VultraBench";
+
+    std::error_code ec;
+    std::filesystem::remove_all(context.workDir, ec);
+    std::filesystem::create_directories(context.workDir, ec);
+
+    const auto filter = parser.get<std::string>("--filter");
+
+    ankerl::nanobench::Bench bench;
+    for (const auto& group : BENCH_GROUPS)
+    {
+        if (filter.empty() || std::string_view(group.name).find(filter) != std::string_view::npos)
+            group.run(bench, context);
+    }
+
+    std::filesystem::remove_all(context.workDir, ec);
+
+    if (const auto failedChecks = vultra::bench::getFailedCheckCount(); failedChecks > 0)
+    {
+        VULTRA_CLIENT_ERROR("{} benchmark checks failed", failedChecks);
+        return 1;
+    }
+
+    const auto jsonFile = parser.get<std::string>("--json");
+    if (!jsonFile.empty())
+    {
+        std::ofstream out(jsonFile, std::ios::trunc);
+        ankerl::nanobench::render(ankerl::nanobench::templates::json(), bench, out);
+        if (!out.good())
+        {
+            VULTRA_CLIENT_ERROR("Failed to write benchmark results: {}", jsonFile);
+            return 1;
+        }
+        VULTRA_CLIENT_INFO("Benchmark results written to {}", jsonFile);
+    }
+
+    return 0;
+}
@@ -0,0 +1,301 @@
+#include "vultra_bench/bench_context.hpp"
+
+#include <vultra_editor/picking/scene_picker.hpp>
+
+#include <vultra/function/scenegraph/components.hpp>
+#include <vultra/function/scenegraph/logic_scene.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace vultra
+{
+    namespace bench
+    {
+        namespace
+        {
+            using editor::BoundingBox;
+            using editor::PickingRay;
+
+            // A large scene spread over a few hundred meters
+            constexpr uint32_t BOX_COUNT     = 50000;
+            constexpr uint32_t RAY_COUNT     = 1024;
+            constexpr uint32_t FRUSTUM_COUNT = 64;
+            constexpr uint32_t ENTITY_COUNT  = 10000;
+            constexpr float    WORLD_EXTENT  = 200.0f;
+            constexpr uint32_t RANDOM_SEED   = 0x5EED;
+
+            // Relative, distances are compared after different traversal orders
+            constexpr float DISTANCE_TOLERANCE = 1e-4f;
+            // World units; boxes this close to a frustum plane are not checked
+            constexpr float PLANE_TOLERANCE = 1e-3f;
+
+            std::vector<BoundingBox> makeBoxes(std::mt19937& rng)
+            {
+                std::uniform_real_distribution<float> position(-WORLD_EXTENT, WORLD_EXTENT);
+                std::uniform_real_distribution<float> size(0.2f, 4.0f);
+
+                std::vector<BoundingBox> boxes(BOX_COUNT);
+                for (auto& box : boxes)
+                {
+                    const glm::vec3 center(position(rng), position(rng), position(rng));
+                    const glm::vec3 halfSize(size(rng), size(rng), size(rng));
+                    box = {center - halfSize, center + halfSize};
+                }
+                return boxes;
+            }
+
+            // From random points near the edge of the world towards random points inside it
+            std::vector<PickingRay> makeRays(std::mt19937& rng)
+            {
+                std::uniform_real_distribution<float> position(-WORLD_EXTENT, WORLD_EXTENT);
+
+                std::vector<PickingRay> rays(RAY_COUNT);
+                for (auto& ray : rays)
+                {
+                    const glm::vec3 target(position(rng), position(rng), position(rng));
+                    ray.origin    = glm::vec3(position(rng), position(rng), position(rng)) * 1.2f;
+                    ray.direction = glm::normalize(target - ray.origin);
+                }
+                return rays;
+            }
+
+            // Camera-like pyramids of different widths, looking into the world from random places
+            std::vector<editor::PickingFrustum> makeFrustums(std::mt19937& rng)
+            {
+                std::uniform_real_distribution<float> position(-WORLD_EXTENT, WORLD_EXTENT);
+                std::uniform_real_distribution<float> spread(0.02f, 0.5f);
+
+                std::vector<editor::PickingFrustum> frustums(FRUSTUM_COUNT);
+                for (auto& frustum : frustums)
+                {
+                    const glm::vec3 origin(position(rng), position(rng), position(rng));
+                    const glm::vec3 forward = glm::normalize(glm::vec3(position(rng), position(rng), position(rng)));
+                    const glm::vec3 helper  = std::abs(forward.y) < 0.9f ? glm::vec3(0, 1, 0) : glm::vec3(1, 0, 0);
+                    const glm::vec3 right   = glm::normalize(glm::cross(forward, helper));
+                    const glm::vec3 up      = glm::cross(right, forward);
+
+                    const float w = spread(rng);
+                    const float h = spread(rng);
+                    frustum       = editor::PickingFrustum::fromCornerRays(origin,
+                                                                     {forward - right * w - up * h,
+                                                                      forward + right * w - up * h,
+                                                                      forward + right * w + up * h,
+                                                                      forward - right * w + up * h});
+                }
+                return frustums;
+            }
+
+            std::optional<float> bruteForceRaycast(std::span<const BoundingBox> boxes, const PickingRay& ray)
+            {
+                std::optional<float> nearest;
+                for (const auto& box : boxes)
+                {
+                    const auto distance = editor::intersectRayBox(ray, box);
+                    if (distance && (!nearest || *distance < *nearest))
+                        nearest = distance;
+                }
+                return nearest;
+            }
+
+            // Scalar reference for PackedFrustum: a box is outside as soon as its corner furthest along a plane's
+            // normal is behind that plane. std::nullopt if that corner is too close to a plane to tell, where the
+            // packed test may round the other way.
+            std::optional<bool> bruteForceIntersects(const editor::PickingFrustum& frustum, const BoundingBox& box)
+            {
+                bool ambiguous = false;
+                for (uint32_t i = 0; i < frustum.planeCount; i++)
+                {
+                    const auto&     plane = frustum.planes[i];
+                    const glm::vec3 normal(plane);
+                    const glm::vec3 corner(normal.x >= 0.0f ? box.max.x : box.min.x,
+                                           normal.y >= 0.0f ? box.max.y : box.min.y,
+                                           normal.z >= 0.0f ? box.max.z : box.min.z);
+
+                    const float distance = glm::dot(normal, corner) + plane.w;
+                    if (distance < -PLANE_TOLERANCE)
+                        return false;
+                    ambiguous |= distance < PLANE_TOLERANCE;
+                }
+                return ambiguous ? std::nullopt : std::optional<bool>(true);
+            }
+
+            bool isSameDistance(const std::optional<float>& a, const std::optional<float>& b)
+            {
+                if (!a || !b)
+                    return a.has_value() == b.has_value();
+                return std::abs(*a - *b) <= DISTANCE_TOLERANCE * std::max(1.0f, std::abs(*b));
+            }
+
+            void runBVHBenchmarks(ankerl::nanobench::Bench& bench, std::mt19937& rng)
+            {
+                const auto boxes    = makeBoxes(rng);
+                const auto rays     = makeRays(rng);
+                const auto frustums = makeFrustums(rng);
+
+                editor::BoundingVolumeHierarchy bvh;
+                bench.unit("item").batch(boxes.size()).run("BoundingVolumeHierarchy::build",
+                                                            [&] { bvh.build(boxes); });
+
+                // Correctness first: every query must match a scan over all boxes
+                uint32_t rayMismatches = 0;
+                for (const auto& ray : rays)
+                {
+                    const auto hit = bvh.raycast(ray);
+                    if (!isSameDistance(hit ? std::optional<float>(hit->distance) : std::nullopt,
+                                        bruteForceRaycast(boxes, ray)))
+                        rayMismatches++;
+                }
+                check(rayMismatches == 0,
+                      std::format("BVH raycast differs from brute force for {} rays", rayMismatches));
+
+                uint32_t              frustumMismatches = 0;
+                uint32_t              packedMismatches  = 0;
+                std::vector<uint32_t> items;
+                std::vector<uint8_t>  found(boxes.size());
+                for (const auto& frustum : frustums)
+                {
+                    const editor::PackedFrustum packed(frustum);
+
+                    items.clear();
+                    bvh.queryFrustum(packed, items);
+                    std::fill(found.begin(), found.end(), uint8_t {0});
+                    for (const auto item : items)
+                        found[item]++;
+
+                    bool matches = std::all_of(found.begin(), found.end(), [](uint8_t count) { return count <= 1; });
+                    for (uint32_t i = 0; i < boxes.size(); i++)
+                    {
+                        const auto reference = bruteForceIntersects(frustum, boxes[i]);
+                        if (!reference)
+                            continue;
+
+                        if (packed.intersects(boxes[i]) != *reference)
+                            packedMismatches++;
+                        matches &= (found[i] != 0) == *reference;
+                    }
+                    if (!matches)
+                        frustumMismatches++;
+                }
+                check(packedMismatches == 0,
+                      std::format("PackedFrustum::intersects differs from the scalar test for {} boxes",
+                                  packedMismatches));
+                check(frustumMismatches == 0,
+                      std::format("BVH frustum query differs from brute force for {} frustums", frustumMismatches));
+
+                bench.unit("ray").batch(rays.size()).run("BoundingVolumeHierarchy::raycast", [&] {
+                    for (const auto& ray : rays)
+                        ankerl::nanobench::doNotOptimizeAway(bvh.raycast(ray));
+                });
+
+                bench.run("Brute force raycast (reference)", [&] {
+                    for (const auto& ray : rays)
+                        ankerl::nanobench::doNotOptimizeAway(bruteForceRaycast(boxes, ray));
+                });
+
+                bench.unit("frustum").batch(frustums.size()).run("BoundingVolumeHierarchy::queryFrustum", [&] {
+                    for (const auto& frustum : frustums)
+                    {
+                        items.clear();
+                        bvh.queryFrustum(editor::PackedFrustum(frustum), items);
+                        ankerl::nanobench::doNotOptimizeAway(items.data());
+                    }
+                });
+
+                bench.unit("box").batch(boxes.size()).run("PackedFrustum::intersects", [&] {
+                    const editor::PackedFrustum packed(frustums.front());
+                    for (const auto& box : boxes)
+                        ankerl::nanobench::doNotOptimizeAway(packed.intersects(box));
+                });
+
+                // Refit after moving one item, as when dragging a gizmo
+                std::uniform_int_distribution<uint32_t> pickItem(0, BOX_COUNT - 1);
+                bench.unit("update").batch(1).run("BoundingVolumeHierarchy::updateItem", [&] {
+                    const uint32_t item  = pickItem(rng);
+                    auto           moved = boxes[item];
+                    moved.min.x += 0.01f;
+                    moved.max.x += 0.01f;
+                    bvh.updateItem(item, moved);
+                });
+            }
+
+            void runScenePickerBenchmarks(ankerl::nanobench::Bench& bench, std::mt19937& rng)
+            {
+                std::uniform_real_distribution<float> position(-WORLD_EXTENT, WORLD_EXTENT);
+                std::uniform_real_distribution<float> angle(0.0f, 180.0f);
+                std::uniform_real_distribution<float> scale(0.5f, 4.0f);
+
+                // Entities without a mesh, so the picker uses a unit cube for each; rotated to exercise the oriented
+                // box test
+                LogicScene          scene("Picking Bench");
+                std::vector<Entity> entities;
+                entities.reserve(ENTITY_COUNT);
+                for (uint32_t i = 0; i < ENTITY_COUNT; i++)
+                {
+                    auto  entity       = scene.createEntity("Entity");
+                    auto& transform    = entity.getComponent<TransformComponent>();
+                    transform.position = glm::vec3(position(rng), position(rng), position(rng));
+                    transform.scale    = glm::vec3(scale(rng), scale(rng), scale(rng));
+                    transform.setRotationEuler({angle(rng), angle(rng), angle(rng)});
+                    entities.push_back(entity);
+                }
+
+                editor::ScenePicker picker;
+                picker.update(&scene);
+
+                const auto rays = makeRays(rng);
+
+                // Reference: the oriented unit cube of every entity, tested one by one
+                auto bruteForcePick = [&](const PickingRay& ray) {
+                    std::optional<float> nearest;
+                    for (auto& entity : entities)
+                    {
+                        const glm::mat4 worldToLocal =
+                            glm::inverse(entity.getComponent<TransformComponent>().getTransform());
+
+                        PickingRay localRay;
+                        localRay.origin    = glm::vec3(worldToLocal * glm::vec4(ray.origin, 1.0f));
+                        localRay.direction = glm::vec3(worldToLocal * glm::vec4(ray.direction, 0.0f));
+
+                        const auto distance =
+                            editor::intersectRayBox(localRay, BoundingBox {glm::vec3(-0.5f), glm::vec3(0.5f)});
+                        if (distance && (!nearest || *distance < *nearest))
+                            nearest = distance;
+                    }
+                    return nearest;
+                };
+
+                uint32_t mismatches = 0;
+                for (const auto& ray : rays)
+                {
+                    const auto hit = picker.pick(ray);
+                    if (!isSameDistance(hit ? std::optional<float>(hit->distance) : std::nullopt, bruteForcePick(ray)))
+                        mismatches++;
+                }
+                check(mismatches == 0,
+                      std::format("ScenePicker::pick differs from brute force for {} rays", mismatches));
+
+                bench.unit("ray").batch(rays.size()).run("ScenePicker::pick", [&] {
+                    for (const auto& ray : rays)
+                        ankerl::nanobench::doNotOptimizeAway(picker.pick(ray));
+                });
+
+                bench.run("Brute force pick (reference)", [&] {
+                    for (const auto& ray : rays)
+                        ankerl::nanobench::doNotOptimizeAway(bruteForcePick(ray));
+                });
+            }
+        } // namespace
+
+        void runPickingBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext&)
+        {
+            std::mt19937 rng(RANDOM_SEED);
+
+            bench.title("Picking");
+            runBVHBenchmarks(bench, rng);
+            runScenePickerBenchmarks(bench, rng);
+        }
+    } // namespace bench
+} // namespace vultra
@@ -0,0 +1,38 @@
+#include "vultra_bench/bench_context.hpp"
+
+#include <vultra_editor/asset/asset_directory_tree.hpp>
+#include <vultra_engine/asset/asset_paths.hpp>
+#include <vultra_engine/project/project.hpp>
+
+#include <vultra/core/base/common_context.hpp>
+
+namespace vultra
+{
+    namespace bench
+    {
+        void runProjectBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext& context)
+        {
+            if (context.projectFile.empty())
+            {
+                VULTRA_CLIENT_WARN("No project given, skipping project benchmarks");
+                return;
+            }
+
+            const auto projectFile = context.projectFile.generic_string();
+            const auto assetDir    = context.projectFile.parent_path() / engine::ASSET_IMPORT_FOLDER;
+
+            bench.title("Project").unit("project").batch(1);
+
+            bench.run("engine::loadProject", [&] {
+                engine::Project project {};
+                ankerl::nanobench::doNotOptimizeAway(engine::loadProject(projectFile, project));
+            });
+
+            bench.unit("scan").run("AssetDirectoryTree::build", [&] {
+                editor::AssetDirectoryTree tree;
+                tree.build(assetDir);
+                ankerl::nanobench::doNotOptimizeAway(tree.getNodes().size());
+            });
+        }
+    } // namespace bench
+} // namespace vultra
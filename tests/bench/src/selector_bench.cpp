@@ -0,0 +1,75 @@
+#include "vultra_bench/bench_context.hpp"
+
+#include <vultra_editor/selector.hpp>
+
+#include <vultra/function/scenegraph/logic_scene.hpp>
+
+#include <vector>
+
+namespace vultra
+{
+    namespace bench
+    {
+        namespace
+        {
+            // Select-all in a large scene
+            constexpr uint64_t SELECTION_COUNT = 100000;
+        } // namespace
+
+        void runSelectorBenchmarks(ankerl::nanobench::Bench& bench, const BenchContext&)
+        {
+            using editor::SelectionCategory;
+            using editor::Selector;
+
+            // Real entity UUIDs, CoreUUID has no way to make one from a number
+            LogicScene            scene("Selector Bench");
+            std::vector<CoreUUID> uuids;
+            uuids.reserve(SELECTION_COUNT);
+            for (uint64_t i = 0; i < SELECTION_COUNT; i++)
+                uuids.push_back(scene.createEntity("Entity").getCoreUUID());
+
+            const std::span<const CoreUUID> all(uuids);
+            const std::span<const CoreUUID> firstHalf = all.first(uuids.size() / 2);
+            const std::span<const CoreUUID> lastHalf  = all.last(uuids.size() - firstHalf.size());
+
+            Selector::unselectAll();
+            bench.title("Selector").unit("selection").batch(uuids.size());
+
+            // Alternate between two different sets, so every call really replaces the selection
+            bench.run("Selector::setSelection", [&] {
+                Selector::setSelection(SelectionCategory::eEntity, firstHalf);
+                Selector::setSelection(SelectionCategory::eEntity, lastHalf);
+            });
+
+            // Same set every time, the early out
+            Selector::setSelection(SelectionCategory::eEntity, all);
+            bench.run("Selector::setSelection (unchanged)",
+                      [&] { Selector::setSelection(SelectionCategory::eEntity, all); });
+
+            bench.run("Selector::isSelected", [&] {
+                for (const auto& uuid : uuids)
+                    ankerl::nanobench::doNotOptimizeAway(Selector::isSelected(SelectionCategory::eEntity, uuid));
+            });
+
+            bench.run("Selector::select (one by one) + unselectAll", [&] {
+                Selector::unselectAll(SelectionCategory::eEntity);
+                for (const auto& uuid : uuids)
+                    Selector::select(SelectionCategory::eEntity, uuid);
+            });
+
+            // Ctrl+click on one entity of the full selection, twice so every iteration ends where it started
+            const CoreUUID middle = uuids[uuids.size() / 2];
+            bench.unit("toggle").batch(2).run("Selector::toggle (in full selection)", [&] {
+                Selector::toggle(SelectionCategory::eEntity, middle);
+                Selector::toggle(SelectionCategory::eEntity, middle);
+            });
+
+            bench.unit("selection").batch(uuids.size()).run("Selector::unselect (span, half) + select (span)", [&] {
+                Selector::unselect(SelectionCategory::eEntity, firstHalf);
+                Selector::select(SelectionCategory::eEntity, firstHalf);
+            });
+
+            Selector::unselectAll();
+        }
+    } // namespace bench
+} // namespace vultra
@@ -0,0 +1,26 @@
+add_requires("nanobench", "argparse")
+
+target("VultraBench")
+    -- set kind: binary
+    set_kind("binary")
+
+    -- add include dir
+    add_includedirs("include")
+
+    -- add header files
+    add_headerfiles("include/(vultra_bench/**.hpp)")
+
+    -- add source files
+    add_files("src/**.cpp")
+
+    -- add packages
+    add_packages("nanobench", "argparse")
+
+    -- add deps, the editor code under test comes from VultraEditorCore
+    add_deps("VultraEditorCore")
+
+    -- set run arguments
+    set_runargs("--project", "$(projectdir)/example_project/ExampleProject.vproj", "--json", "$(builddir)/bench.json")
+
+    -- set target directory
+    set_targetdir("$(builddir)/$(plat)/$(arch)/$(mode)/VultraBench")
@@ -0,0 +1 @@
+includes("bench")
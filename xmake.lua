@@ -14,6 +14,12 @@ option("tests") -- build tests?
     set_description("Enable tests")
 option_end()
 
+option("memory_hook") -- count editor heap allocations per subsystem?
+    set_default(true)
+    set_showmenu(true)
+    set_description("Replace the editor's global operator new/delete to feed the Memory window")
+option_end()
+
 -- if build on windows
 if is_plat("windows") then
     add_cxxflags("/Zc:__cplusplus", {tools = {"msvc", "cl"}}) -- fix __cplusplus == 199711L error